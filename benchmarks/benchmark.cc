@@ -0,0 +1,127 @@
+// Standard C++ includes
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Standard C includes
+#include <cstdlib>
+
+// CLI11 includes
+#include "../include/genn/third_party/CLI11.hpp"
+
+// GeNN user project includes
+#include "../userproject/include/sharedLibraryModel.h"
+#include "../userproject/include/timer.h"
+
+//------------------------------------------------------------------------
+// Anonymous namespace
+//------------------------------------------------------------------------
+namespace
+{
+//! Read memory requirements written by the code generator into generated code directory
+void writeMemAlloc(std::ofstream &output, const std::string &modelPath, const std::string &modelName)
+{
+    std::ifstream memAllocFile(modelPath + modelName + "_CODE/memAlloc.txt");
+    std::string name;
+    unsigned long long bytes;
+    while(memAllocFile >> name >> bytes) {
+        output << "    \"" << name << "\": " << bytes << "," << std::endl;
+    }
+}
+
+template<typename scalar>
+void runBenchmark(const std::string &modelPath, const std::string &modelName, double durationMs, const std::string &outputFilename)
+{
+    SharedLibraryModel<scalar> model(modelPath, modelName);
+
+    // Time allocation and initialisation from outside the model as well as using GeNN's timers
+    double allocateS = 0.0;
+    double initializeS = 0.0;
+    double initializeSparseS = 0.0;
+    {
+        TimerAccumulate timer(allocateS);
+        model.allocateMem();
+    }
+    {
+        TimerAccumulate timer(initializeS);
+        model.initialize();
+    }
+    {
+        TimerAccumulate timer(initializeSparseS);
+        model.initializeSparse();
+    }
+
+    // Simulate for fixed duration
+    // **NOTE** like the user projects, no data is copied from the device so only the simulation itself is measured
+    double simulateS = 0.0;
+    {
+        TimerAccumulate timer(simulateS);
+        while(model.getTime() < durationMs) {
+            model.stepTime();
+        }
+    }
+
+    // Write results
+    std::ofstream output(outputFilename);
+    output.precision(9);
+    output << "{" << std::endl;
+    output << "    \"model\": \"" << modelName << "\"," << std::endl;
+    output << "    \"durationMs\": " << durationMs << "," << std::endl;
+    output << "    \"numTimesteps\": " << model.getTimestep() << "," << std::endl;
+    output << "    \"realTimeFactor\": " << (durationMs / 1000.0) / simulateS << "," << std::endl;
+    output << "    \"simulateTime\": " << simulateS << "," << std::endl;
+    output << "    \"allocateTime\": " << allocateS << "," << std::endl;
+    output << "    \"initializeTime\": " << initializeS << "," << std::endl;
+    output << "    \"initializeSparseTime\": " << initializeSparseS << "," << std::endl;
+    writeMemAlloc(output, modelPath, modelName);
+    output << "    \"initTime\": " << model.getInitTime() << "," << std::endl;
+    output << "    \"initSparseTime\": " << model.getInitSparseTime() << "," << std::endl;
+    output << "    \"neuronUpdateTime\": " << model.getNeuronUpdateTime() << "," << std::endl;
+    output << "    \"presynapticUpdateTime\": " << model.getPresynapticUpdateTime() << "," << std::endl;
+    output << "    \"postsynapticUpdateTime\": " << model.getPostsynapticUpdateTime() << "," << std::endl;
+    output << "    \"synapseDynamicsTime\": " << model.getSynapseDynamicsTime() << std::endl;
+    output << "}" << std::endl;
+
+    std::cout << modelName << ": simulated " << durationMs << "ms in " << simulateS << "s (real-time factor " << (durationMs / 1000.0) / simulateS << ")" << std::endl;
+}
+}   // Anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    CLI::App app{"Benchmark a GeNN model built as a shared library"};
+
+    std::string modelPath;
+    std::string modelName;
+    std::string outputFilename;
+    std::string scalarType = "float";
+    double durationMs = 1000.0;
+
+    app.add_set("--ftype", scalarType, {"float", "double"}, "What floating point type model was built with", true);
+    app.add_option("--duration", durationMs, "Duration of simulation [ms]", true);
+    app.add_option("modelPath", modelPath, "Directory containing generated code directory")->required();
+    app.add_option("modelName", modelName, "Name of model")->required();
+    app.add_option("output", outputFilename, "JSON file to write results to")->required();
+
+    CLI11_PARSE(app, argc, argv);
+
+    // Ensure path to model ends in a separator
+    if(modelPath.back() != '/') {
+        modelPath += "/";
+    }
+
+    try
+    {
+        if(scalarType == "float") {
+            runBenchmark<float>(modelPath, modelName, durationMs, outputFilename);
+        }
+        else {
+            runBenchmark<double>(modelPath, modelName, durationMs, outputFilename);
+        }
+    }
+    catch(const std::exception &exception)
+    {
+        std::cerr << exception.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,164 @@
+#!/usr/bin/env python
+"""Build and run the GeNN benchmark suite and compare results against a baseline.
+
+Each benchmark in the suite is one of the user projects, built for the
+single-threaded CPU backend with GeNN's timers enabled at the sizes given
+in the suite. The model is then loaded by the benchmark driver, which
+simulates it for a fixed duration and records the real-time factor,
+initialisation time, memory requirements and the time spent in each phase.
+"""
+from __future__ import print_function
+
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+from argparse import ArgumentParser
+from datetime import datetime
+
+# Directories relative to this script
+BENCHMARK_DIR = os.path.dirname(os.path.abspath(__file__))
+GENN_DIR = os.path.dirname(BENCHMARK_DIR)
+USERPROJECT_DIR = os.path.join(GENN_DIR, "userproject")
+
+# Metrics compared against baseline and whether larger values are better
+METRICS = {"realTimeFactor": True,
+           "initTime": False,
+           "initSparseTime": False,
+           "neuronUpdateTime": False,
+           "presynapticUpdateTime": False,
+           "postsynapticUpdateTime": False,
+           "synapseDynamicsTime": False,
+           "hostBytes": False,
+           "deviceBytes": False}
+
+# Metrics which are times and should be ignored if they are too short to measure reliably
+TIME_METRICS = set(m for m in METRICS if m.endswith("Time"))
+
+
+def build_model(benchmark, ftype):
+    project_dir = os.path.join(USERPROJECT_DIR, benchmark["project"])
+
+    # Build generate run tool and use it to generate and build model for CPU backend
+    subprocess.check_call(["make"], cwd=project_dir)
+    subprocess.check_call(["./generate_run", "--cpu-only", "--timing", "--build-only",
+                           "--ftype", ftype] + benchmark["args"] + ["benchmark"],
+                          cwd=project_dir)
+
+    # Return directory containing generated code
+    # **NOTE** most user projects generate code in a model subdirectory
+    model_dir = os.path.join(project_dir, "model")
+    return model_dir if os.path.isdir(model_dir) else project_dir
+
+
+def run_benchmark(benchmark, ftype, repeats, work_dir):
+    model_dir = build_model(benchmark, ftype)
+
+    # Run benchmark repeatedly, keeping fastest simulation
+    result = None
+    for r in range(repeats):
+        output = os.path.join(work_dir, "%s_%u.json" % (benchmark["name"], r))
+        subprocess.check_call([os.path.join(BENCHMARK_DIR, "benchmark"),
+                               "--ftype", ftype,
+                               "--duration", str(benchmark["durationMs"]),
+                               model_dir, benchmark["model"], output])
+        with open(output, "r") as output_file:
+            run = json.load(output_file)
+        if result is None or run["realTimeFactor"] > result["realTimeFactor"]:
+            result = run
+    return result
+
+
+def compare(results, baseline, tolerance, min_time):
+    regressions = []
+    print("%-30s %-24s %16s %16s %10s" % ("Benchmark", "Metric", "Baseline", "Result", "Worse by"))
+    for name, result in sorted(results["benchmarks"].items()):
+        if name not in baseline["benchmarks"]:
+            print("%-30s not in baseline" % name)
+            continue
+
+        base = baseline["benchmarks"][name]
+        for metric, larger_better in sorted(METRICS.items()):
+            if metric not in result or metric not in base:
+                continue
+
+            # Skip times too short to be measured reliably
+            if metric in TIME_METRICS and max(result[metric], base[metric]) < min_time:
+                continue
+
+            # Calculate relative change, positive if result is worse
+            if base[metric] == 0:
+                change = 0.0 if result[metric] == 0 else float("inf")
+            else:
+                change = (result[metric] - base[metric]) / base[metric]
+            if larger_better:
+                change = 0.0 - change
+
+            regression = change > tolerance
+            print("%-30s %-24s %16.6g %16.6g %+9.1f%%%s" % (name, metric, base[metric], result[metric],
+                                                           100.0 * change, " REGRESSION" if regression else ""))
+            if regression:
+                regressions.append((name, metric))
+    return regressions
+
+
+if __name__ == "__main__":
+    parser = ArgumentParser(description="Run GeNN benchmark suite")
+    parser.add_argument("--suite", default=os.path.join(BENCHMARK_DIR, "suite.json"),
+                        help="JSON file describing benchmarks")
+    parser.add_argument("--filter", default=".*",
+                        help="Regular expression selecting benchmarks to run")
+    parser.add_argument("--ftype", choices=["float", "double"], default="float",
+                        help="What floating point type to use")
+    parser.add_argument("--repeats", type=int, default=1,
+                        help="Number of times to run each benchmark, keeping the fastest")
+    parser.add_argument("--output", default="benchmark_results.json",
+                        help="JSON file to write results to")
+    parser.add_argument("--baseline",
+                        help="JSON file containing results to compare against")
+    parser.add_argument("--compare-only", action="store_true",
+                        help="Compare existing output file against baseline without running benchmarks")
+    parser.add_argument("--tolerance", type=float, default=0.1,
+                        help="Fraction by which a metric can get worse before it is considered a regression")
+    parser.add_argument("--min-time", type=float, default=0.01,
+                        help="Times (in seconds) shorter than this are not compared")
+    args = parser.parse_args()
+
+    if args.compare_only:
+        with open(args.output, "r") as results_file:
+            results = json.load(results_file)
+    else:
+        with open(args.suite, "r") as suite_file:
+            suite = json.load(suite_file)
+
+        # Make GeNN's tools available to user projects
+        os.environ["PATH"] = os.path.join(GENN_DIR, "bin") + os.pathsep + os.environ["PATH"]
+
+        # Create directory for intermediate results
+        work_dir = os.path.join(BENCHMARK_DIR, "work")
+        if not os.path.isdir(work_dir):
+            os.makedirs(work_dir)
+
+        results = {"date": datetime.now().isoformat(),
+                   "host": platform.node(),
+                   "ftype": args.ftype,
+                   "benchmarks": {}}
+        for benchmark in suite["benchmarks"]:
+            if re.match(args.filter, benchmark["name"]):
+                results["benchmarks"][benchmark["name"]] = run_benchmark(benchmark, args.ftype,
+                                                                         args.repeats, work_dir)
+
+        with open(args.output, "w") as results_file:
+            json.dump(results, results_file, indent=4, sort_keys=True)
+
+    # If a baseline is specified, compare results against it and fail if there are regressions
+    if args.baseline is not None:
+        with open(args.baseline, "r") as baseline_file:
+            baseline = json.load(baseline_file)
+
+        regressions = compare(results, baseline, args.tolerance, args.min_time)
+        if len(regressions) > 0:
+            print("%u performance regressions found" % len(regressions))
+            sys.exit(1)
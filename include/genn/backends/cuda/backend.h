@@ -149,6 +149,7 @@ public:
     virtual void genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
     virtual void genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
     virtual void genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genFreeMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
     virtual void genStepTimeFinalisePreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
 
     virtual void genVariableDefinition(CodeStream &definitions, CodeStream &definitionsInternal, const std::string &type, const std::string &name, VarLocation loc) const override;
@@ -207,9 +208,15 @@ public:
         genCurrentSpikePull(os, ng, true);
     }
     
-    virtual MemAlloc genGlobalDeviceRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free) const override;
-    virtual MemAlloc genPopulationRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner,
-                                      CodeStream &allocations, CodeStream &free, const std::string &name, size_t count) const override;
+    virtual void genArrayStateSave(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, const std::string &count) const override;
+    virtual void genArrayStateLoad(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, const std::string &count) const override;
+    virtual void genScalarStateSave(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genScalarStateLoad(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+
+    virtual MemAlloc genGlobalDeviceRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
+                                        CodeStream &saveState, CodeStream &loadState) const override;
+    virtual MemAlloc genPopulationRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
+                                      CodeStream &saveState, CodeStream &loadState, const std::string &name, size_t count) const override;
     virtual void genTimer(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner,
                           CodeStream &allocations, CodeStream &free, CodeStream &stepTimeFinalise,
                           const std::string &name, bool updateInStepTime) const override;
@@ -235,6 +242,10 @@ public:
     virtual bool isPopulationRNGRequired() const override{ return true; }
     virtual bool isSynRemapRequired() const override{ return true; }
     virtual bool isPostsynapticRemapRequired() const override{ return true; }
+    virtual bool isNeuronSpikeQueueUpdateRequired() const override{ return true; }
+
+    //! Merged structures live in __constant__ memory and are also accessed from host code so keep all fields as members
+    virtual bool isMergedFieldSpecialisationSupported() const override{ return false; }
 
     //! Is automatic copy mode enabled in the preferences?
     virtual bool isAutomaticCopyEnabled() const override { return m_Preferences.automaticCopy; }
@@ -7,6 +7,7 @@
 
 // GeNN includes
 #include "backendExport.h"
+#include "models.h"
 
 // GeNN code generator includes
 #include "code_generator/backendBase.h"
@@ -24,8 +25,33 @@ namespace CodeGenerator
 {
 namespace SingleThreadedCPU
 {
+//! How host arrays should be allocated
+struct AllocationPolicy
+{
+    //! Alignment of arrays in bytes. This must be a power of two and at least the size of a pointer
+    //! or zero in which case arrays are allocated using new with the default alignment
+    size_t alignment = 64;
+
+    //! Arrays of at least this many bytes are aligned and padded to 2MB boundaries and, on Linux,
+    //! advised to use transparent huge pages to reduce TLB pressure. Zero disables huge pages
+    size_t hugePageThreshold = 0;
+
+    //! Should arrays be zeroed as soon as they are allocated? On NUMA systems, this 'first touch'
+    //! places their pages on the memory node of the thread which allocates (and then simulates) the model
+    bool firstTouch = false;
+};
+
 struct Preferences : public PreferencesBase
 {
+    //! Number of postsynaptic neurons processed for all spikes before moving onto
+    //! the next block in the specialised kernel used for dense static pulse synapses
+    unsigned int denseStaticPulseBlockSize = 1024;
+
+    //! Policy used to allocate host arrays
+    AllocationPolicy allocationPolicy;
+
+    //! Policies used instead of allocationPolicy to allocate arrays in specific locations
+    std::map<VarLocation, AllocationPolicy> locationAllocationPolicies;
 };
 
 //--------------------------------------------------------------------------
@@ -34,10 +60,7 @@ struct Preferences : public PreferencesBase
 class BACKEND_EXPORT Backend : public BackendBase
 {
 public:
-    Backend(const std::string &scalarType, const Preferences &preferences)
-    :   BackendBase(scalarType), m_Preferences(preferences)
-    {
-    }
+    Backend(const std::string &scalarType, const Preferences &preferences);
 
     //--------------------------------------------------------------------------
     // CodeGenerator::BackendBase virtuals
@@ -63,6 +86,7 @@ public:
     virtual void genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
     virtual void genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
     virtual void genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
+    virtual void genFreeMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
     virtual void genStepTimeFinalisePreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const override;
 
     virtual void genVariableDefinition(CodeStream &definitions, CodeStream &definitionsInternal, const std::string &type, const std::string &name, VarLocation loc) const override;
@@ -107,9 +131,15 @@ public:
     virtual void genCurrentSpikeLikeEventPush(CodeStream &os, const NeuronGroupInternal &ng) const override;
     virtual void genCurrentSpikeLikeEventPull(CodeStream &os, const NeuronGroupInternal &ng) const override;
 
-    virtual MemAlloc genGlobalDeviceRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free) const override;
+    virtual void genArrayStateSave(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, const std::string &count) const override;
+    virtual void genArrayStateLoad(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, const std::string &count) const override;
+    virtual void genScalarStateSave(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+    virtual void genScalarStateLoad(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const override;
+
+    virtual MemAlloc genGlobalDeviceRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
+                                        CodeStream &saveState, CodeStream &loadState) const override;
     virtual MemAlloc genPopulationRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
-                                      const std::string &name, size_t count) const override;
+                                      CodeStream &saveState, CodeStream &loadState, const std::string &name, size_t count) const override;
     virtual void genTimer(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
                           CodeStream &stepTimeFinalise, const std::string &name, bool updateInStepTime) const override;
 
@@ -134,6 +164,8 @@ public:
     virtual bool isPopulationRNGRequired() const override { return false; }
     virtual bool isSynRemapRequired() const override{ return false; }
     virtual bool isPostsynapticRemapRequired() const override{ return true; }
+    virtual bool isNeuronSpikeQueueUpdateRequired() const override{ return false; }
+    virtual bool isMergedFieldSpecialisationSupported() const override{ return true; }
 
     //! Is automatic copy mode enabled in the preferences?
     virtual bool isAutomaticCopyEnabled() const override { return m_Preferences.automaticCopy; }
@@ -157,10 +189,17 @@ private:
     // Private methods
     //--------------------------------------------------------------------------
     void genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg, const Substitutions &popSubs,
-                              bool trueSpike, PresynapticUpdateGroupMergedHandler wumThreshHandler, PresynapticUpdateGroupMergedHandler wumSimHandler) const;
+                              bool trueSpike, PresynapticUpdateGroupMergedHandler wumThreshHandler, PresynapticUpdateGroupMergedHandler wumSimHandler,
+                              PresynapticUpdateGroupMergedHandler wumProceduralConnectHandler) const;
+
+    void genDenseStaticPulseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                                   const Models::Base::Var &weight) const;
 
     void genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, bool trueSpike) const;
 
+    //! Get policy used to allocate arrays in location
+    const AllocationPolicy &getAllocationPolicy(VarLocation loc) const;
+
   
     //--------------------------------------------------------------------------
     // Members
@@ -171,7 +171,10 @@ public:
     //! Generate platform-specific function to update the state of all synapses
     /*! \param os                           CodeStream to write function to
         \param model                        model to generate code for
-        \param wumThreshHandler             callback to write platform-independent code to update an individual NeuronGroup
+        \param wumThreshHandler             callback to write platform-independent expression testing whether a presynaptic spike-like event
+                                            was emitted by this synapse group's event threshold condition. Only required if
+                                            SynapseGroup::isEventThresholdConditionMaskRequired. "id_pre" variable will be provided
+                                            to callback via Substitutions.
         \param wumSimHandler                callback to write platform-independent code to process presynaptic spikes.
                                             "id_pre", "id_post" and "id_syn" variables; and either "addToInSynDelay" or "addToInSyn" function will be provided
                                             to callback via Substitutions.
@@ -181,6 +184,7 @@ public:
         \param wumProceduralConnectHandler  callback to write platform-indepent code to procedurally generate connectivity
                                             "id_pre" variable and "addSynapse" function will be provided to callback via Substitutions.
                                             callback needs to implement loop over synapses in row, providing "synAddress" variable if INDIVIDUALG
+                                            and "id_kernel" variable calculated from the kernel coordinates passed to "addSynapse" if KERNELG
         \param postLearnHandler             callback to write platform-independent code to process postsynaptic spikes.
                                             "id_pre", "id_post" and "id_syn" variables will be provided to callback via Substitutions.
         \param synapseDynamicsHandler       callback to write platform-independent code to update time-driven synapse dynamics.
@@ -215,6 +219,10 @@ public:
     //! Therefore it's a good place for any global initialisation. This function generates a 'preamble' to this function.
     virtual void genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const = 0;
 
+    //! Free memory is the last function in GeNN generated code called by usercode so it's a good place to release
+    //! any resources acquired in the allocate memory preamble. This function generates a 'preamble' to this function.
+    virtual void genFreeMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const = 0;
+
     //! After all timestep logic is complete
     virtual void genStepTimeFinalisePreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const = 0;
 
@@ -274,13 +282,30 @@ public:
     //! Generate code for pulling spike-like events emitted by a neuron group in the current timestep from the 'device'
     virtual void genCurrentSpikeLikeEventPull(CodeStream &os, const NeuronGroupInternal &ng) const = 0;
 
+    //! Generate code for writing a variable's 'device' state to the checkpoint file stateFile
+    /*! The generated code should write a single section using writeStateSection(stateFile, data, bytes).
+        count is an expression so arrays sized at runtime can be checkpointed */
+    virtual void genArrayStateSave(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, const std::string &count) const = 0;
+
+    //! Generate code for reading a variable's 'device' state from the checkpoint file stateFile
+    /*! The generated code should read a single section using readStateSection(stateFile, data, bytes).
+        count is an expression so arrays sized at runtime can be checkpointed */
+    virtual void genArrayStateLoad(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, const std::string &count) const = 0;
+
+    //! Generate code for writing a scalar's 'device' state to the checkpoint file stateFile
+    virtual void genScalarStateSave(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const = 0;
+
+    //! Generate code for reading a scalar's 'device' state from the checkpoint file stateFile
+    virtual void genScalarStateLoad(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const = 0;
+
     //! Generate a single RNG instance
     /*! On single-threaded platforms this can be a standard RNG like M.T. but, on parallel platforms, it is likely to be a counter-based RNG */
-    virtual MemAlloc genGlobalDeviceRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free) const = 0;
+    virtual MemAlloc genGlobalDeviceRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
+                                        CodeStream &saveState, CodeStream &loadState) const = 0;
 
     //! Generate an RNG with a state per population member
     virtual MemAlloc genPopulationRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
-                                      const std::string &name, size_t count) const = 0;
+                                      CodeStream &saveState, CodeStream &loadState, const std::string &name, size_t count) const = 0;
 
     virtual void genTimer(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
                           CodeStream &stepTimeFinalise, const std::string &name, bool updateInStepTime) const = 0;
@@ -333,6 +358,13 @@ public:
     //! Different backends may implement synaptic plasticity differently. Does this one require a postsynaptic remapping data structure?
     virtual bool isPostsynapticRemapRequired() const = 0;
 
+    //! Different backends may reset spike counts differently. Does this one require merged neuron spike queue update groups
+    //! or does it reset spike counts within neuron update instead?
+    virtual bool isNeuronSpikeQueueUpdateRequired() const = 0;
+
+    //! Can merged group fields which are homogeneous across all groups be specialised as static constexpr struct members?
+    virtual bool isMergedFieldSpecialisationSupported() const = 0;
+
     //! Is automatic copy mode enabled in the preferences?
     virtual bool isAutomaticCopyEnabled() const = 0;
 
@@ -379,6 +411,26 @@ public:
         return genVariableAllocation(allocations, type, name, loc, count);
     }
 
+    //! Helper function to generate matching save and load code for a variable's checkpointed state
+    void genArrayStateSaveLoad(CodeStream &save, CodeStream &load, const std::string &type, const std::string &name, VarLocation loc, const std::string &count) const
+    {
+        genArrayStateSave(save, type, name, loc, count);
+        genArrayStateLoad(load, type, name, loc, count);
+    }
+
+    //! Helper function to generate matching save and load code for a fixed-size variable's checkpointed state
+    void genArrayStateSaveLoad(CodeStream &save, CodeStream &load, const std::string &type, const std::string &name, VarLocation loc, size_t count) const
+    {
+        genArrayStateSaveLoad(save, load, type, name, loc, std::to_string(count));
+    }
+
+    //! Helper function to generate matching save and load code for a scalar's checkpointed state
+    void genScalarStateSaveLoad(CodeStream &save, CodeStream &load, const std::string &type, const std::string &name, VarLocation loc) const
+    {
+        genScalarStateSave(save, type, name, loc);
+        genScalarStateLoad(load, type, name, loc);
+    }
+
     //! Helper function to generate matching definition and declaration code for a scalar variable
     void genScalar(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, const std::string &type, const std::string &name, VarLocation loc) const
     {
@@ -398,6 +450,13 @@ protected:
         m_TypeBytes.emplace(type, size);
     }
 
+    //! Generate poissonDist<suffix> and binomialDist<suffix> functions used to implement gennrand_poisson and
+    //! gennrand_binomial. These take a random number generator declared as rngParam and use uniformExpr to draw
+    //! standard uniform samples of the given type. Large means use constant-time transformed rejection methods
+    //! (PTRS for Poisson and BTRS for binomial) and small means fall back to multiplication or inversion.
+    void genDiscreteDistributions(CodeStream &os, const std::string &qualifier, const std::string &suffix,
+                                  const std::string &type, const std::string &rngParam, const std::string &uniformExpr) const;
+
 private:
     //--------------------------------------------------------------------------
     // Members
@@ -47,6 +47,9 @@ public:
     //! Map of original extra global param names to their locations within merged structures
     typedef std::map<std::string, std::unordered_multimap<std::string, MergedEGP>> MergedEGPMap;
 
+    //! Map of names of arrays allocated separately for each batched model instance to number of elements per instance
+    typedef std::unordered_map<std::string, size_t> BatchedArrayMap;
+
     //------------------------------------------------------------------------
     // Public API
     //------------------------------------------------------------------------
@@ -71,6 +74,52 @@ public:
         m_MergedGroupSizes[mergedGroupType].emplace(mergedGroupIndex, sizeBytes);
     }
 
+    //! Get number of structures in array of merged structures i.e. number of groups multiplied by batch size if group is batched
+    size_t getMergedGroupNumStructs(const std::string &mergedGroupType, size_t mergedGroupIndex) const
+    {
+        return m_MergedGroupNumStructs.at(mergedGroupType).at(mergedGroupIndex);
+    }
+
+    void addMergedGroupNumStructs(const std::string &mergedGroupType, size_t mergedGroupIndex, size_t numStructs)
+    {
+        m_MergedGroupNumStructs[mergedGroupType].emplace(mergedGroupIndex, numStructs);
+    }
+
+    //! Record number of bytes saved by specialising fields homogeneous across merged group as compile-time constants
+    void addSpecialisedFieldBytes(size_t sizeBytes){ m_SpecialisedFieldBytes += sizeBytes; }
+
+    //! Get total size of all arrays of merged structures
+    size_t getTotalMergedGroupBytes() const
+    {
+        size_t total = 0;
+        for(const auto &t : m_MergedGroupSizes) {
+            for(const auto &g : t.second) {
+                total += g.second;
+            }
+        }
+        return total;
+    }
+
+    //! Get total number of bytes saved by specialising fields homogeneous across merged group as compile-time constants
+    size_t getTotalSpecialisedFieldBytes() const{ return m_SpecialisedFieldBytes; }
+
+    //! Set number of model instances and which arrays are allocated separately for each one
+    void setBatch(unsigned int batchSize, const BatchedArrayMap &batchedArrays)
+    {
+        m_BatchSize = batchSize;
+        m_BatchedArrays = batchedArrays;
+    }
+
+    //! Get number of model instances
+    unsigned int getBatchSize() const{ return m_BatchSize; }
+
+    //! Get number of elements in each instance's copy of array or 0 if array is shared between instances
+    size_t getBatchedArrayStride(const std::string &name) const
+    {
+        const auto a = m_BatchedArrays.find(name);
+        return (a == m_BatchedArrays.cend()) ? 0 : a->second;
+    }
+
 private:
     //------------------------------------------------------------------------
     // Members
@@ -78,6 +127,14 @@ private:
     MergedEGPMap m_MergedEGPs;
 
     std::unordered_map<std::string, std::map<size_t, size_t>> m_MergedGroupSizes;
+
+    std::unordered_map<std::string, std::map<size_t, size_t>> m_MergedGroupNumStructs;
+
+    size_t m_SpecialisedFieldBytes = 0;
+
+    unsigned int m_BatchSize = 1;
+
+    BatchedArrayMap m_BatchedArrays;
 };
 
 //--------------------------------------------------------------------------
@@ -121,6 +178,15 @@ inline size_t padSize(size_t size, size_t blockSize)
     return ceilDivide(size, blockSize) * blockSize;
 }
 
+//! Get type used to store variable of specified type in specified storage format
+std::string getVarStorageType(const std::string &type, VarStorage storage);
+
+//! Get expression which widens value read from variable stored in specified format to scalar
+std::string getVarStorageLoad(const std::string &value, VarStorage storage, double scale, const std::string &precision);
+
+//! Get expression which narrows scalar value so it can be written to variable stored in specified format
+std::string getVarStorageStore(const std::string &value, VarStorage storage, double scale, const std::string &precision);
+
 template<typename T>
 void genMergedGroupPush(CodeStream &os, const std::vector<T> &groups, const MergedStructData &mergedStructData,
                         const std::string &suffix, const BackendBase &backend, BackendBase::MemorySpaces &memorySpaces)
@@ -134,7 +200,7 @@ void genMergedGroupPush(CodeStream &os, const std::vector<T> &groups, const Merg
     for(const auto &g : groups) {
         // Declare static array to hold merged neuron groups
         const size_t idx = g.getIndex();
-        const size_t numGroups = g.getGroups().size();
+        const size_t numGroups = mergedStructData.getMergedGroupNumStructs(suffix, idx);
 
         // Get size of group in bytes
         const size_t groupBytes = mergedStructData.getMergedGroupSize(suffix, idx);
@@ -72,18 +72,23 @@ protected:
                            });
     }
 
+    //! Helper to test whether parameter is referenced in any of the code strings
+    static bool isParamReferenced(std::initializer_list<std::string> codeStrings, const std::string &paramName)
+    {
+        return std::any_of(codeStrings.begin(), codeStrings.end(),
+                           [&paramName](const std::string &c)
+                           {
+                               return (c.find("$(" + paramName + ")") != std::string::npos);
+                           });
+    }
+
     //! Helper to test whether parameter values are heterogeneous within merged group
     template<typename P>
     bool isParamValueHeterogeneous(std::initializer_list<std::string> codeStrings, const std::string &paramName,
                                    size_t index, P getParamValuesFn) const
     {
         // If none of the code strings reference the parameter, return false
-        if(std::none_of(codeStrings.begin(), codeStrings.end(),
-                        [&paramName](const std::string &c) 
-                        { 
-                            return (c.find("$(" + paramName + ")") != std::string::npos); 
-                        }))
-        {
+        if(!isParamReferenced(codeStrings, paramName)) {
             return false;
         }
         // Otherwise check if values are heterogeneous
@@ -230,13 +235,8 @@ protected:
                                         const std::string &paramName, size_t childIndex, size_t paramIndex,
                                         const std::vector<std::vector<T>> &sortedGroupChildren, G getParamValuesFn) const
     {
-        // If none of the code strings reference the parameter
-        if(std::any_of(codeStrings.begin(), codeStrings.end(),
-                        [&paramName](const std::string &c)
-                        {
-                            return (c.find("$(" + paramName + ")") != std::string::npos);
-                        }))
-        {
+        // If any of the code strings reference the parameter
+        if(isParamReferenced(codeStrings, paramName)) {
             // Get value of archetype derived parameter
             const double firstValue = getParamValuesFn(sortedGroupChildren[0][childIndex]).at(paramIndex);
 
@@ -257,16 +257,23 @@ protected:
                                      const Snippet::Base::StringVec &paramNames, size_t childIndex,
                                      const std::string &prefix, 
                                      H isChildParamHeterogeneousFn, V getValueFn) const
+    {
+        addHeterogeneousChildParams<T>(gen, paramNames, childIndex, prefix, isChildParamHeterogeneousFn, getValueFn,
+                                       [](size_t, size_t, size_t){ return std::string(); });
+    }
+
+    template<typename T = NeuronGroupMergedBase, typename H, typename V, typename D>
+    void addHeterogeneousChildParams(MergedStructGenerator<NeuronGroupMergedBase> &gen, 
+                                     const Snippet::Base::StringVec &paramNames, size_t childIndex,
+                                     const std::string &prefix, 
+                                     H isChildParamHeterogeneousFn, V getValueFn, D getDynamicNameFn) const
     {
         // Loop through parameters
         for(size_t p = 0; p < paramNames.size(); p++) {
             // If parameter is heterogeneous
             if((static_cast<const T *>(this)->*isChildParamHeterogeneousFn)(childIndex, p)) {
-                gen.addScalarField(paramNames[p] + prefix + std::to_string(childIndex),
-                                   [childIndex, p, getValueFn](const NeuronGroupInternal &, size_t groupIndex)
-                                   {
-                                       return Utils::writePreciseString(getValueFn(groupIndex, childIndex, p));
-                                   });
+                addChildParamField(gen, paramNames[p] + prefix + std::to_string(childIndex), childIndex, p,
+                                   getValueFn, getDynamicNameFn);
             }
         }
     }
@@ -275,20 +282,51 @@ protected:
     void addHeterogeneousChildDerivedParams(MergedStructGenerator<NeuronGroupMergedBase> &gen,
                                             const Snippet::Base::DerivedParamVec &derivedParams, size_t childIndex,
                                             const std::string &prefix, H isChildDerivedParamHeterogeneousFn, V getValueFn) const
+    {
+        addHeterogeneousChildDerivedParams<T>(gen, derivedParams, childIndex, prefix, isChildDerivedParamHeterogeneousFn, getValueFn,
+                                              [](size_t, size_t, size_t){ return std::string(); });
+    }
+
+    template<typename T = NeuronGroupMergedBase, typename H, typename V, typename D>
+    void addHeterogeneousChildDerivedParams(MergedStructGenerator<NeuronGroupMergedBase> &gen,
+                                            const Snippet::Base::DerivedParamVec &derivedParams, size_t childIndex,
+                                            const std::string &prefix, H isChildDerivedParamHeterogeneousFn, V getValueFn,
+                                            D getDynamicNameFn) const
     {
         // Loop through derived parameters
         for(size_t p = 0; p < derivedParams.size(); p++) {
             // If parameter is heterogeneous
             if((static_cast<const T *>(this)->*isChildDerivedParamHeterogeneousFn)(childIndex, p)) {
-                gen.addScalarField(derivedParams[p].name + prefix + std::to_string(childIndex),
-                                   [childIndex, p, getValueFn](const NeuronGroupInternal &, size_t groupIndex)
-                                   {
-                                       return Utils::writePreciseString(getValueFn(groupIndex, childIndex, p));
-                                   });
+                addChildParamField(gen, derivedParams[p].name + prefix + std::to_string(childIndex), childIndex, p,
+                                   getValueFn, getDynamicNameFn);
             }
         }
     }
 
+    template<typename V, typename D>
+    void addChildParamField(MergedStructGenerator<NeuronGroupMergedBase> &gen, const std::string &name,
+                            size_t childIndex, size_t paramIndex, V getValueFn, D getDynamicNameFn) const
+    {
+        // If parameter is dynamic, add field copied from the runner variable it is set through
+        typedef MergedStructGenerator<NeuronGroupMergedBase>::FieldType FieldType;
+        if(!getDynamicNameFn(0, childIndex, paramIndex).empty()) {
+            gen.addField("scalar", name,
+                         [childIndex, paramIndex, getDynamicNameFn](const NeuronGroupInternal &, size_t groupIndex)
+                         {
+                             return getDynamicNameFn(groupIndex, childIndex, paramIndex);
+                         },
+                         FieldType::ScalarEGP);
+        }
+        // Otherwise, add field set from parameter value
+        else {
+            gen.addScalarField(name,
+                               [childIndex, paramIndex, getValueFn](const NeuronGroupInternal &, size_t groupIndex)
+                               {
+                                   return Utils::writePreciseString(getValueFn(groupIndex, childIndex, paramIndex));
+                               });
+        }
+    }
+
     template<typename T = NeuronGroupMergedBase, typename H, typename V>
     void addHeterogeneousChildVarInitParams(MergedStructGenerator<NeuronGroupMergedBase> &gen,
                                             const Snippet::Base::StringVec &paramNames, size_t childIndex,
@@ -379,6 +417,10 @@ public:
     //! Get the expression to calculate the queue offset for accessing state of variables in previous timestep
     std::string getPrevQueueOffset() const;
 
+    //! Generate code to reset spike counts of current timestep
+    /*! This allows backends which don't require NeuronSpikeQueueUpdateGroupMerged to fuse spike count reset into neuron update */
+    void genMergedGroupSpikeCountReset(CodeStream &os) const;
+
     //! Should the incoming synapse weight update model parameter be implemented heterogeneously?
     bool isInSynWUMParamHeterogeneous(size_t childIndex, size_t paramIndex) const;
 
@@ -551,8 +593,15 @@ public:
     //! Postsynaptic neuron state variables, taking into account back propagation delay
     std::string getPostsynapticBackPropDelaySlot() const;
 
+    //! Get the expression to calculate the dendritic delay slot, offset by specified number of timesteps
+    std::string getDendriticDelaySlot(const std::string &offset = "") const;
+
     std::string getDendriticDelayOffset(const std::string &offset = "") const;
 
+    //! Get the expression to calculate the index into kernel weights from
+    //! the kernel coordinates passed to $(addSynapse) as $(1), $(2), ...
+    std::string getKernelIndex() const;
+
     //! Should the weight update model parameter be implemented heterogeneously?
     bool isWUParamHeterogeneous(size_t paramIndex) const;
 
@@ -586,6 +635,9 @@ public:
     //! Is postsynaptic neuron derived parameter heterogeneous
     bool isTrgNeuronDerivedParamHeterogeneous(size_t paramIndex) const;
 
+    //! Do groups test different bits of the presynaptic spike event condition mask?
+    bool isEventThresholdConditionBitHeterogeneous() const;
+
 protected:
     //----------------------------------------------------------------------------
     // Enumerations
@@ -627,7 +679,8 @@ private:
     void addTrgPointerField(MergedStructGenerator<SynapseGroupMergedBase> &gen,
                             const std::string &type, const std::string &name, const std::string &prefix) const;
     void addWeightSharingPointerField(MergedStructGenerator<SynapseGroupMergedBase> &gen,
-                                      const std::string &type, const std::string &name, const std::string &prefix) const;
+                                      const std::string &type, const std::string &name, const std::string &prefix,
+                                      MergedStructGenerator<SynapseGroupMergedBase>::FieldType fieldType = MergedStructGenerator<SynapseGroupMergedBase>::FieldType::Standard) const;
 };
 
 //----------------------------------------------------------------------------
@@ -89,18 +89,32 @@ public:
     template<typename G, typename H>
     void addHeterogeneousParams(const Snippet::Base::StringVec &paramNames, const std::string &suffix,
                                 G getParamValues, H isHeterogeneous)
+    {
+        addHeterogeneousParams(paramNames, suffix, getParamValues, isHeterogeneous,
+                               [](const typename T::GroupInternal &, size_t){ return std::string(); });
+    }
+
+    template<typename G, typename H, typename D>
+    void addHeterogeneousParams(const Snippet::Base::StringVec &paramNames, const std::string &suffix,
+                                G getParamValues, H isHeterogeneous, D getDynamicParamName)
     {
         // Loop through params
         for(size_t p = 0; p < paramNames.size(); p++) {
             // If parameters is heterogeneous
             if((getMergedGroup().*isHeterogeneous)(p)) {
-                // Add field
-                addScalarField(paramNames[p] + suffix,
-                               [p, getParamValues](const typename T::GroupInternal &g, size_t)
-                               {
-                                   const auto &values = getParamValues(g);
-                                   return Utils::writePreciseString(values.at(p));
-                               });
+                // If parameter is dynamic, add field set from runtime variable
+                if(!getDynamicParamName(getMergedGroup().getArchetype(), p).empty()) {
+                    addDynamicParamField(paramNames[p] + suffix, p, getDynamicParamName);
+                }
+                // Otherwise, add field set from parameter value
+                else {
+                    addScalarField(paramNames[p] + suffix,
+                                   [p, getParamValues](const typename T::GroupInternal &g, size_t)
+                                   {
+                                       const auto &values = getParamValues(g);
+                                       return Utils::writePreciseString(values.at(p));
+                                   });
+                }
             }
         }
     }
@@ -108,22 +122,48 @@ public:
     template<typename G, typename H>
     void addHeterogeneousDerivedParams(const Snippet::Base::DerivedParamVec &derivedParams, const std::string &suffix,
                                        G getDerivedParamValues, H isHeterogeneous)
+    {
+        addHeterogeneousDerivedParams(derivedParams, suffix, getDerivedParamValues, isHeterogeneous,
+                                      [](const typename T::GroupInternal &, size_t){ return std::string(); });
+    }
+
+    template<typename G, typename H, typename D>
+    void addHeterogeneousDerivedParams(const Snippet::Base::DerivedParamVec &derivedParams, const std::string &suffix,
+                                       G getDerivedParamValues, H isHeterogeneous, D getDynamicParamName)
     { 
         // Loop through derived params
         for(size_t p = 0; p < derivedParams.size(); p++) {
             // If parameters isn't homogeneous
             if((getMergedGroup().*isHeterogeneous)(p)) {
-                // Add field
-                addScalarField(derivedParams[p].name + suffix,
-                               [p, getDerivedParamValues](const typename T::GroupInternal &g, size_t)
-                               {
-                                   const auto &values = getDerivedParamValues(g);
-                                   return Utils::writePreciseString(values.at(p));
-                               });
+                // If derived parameter is dynamic, add field set from runtime variable
+                if(!getDynamicParamName(getMergedGroup().getArchetype(), p).empty()) {
+                    addDynamicParamField(derivedParams[p].name + suffix, p, getDynamicParamName);
+                }
+                // Otherwise, add field set from derived parameter value
+                else {
+                    addScalarField(derivedParams[p].name + suffix,
+                                   [p, getDerivedParamValues](const typename T::GroupInternal &g, size_t)
+                                   {
+                                       const auto &values = getDerivedParamValues(g);
+                                       return Utils::writePreciseString(values.at(p));
+                                   });
+                }
             }
         }
     }
 
+    //! Add field for dynamic parameter, copied from the runner variable it is set through in the same way as a scalar EGP
+    template<typename D>
+    void addDynamicParamField(const std::string &name, size_t paramIndex, D getDynamicParamName)
+    {
+        addField("scalar", name,
+                 [paramIndex, getDynamicParamName](const typename T::GroupInternal &g, size_t)
+                 {
+                     return getDynamicParamName(g, paramIndex);
+                 },
+                 FieldType::ScalarEGP);
+    }
+
     template<typename V, typename H>
     void addHeterogeneousVarInitParams(const Models::Base::VarVec &vars, V getVarInitialisers, H isHeterogeneous)
     {
@@ -169,13 +209,29 @@ public:
     void generate(const BackendBase &backend, CodeStream &definitionsInternal, 
                   CodeStream &definitionsInternalFunc, CodeStream &definitionsInternalVar, 
                   CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc,
-                  MergedStructData &mergedStructData, const std::string &name, bool host = false) const
+                  MergedStructData &mergedStructData, const std::string &name, bool host = false, bool batched = false) const
     {
         const size_t mergedGroupIndex = getMergedGroup().getIndex();
 
-        // Make a copy of fields and sort so largest come first. This should mean that due
+        // If merged group is batched, there is a structure for each instance of each group, with instances of the same group adjacent
+        const size_t batchSize = batched ? mergedStructData.getBatchSize() : 1;
+        const size_t numStructs = getMergedGroup().getGroups().size() * batchSize;
+
+        // Split fields into those which have the same value in all groups and can be
+        // specialised as compile-time constants and those which need storing in structure
+        std::vector<Field> sortedFields;
+        std::vector<Field> specialisedFields;
+        for(const auto &f : m_Fields) {
+            if(backend.isMergedFieldSpecialisationSupported() && isFieldHomogeneous(f)) {
+                specialisedFields.push_back(f);
+            }
+            else {
+                sortedFields.push_back(f);
+            }
+        }
+
+        // Sort stored fields so largest come first. This should mean that due
         // to structure packing rules, significant memory is saved and estimate is more precise
-        auto sortedFields = m_Fields;
         std::sort(sortedFields.begin(), sortedFields.end(),
                   [&backend](const Field &a, const Field &b)
                   {
@@ -204,41 +260,81 @@ public:
                     definitionsInternalFunc << "EXPORT_FUNC void pushMerged" << name << mergedGroupIndex << std::get<1>(f) << "ToDevice(unsigned int idx, " << std::get<0>(f) << " value);" << std::endl;
                 }
             }
+
+            // Declare specialised fields as static constants so they can still be accessed as group.XXX
+            size_t specialisedSize = 0;
+            for(const auto &f : specialisedFields) {
+                const auto &archetype = getMergedGroup().getGroups().front();
+                definitionsInternal << "static constexpr " << std::get<0>(f) << " " << std::get<1>(f) << " = " << std::get<2>(f)(archetype, 0) << ";" << std::endl;
+                specialisedSize += backend.getSize(std::get<0>(f));
+            }
             definitionsInternal << std::endl;
+
+            // Record memory saved
+            if(!specialisedFields.empty()) {
+                mergedStructData.addSpecialisedFieldBytes(specialisedSize * numStructs);
+            }
         }
 
         definitionsInternal << ";" << std::endl;
 
         // Add total size of array of merged structures to merged struct data
         // **NOTE** to match standard struct packing rules we pad to a multiple of the largest field size
-        const size_t arraySize = padSize(structSize, largestFieldSize) * getMergedGroup().getGroups().size();
+        // **NOTE** empty structures still occupy one byte
+        const size_t paddedStructSize = sortedFields.empty() ? 1 : padSize(structSize, largestFieldSize);
+        const size_t arraySize = paddedStructSize * numStructs;
         mergedStructData.addMergedGroupSize(name, mergedGroupIndex, arraySize);
+        mergedStructData.addMergedGroupNumStructs(name, mergedGroupIndex, numStructs);
+
+        // Define specialised fields so they can be odr-used e.g. passed by reference to std::min
+        // **NOTE** generated code is built as C++11 where static constexpr members aren't implicitly inline
+        // **NOTE** runner variables are declared with C linkage but class members need C++ linkage
+        if(!specialisedFields.empty()) {
+            runnerVarDecl << "extern \"C++\"";
+            {
+                CodeStream::Scope b(runnerVarDecl);
+                for(const auto &f : specialisedFields) {
+                    runnerVarDecl << "constexpr " << std::get<0>(f) << " Merged" << name << "Group" << mergedGroupIndex << "::" << std::get<1>(f) << ";" << std::endl;
+                }
+            }
+        }
 
         // Declare array of these structs containing individual neuron group pointers etc
-        runnerVarDecl << "Merged" << name << "Group" << mergedGroupIndex << " merged" << name << "Group" << mergedGroupIndex << "[" << getMergedGroup().getGroups().size() << "];" << std::endl;
+        runnerVarDecl << "Merged" << name << "Group" << mergedGroupIndex << " merged" << name << "Group" << mergedGroupIndex << "[" << numStructs << "];" << std::endl;
 
         for(size_t groupIndex = 0; groupIndex < getMergedGroup().getGroups().size(); groupIndex++) {
             const auto &g = getMergedGroup().getGroups()[groupIndex];
 
-            // Set all fields in array of structs
-            runnerMergedStructAlloc << "merged" << name << "Group" << mergedGroupIndex << "[" << groupIndex << "] = {";
-            for(const auto &f : sortedFields) {
-                const std::string fieldInitVal = std::get<2>(f)(g, groupIndex);
-                runnerMergedStructAlloc << fieldInitVal << ", ";
-
-                // If field is an EGP, add record to merged EGPS
-                if(std::get<3>(f) != FieldType::Standard) {
-                    mergedStructData.addMergedEGP(fieldInitVal, name, mergedGroupIndex, groupIndex,
-                                                  std::get<0>(f), std::get<1>(f));
+            for(size_t b = 0; b < batchSize; b++) {
+                const size_t structIndex = (groupIndex * batchSize) + b;
+
+                // Set all fields in array of structs
+                runnerMergedStructAlloc << "merged" << name << "Group" << mergedGroupIndex << "[" << structIndex << "] = {";
+                for(const auto &f : sortedFields) {
+                    const std::string fieldInitVal = std::get<2>(f)(g, groupIndex);
+
+                    // If field points to an array with a copy for each instance, offset pointer to this instance's copy
+                    const size_t batchStride = (b == 0 || std::get<3>(f) != FieldType::Standard) ? 0 : mergedStructData.getBatchedArrayStride(fieldInitVal);
+                    if(batchStride > 0) {
+                        runnerMergedStructAlloc << fieldInitVal << " + " << (b * batchStride) << ", ";
+                    }
+                    else {
+                        runnerMergedStructAlloc << fieldInitVal << ", ";
+                    }
+
+                    // If field is an EGP, add record to merged EGPS
+                    if(std::get<3>(f) != FieldType::Standard) {
+                        mergedStructData.addMergedEGP(fieldInitVal, name, mergedGroupIndex, structIndex,
+                                                      std::get<0>(f), std::get<1>(f));
+                    }
                 }
+                runnerMergedStructAlloc << "};" << std::endl;
             }
-            runnerMergedStructAlloc << "};" << std::endl;
-
         }
 
         // If this is a host merged struct, export the variable
         if(host) {
-            definitionsInternalVar << "EXPORT_VAR Merged" << name << "Group" << mergedGroupIndex << " merged" << name << "Group" << mergedGroupIndex << "[" << getMergedGroup().getGroups().size() << "]; " << std::endl;
+            definitionsInternalVar << "EXPORT_VAR Merged" << name << "Group" << mergedGroupIndex << " merged" << name << "Group" << mergedGroupIndex << "[" << numStructs << "]; " << std::endl;
         }
         // Otherwise
         else {
@@ -262,6 +358,28 @@ private:
     //------------------------------------------------------------------------
     typedef std::tuple<std::string, std::string, GetFieldValueFunc, FieldType> Field;
 
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    //! Does field have the same, compile-time constant, value in all groups?
+    bool isFieldHomogeneous(const Field &f) const
+    {
+        // Pointers and EGPs are set at runtime so can't be specialised
+        if(std::get<3>(f) != FieldType::Standard || Utils::isTypePointer(std::get<0>(f))) {
+            return false;
+        }
+
+        // Check whether value of field matches that of archetype in all groups
+        const auto &groups = getMergedGroup().getGroups();
+        const std::string archetypeValue = std::get<2>(f)(groups.front(), 0);
+        for(size_t groupIndex = 1; groupIndex < groups.size(); groupIndex++) {
+            if(std::get<2>(f)(groups[groupIndex], groupIndex) != archetypeValue) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     //------------------------------------------------------------------------
     // Members
     //------------------------------------------------------------------------
@@ -87,14 +87,7 @@ class PoissonExp : public Base
     DECLARE_MODEL(PoissonExp, 3, 1);
 
     SET_INJECTION_CODE(
-        "scalar p = 1.0f;\n"
-        "unsigned int numSpikes = 0;\n"
-        "do\n"
-        "{\n"
-        "    numSpikes++;\n"
-        "    p *= $(gennrand_uniform);\n"
-        "} while (p > $(ExpMinusLambda));\n"
-        "$(current) += $(Init) * (scalar)(numSpikes - 1);\n"
+        "$(current) += $(Init) * (scalar)$(gennrand_poisson, $(Lambda));\n"
         "$(injectCurrent, $(current));\n"
         "$(current) *= $(ExpDecay);\n");
 
@@ -103,6 +96,6 @@ class PoissonExp : public Base
     SET_DERIVED_PARAMS({
         {"ExpDecay", [](const std::vector<double> &pars, double dt){ return std::exp(-dt / pars[1]); }},
         {"Init", [](const std::vector<double> &pars, double dt){ return pars[0] * (1.0 - std::exp(-dt / pars[1])) * (pars[1] / dt); }},
-        {"ExpMinusLambda", [](const std::vector<double> &pars, double dt){ return std::exp(-(pars[2] / 1000.0) * dt); }}});
+        {"Lambda", [](const std::vector<double> &pars, double dt){ return (pars[2] / 1000.0) * dt; }}});
 };
 } // CurrentSourceModels
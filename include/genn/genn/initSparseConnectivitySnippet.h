@@ -26,6 +26,8 @@
 #define SET_MAX_ROW_LENGTH(MAX_ROW_LENGTH) virtual CalcMaxLengthFunc getCalcMaxRowLengthFunc() const override{ return [](unsigned int, unsigned int, const std::vector<double> &){ return MAX_ROW_LENGTH; }; }
 #define SET_MAX_COL_LENGTH(MAX_COL_LENGTH) virtual CalcMaxLengthFunc getCalcMaxColLengthFunc() const override{ return [](unsigned int, unsigned int, const std::vector<double> &){ return MAX_COL_LENGTH; }; }
 
+#define SET_CALC_KERNEL_SIZE_FUNC(...) virtual CalcKernelSizeFunc getCalcKernelSizeFunc() const override{ return __VA_ARGS__; }
+
 //----------------------------------------------------------------------------
 // InitSparseConnectivitySnippet::Base
 //----------------------------------------------------------------------------
@@ -39,6 +41,7 @@ public:
     // Typedefines
     //----------------------------------------------------------------------------
     typedef std::function<unsigned int(unsigned int, unsigned int, const std::vector<double> &)> CalcMaxLengthFunc;
+    typedef std::function<std::vector<unsigned int>(const std::vector<double> &)> CalcKernelSizeFunc;
     
     //----------------------------------------------------------------------------
     // Declared virtuals
@@ -54,6 +57,11 @@ public:
     //! Get function to calculate the maximum column length of this connector based on the parameters and the size of the pre and postsynaptic population
     virtual CalcMaxLengthFunc getCalcMaxColLengthFunc() const{ return CalcMaxLengthFunc(); }
 
+    //! Get function to calculate the size of the kernel shared between synapses based on the parameters
+    /*! If this is provided, row build code passes the coordinates of each synapse's weight
+        within the kernel to $(addSynapse) after the postsynaptic index */
+    virtual CalcKernelSizeFunc getCalcKernelSizeFunc() const{ return CalcKernelSizeFunc(); }
+
     //------------------------------------------------------------------------
     // Public methods
     //------------------------------------------------------------------------
@@ -339,4 +347,86 @@ public:
             return binomialInverseCDF(quantile, (unsigned int)pars[0], (double)numPre / ((double)numPre * (double)numPost));
         });
 };
+
+//----------------------------------------------------------------------------
+// InitSparseConnectivitySnippet::Conv2D
+//----------------------------------------------------------------------------
+//! Initialises convolutional connectivity between two layers of neurons stored in row-major,
+//! channel-last order i.e. (row, column, channel). The postsynaptic targets of each presynaptic
+//! neuron are calculated from the layer geometry and each synapse is associated with the
+//! element (kernel row, kernel column, input channel, output channel) of a shared kernel.
+/*! This snippet takes 12 parameters:
+    - \c conv_kh - height of convolution kernel
+    - \c conv_kw - width of convolution kernel
+    - \c conv_sh - vertical stride of convolution
+    - \c conv_sw - horizontal stride of convolution
+    - \c conv_padh - padding added to top of input
+    - \c conv_padw - padding added to left of input
+    - \c conv_ih - height of input layer
+    - \c conv_iw - width of input layer
+    - \c conv_ic - number of input channels
+    - \c conv_oh - height of output layer
+    - \c conv_ow - width of output layer
+    - \c conv_oc - number of output channels
+
+    When used with SynapseMatrixType::PROCEDURAL_KERNELG, only the kernel is stored and
+    each row is regenerated by iterating over the kernel footprint of the presynaptic neuron.*/
+class Conv2D : public Base
+{
+public:
+    DECLARE_SNIPPET(InitSparseConnectivitySnippet::Conv2D, 12);
+
+    SET_PARAM_NAMES({"conv_kh", "conv_kw", "conv_sh", "conv_sw", "conv_padh", "conv_padw",
+                     "conv_ih", "conv_iw", "conv_ic", "conv_oh", "conv_ow", "conv_oc"});
+
+    // **NOTE** the first (inclusive) and last (exclusive) output rows and columns
+    // whose receptive fields include this presynaptic neuron are calculated up front
+    SET_ROW_BUILD_STATE_VARS({{"inRow", "int", "((int)$(id_pre) / (int)$(conv_ic)) / (int)$(conv_iw)"},
+                              {"inCol", "int", "((int)$(id_pre) / (int)$(conv_ic)) % (int)$(conv_iw)"},
+                              {"inChan", "int", "(int)$(id_pre) % (int)$(conv_ic)"},
+                              {"outRow", "int", "((inRow + (int)$(conv_padh) - (int)$(conv_kh)) >= 0) ? ((inRow + (int)$(conv_padh) - (int)$(conv_kh) + (int)$(conv_sh)) / (int)$(conv_sh)) : 0"},
+                              {"maxOutRow", "int", "(((inRow + (int)$(conv_padh)) / (int)$(conv_sh)) < (int)$(conv_oh)) ? (((inRow + (int)$(conv_padh)) / (int)$(conv_sh)) + 1) : (int)$(conv_oh)"},
+                              {"minOutCol", "int", "((inCol + (int)$(conv_padw) - (int)$(conv_kw)) >= 0) ? ((inCol + (int)$(conv_padw) - (int)$(conv_kw) + (int)$(conv_sw)) / (int)$(conv_sw)) : 0"},
+                              {"maxOutCol", "int", "(((inCol + (int)$(conv_padw)) / (int)$(conv_sw)) < (int)$(conv_ow)) ? (((inCol + (int)$(conv_padw)) / (int)$(conv_sw)) + 1) : (int)$(conv_ow)"}});
+
+    SET_ROW_BUILD_CODE(
+        "if(outRow >= maxOutRow) {\n"
+        "   $(endRow);\n"
+        "}\n"
+        "const int kernRow = inRow + (int)$(conv_padh) - (outRow * (int)$(conv_sh));\n"
+        "for(int outCol = minOutCol; outCol < maxOutCol; outCol++) {\n"
+        "    const int kernCol = inCol + (int)$(conv_padw) - (outCol * (int)$(conv_sw));\n"
+        "    const int idPostStart = ((outRow * (int)$(conv_ow)) + outCol) * (int)$(conv_oc);\n"
+        "    for(int outChan = 0; outChan < (int)$(conv_oc); outChan++) {\n"
+        "        $(addSynapse, idPostStart + outChan, kernRow, kernCol, inChan, outChan);\n"
+        "    }\n"
+        "}\n"
+        "outRow++;\n");
+
+    SET_CALC_MAX_ROW_LENGTH_FUNC(
+        [](unsigned int, unsigned int, const std::vector<double> &pars)
+        {
+            // Each presynaptic neuron is within the receptive field of at most
+            // ceil(kh / sh) * ceil(kw / sw) output pixels, each with oc channels
+            const unsigned int kh = (unsigned int)pars[0];
+            const unsigned int kw = (unsigned int)pars[1];
+            const unsigned int sh = (unsigned int)pars[2];
+            const unsigned int sw = (unsigned int)pars[3];
+            return ((kh + sh - 1) / sh) * ((kw + sw - 1) / sw) * (unsigned int)pars[11];
+        });
+
+    SET_CALC_MAX_COL_LENGTH_FUNC(
+        [](unsigned int, unsigned int, const std::vector<double> &pars)
+        {
+            // Each postsynaptic neuron receives input from at most one presynaptic neuron per kernel row, column and input channel
+            return (unsigned int)pars[0] * (unsigned int)pars[1] * (unsigned int)pars[8];
+        });
+
+    SET_CALC_KERNEL_SIZE_FUNC(
+        [](const std::vector<double> &pars)->std::vector<unsigned int>
+        {
+            return {(unsigned int)pars[0], (unsigned int)pars[1],
+                    (unsigned int)pars[8], (unsigned int)pars[11]};
+        });
+};
 }   // namespace InitVarSnippet
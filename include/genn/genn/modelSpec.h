@@ -142,6 +142,21 @@ public:
     //! Set whether timers and timing commands are to be included
     void setTiming(bool timingEnabled){ m_TimingEnabled = timingEnabled; }
 
+    //! Set whether the time taken to update each merged group and each population within it should be profiled
+    /*! Profiles can be accessed using the getProfile* functions and exported using writeProfileTrace and writeProfileSummary */
+    void setProfiling(bool profilingEnabled){ m_ProfilingEnabled = profilingEnabled; }
+
+    //! Set whether hardware performance counters should be recorded around each phase of the simulation
+    /*! Cycles, instructions, last-level cache misses and branch misses are read using Linux perf_event_open
+        and accumulated in the neuronUpdatePerfCounters etc arrays and, if profiling is enabled, for each profiled region */
+    void setPerfCounters(bool perfCountersEnabled){ m_PerfCountersEnabled = perfCountersEnabled; }
+
+    //! Set the number of instances of the model simulated together by the generated runner
+    /*! Each instance has its own copy of all neuron, postsynaptic, current source and synapse state but
+        all instances share their synaptic connectivity. Instance b's copy of a state variable begins at
+        element b times the per-instance size of the state variable's array. Only supported by the CPU backend. */
+    void setBatchSize(unsigned int batchSize);
+
     //! Set the random seed (disables automatic seeding if argument not 0).
     void setSeed(unsigned int rngSeed){ m_Seed = rngSeed; }
 
@@ -164,6 +179,13 @@ public:
     /*! This can significantly reduce the cost of updating neuron population but means that per-synapse group inSyn arrays can not be retrieved */
     void setMergePostsynapticModels(bool merge){ m_ShouldMergePostsynapticModels = merge; }
 
+    //! Set directory in which sparse connectivity generated by initialize() is cached between runs
+    /*! If set, the connectivity of each synapse group whose connectivity is generated from a fixed seed is written to
+        this directory after it has been built and, in subsequent runs, loaded from it rather than being regenerated.
+        Cache files are keyed on the connectivity initialisation snippet, its parameters, population sizes and seed.
+        The directory must exist when the simulation is run. Defaults to an empty string which disables caching. */
+    void setConnectivityCacheDirectory(const std::string &directory){ m_ConnectivityCacheDirectory = directory; }
+
     //! Gets the name of the neuronal network model
     const std::string &getName() const{ return m_Name; }
 
@@ -179,9 +201,21 @@ public:
     //! Get the random seed
     unsigned int getSeed() const { return m_Seed; }
 
+    //! Gets the number of instances of the model simulated together
+    unsigned int getBatchSize() const{ return m_BatchSize; }
+
     //! Are timers and timing commands enabled
     bool isTimingEnabled() const{ return m_TimingEnabled; }
 
+    //! Is per-group profiling enabled
+    bool isProfilingEnabled() const{ return m_ProfilingEnabled; }
+
+    //! Are hardware performance counters enabled
+    bool isPerfCountersEnabled() const{ return m_PerfCountersEnabled; }
+
+    //! Gets directory in which sparse connectivity is cached between runs
+    const std::string &getConnectivityCacheDirectory() const{ return m_ConnectivityCacheDirectory; }
+
     // PUBLIC NEURON FUNCTIONS
     //========================
     //! How many neurons make up the entire model
@@ -495,6 +529,11 @@ protected:
     //! Finalise model
     void finalize();
 
+    //! Remove all populations not simulated on host (i.e. MPI rank) hostID
+    /*! Neuron groups simulated on other hosts which provide spikes to local synapse groups are
+        replaced with placeholders, into which spikes are received from the host they are simulated on */
+    void partition(int hostID);
+
     //--------------------------------------------------------------------------
     // Protected const methods
     //--------------------------------------------------------------------------
@@ -504,6 +543,9 @@ protected:
     //! Are any variables in any populations in this model using zero-copy memory?
     bool zeroCopyInUse() const;
 
+    //! Should the connectivity generated for this synapse group be cached between runs?
+    bool isConnectivityCacheRequired(const SynapseGroupInternal &sg) const;
+
     //! Get std::map containing local named NeuronGroup objects in model
     const std::map<std::string, NeuronGroupInternal> &getNeuronGroups() const{ return m_LocalNeuronGroups; }
 
@@ -551,6 +593,15 @@ private:
     //! Whether timing code should be inserted into model
     bool m_TimingEnabled;
 
+    //! Whether code to profile individual merged groups and populations should be inserted into model
+    bool m_ProfilingEnabled;
+
+    //! Whether code to read hardware performance counters should be inserted into model
+    bool m_PerfCountersEnabled;
+
+    //! Number of instances of the model simulated together
+    unsigned int m_BatchSize;
+
     //! RNG seed
     unsigned int m_Seed;
 
@@ -569,6 +620,9 @@ private:
     //! Should compatible postsynaptic models and dendritic delay buffers be merged?
     /*! This can significantly reduce the cost of updating neuron population but means that per-synapse group inSyn arrays can not be retrieved */
     bool m_ShouldMergePostsynapticModels; 
+
+    //! Directory in which sparse connectivity is cached between runs (empty if caching is disabled)
+    std::string m_ConnectivityCacheDirectory;
 };
 
 // Typedefine NNmodel for backward compatibility
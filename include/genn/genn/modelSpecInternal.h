@@ -18,8 +18,10 @@ public:
     using ModelSpec::getLocalCurrentSources;
 
     using ModelSpec::finalize;
+    using ModelSpec::partition;
 
     using ModelSpec::scalarExpr;
 
     using ModelSpec::zeroCopyInUse;
+    using ModelSpec::isConnectivityCacheRequired;
 };
@@ -105,11 +105,28 @@ public:
         and only applies to extra global parameters which are pointers. */
     void setExtraGlobalParamLocation(const std::string &paramName, VarLocation loc);
 
+    //! Set whether neuron model parameter is dynamic
+    /*! Dynamic parameters are not built into the generated code as constants but can be
+        changed at runtime using the generated set<pop name><param name> function.
+        If any parameters are dynamic, all derived parameters also become dynamic. */
+    void setParamDynamic(const std::string &paramName, bool dynamic = true);
+
+    //! Set ID of host (i.e. MPI rank) this neuron group is simulated on
+    /*! This is ignored unless code is generated with MPI enabled */
+    void setHostID(int hostID){ m_HostID = hostID; }
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
     const std::string &getName() const{ return m_Name; }
 
+    //! Gets ID of host (i.e. MPI rank) this neuron group is simulated on
+    int getHostID() const{ return m_HostID; }
+
+    //! Is this neuron group simulated on another host?
+    /*! Remote neuron groups only provide spikes, received from their host, to local synapse groups */
+    bool isRemote() const{ return m_Remote; }
+
     //! Gets number of neurons in group
     unsigned int getNumNeurons() const{ return m_NumNeurons; }
 
@@ -117,6 +134,13 @@ public:
     const NeuronModels::Base *getNeuronModel() const{ return m_NeuronModel; }
 
     const std::vector<double> &getParams() const{ return m_Params; }
+
+    //! Is neuron model parameter dynamic?
+    bool isParamDynamic(size_t index) const{ return m_ParamDynamic.at(index); }
+
+    //! Are any neuron model parameters (and hence all derived parameters) dynamic?
+    bool isAnyParamDynamic() const;
+
     const std::vector<Models::VarInit> &getVarInitialisers() const{ return m_VarInitialisers; }
 
     bool isSpikeTimeRequired() const;
@@ -161,7 +185,7 @@ protected:
     NeuronGroup(const std::string &name, int numNeurons, const NeuronModels::Base *neuronModel,
                 const std::vector<double> &params, const std::vector<Models::VarInit> &varInitialisers,
                 VarLocation defaultVarLocation, VarLocation defaultExtraGlobalParamLocation) :
-        m_Name(name), m_NumNeurons(numNeurons), m_NeuronModel(neuronModel), m_Params(params), m_VarInitialisers(varInitialisers),
+        m_Name(name), m_NumNeurons(numNeurons), m_HostID(0), m_Remote(false), m_NeuronModel(neuronModel), m_Params(params), m_ParamDynamic(params.size(), false), m_VarInitialisers(varInitialisers),
         m_NumDelaySlots(1), m_VarQueueRequired(varInitialisers.size(), false), m_SpikeLocation(defaultVarLocation), m_SpikeEventLocation(defaultVarLocation),
         m_SpikeTimeLocation(defaultVarLocation), m_VarLocation(varInitialisers.size(), defaultVarLocation),
         m_ExtraGlobalParamLocation(neuronModel->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation)
@@ -182,9 +206,22 @@ protected:
 
     void addSpkEventCondition(const std::string &code, SynapseGroupInternal *synapseGroup);
 
+    //! Get position of the spike event condition added with this code by this synapse group
+    /*! This is also the bit set in each spike-like event's condition mask when this condition fires */
+    size_t getSpikeEventConditionIndex(const std::string &code, SynapseGroupInternal *synapseGroup) const;
+
     void addInSyn(SynapseGroupInternal *synapseGroup){ m_InSyn.push_back(synapseGroup); }
     void addOutSyn(SynapseGroupInternal *synapseGroup){ m_OutSyn.push_back(synapseGroup); }
 
+    //! Remove outgoing synapse group, simulated on another host
+    void removeOutSyn(SynapseGroupInternal *synapseGroup);
+
+    //! Mark that spikes emitted by this neuron group are required on another host
+    void addSpikeDestinationHost(int hostID){ m_SpikeDestinationHosts.insert(hostID); }
+
+    //! Replace this neuron group with a placeholder which only holds spikes received from the host it is simulated on
+    void makeRemote();
+
     void initDerivedParams(double dt);
 
     //! Merge incoming postsynaptic models
@@ -206,10 +243,16 @@ protected:
     //! Gets pointers to all current sources which provide input to this neuron group
     const std::vector<CurrentSourceInternal*> &getCurrentSources() const { return m_CurrentSources; }
 
+    //! Gets IDs of other hosts which require spikes emitted by this neuron group
+    const std::set<int> &getSpikeDestinationHosts() const{ return m_SpikeDestinationHosts; }
+
     const std::vector<double> &getDerivedParams() const{ return m_DerivedParams; }
 
     const std::set<SpikeEventThreshold> &getSpikeEventCondition() const{ return m_SpikeEventCondition; }
 
+    //! Do spike-like events need to record which of several conditions they were emitted by?
+    bool isSpikeEventConditionMaskRequired() const{ return (m_SpikeEventCondition.size() > 1); }
+
     //! Helper to get vector of incoming synapse groups which have postsynaptic update code
     std::vector<SynapseGroupInternal*> getInSynWithPostCode() const;
 
@@ -247,8 +290,21 @@ private:
 
     const unsigned int m_NumNeurons;
 
+    //! ID of host (i.e. MPI rank) this neuron group is simulated on
+    int m_HostID;
+
+    //! Has this neuron group been replaced with a placeholder for a neuron group simulated on another host
+    bool m_Remote;
+
+    //! IDs of other hosts which require spikes emitted by this neuron group
+    std::set<int> m_SpikeDestinationHosts;
+
     const NeuronModels::Base *m_NeuronModel;
-    const std::vector<double> m_Params;
+    std::vector<double> m_Params;
+
+    //! Vector specifying which parameters are dynamic
+    std::vector<bool> m_ParamDynamic;
+
     std::vector<double> m_DerivedParams;
     std::vector<Models::VarInit> m_VarInitialisers;
     std::vector<SynapseGroupInternal*> m_InSyn;
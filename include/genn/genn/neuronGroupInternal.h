@@ -21,8 +21,12 @@ public:
     using NeuronGroup::updatePreVarQueues;
     using NeuronGroup::updatePostVarQueues;
     using NeuronGroup::addSpkEventCondition;
+    using NeuronGroup::getSpikeEventConditionIndex;
     using NeuronGroup::addInSyn;
     using NeuronGroup::addOutSyn;
+    using NeuronGroup::removeOutSyn;
+    using NeuronGroup::addSpikeDestinationHost;
+    using NeuronGroup::makeRemote;
     using NeuronGroup::initDerivedParams;
     using NeuronGroup::mergeIncomingPSM;
     using NeuronGroup::injectCurrent;
@@ -30,8 +34,10 @@ public:
     using NeuronGroup::getMergedInSyn;
     using NeuronGroup::getOutSyn;
     using NeuronGroup::getCurrentSources;
+    using NeuronGroup::getSpikeDestinationHosts;
     using NeuronGroup::getDerivedParams;
     using NeuronGroup::getSpikeEventCondition;
+    using NeuronGroup::isSpikeEventConditionMaskRequired;
     using NeuronGroup::getInSynWithPostCode;
     using NeuronGroup::getOutSynWithPreCode;
     using NeuronGroup::getInSynWithPostVars;
@@ -1,8 +1,10 @@
 #pragma once
 
 // Standard includes
+#include <algorithm>
 #include <array>
 #include <functional>
+#include <limits>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -22,16 +24,53 @@
 #define SET_SUPPORT_CODE(SUPPORT_CODE) virtual std::string getSupportCode() const override{ return SUPPORT_CODE; }
 #define SET_ADDITIONAL_INPUT_VARS(...) virtual ParamValVec getAdditionalInputVars() const override{ return __VA_ARGS__; }
 #define SET_NEEDS_AUTO_REFRACTORY(AUTO_REFRACTORY_REQUIRED) virtual bool isAutoRefractoryRequired() const override{ return AUTO_REFRACTORY_REQUIRED; }
+#define SET_ODES(...) virtual ODEVec getODEs() const override{ return __VA_ARGS__; }
+#define SET_ODE_INTEGRATOR(ODE_INTEGRATOR) virtual NeuronModels::ODEIntegrator getODEIntegrator() const override{ return NeuronModels::ODEIntegrator::ODE_INTEGRATOR; }
+#define SET_ODE_SUBSTEPS(ODE_SUBSTEPS) virtual unsigned int getODESubsteps() const override{ return ODE_SUBSTEPS; }
+#define SET_ODE_TOLERANCE(ODE_TOLERANCE) virtual double getODETolerance() const override{ return ODE_TOLERANCE; }
 
 //----------------------------------------------------------------------------
 // NeuronModels::Base
 //----------------------------------------------------------------------------
 namespace NeuronModels
 {
+//----------------------------------------------------------------------------
+// NeuronModels::ODEIntegrator
+//----------------------------------------------------------------------------
+//! Methods which can be used to integrate ODEs declared with SET_ODES
+enum class ODEIntegrator
+{
+    ForwardEuler,       //!< Forward Euler with a fixed number of substeps
+    ExponentialEuler,   //!< Exponential Euler with a fixed number of substeps - exact for ODEs which are linear in their own variable
+    RK4,                //!< Classical fourth-order Runge-Kutta with a fixed number of substeps
+    RK45,               //!< Cash-Karp Runge-Kutta with adaptive, per-neuron step size control
+};
+
 //! Base class for all neuron models
 class GENN_EXPORT Base : public Models::Base
 {
 public:
+    //----------------------------------------------------------------------------
+    // Structs
+    //----------------------------------------------------------------------------
+    //! An ODE has the name of the variable it integrates and the code for its
+    //! time derivative, which can refer to anything sim code can e.g. $(V), $(Isyn)
+    struct ODE
+    {
+        bool operator == (const ODE &other) const
+        {
+            return ((var == other.var) && (rhs == other.rhs));
+        }
+
+        std::string var;
+        std::string rhs;
+    };
+
+    //----------------------------------------------------------------------------
+    // Typedefines
+    //----------------------------------------------------------------------------
+    typedef std::vector<ODE> ODEVec;
+
     //----------------------------------------------------------------------------
     // Declared virtuals
     //----------------------------------------------------------------------------
@@ -60,9 +99,27 @@ public:
     //! Does this model require auto-refractory logic?
     virtual bool isAutoRefractoryRequired() const{ return true; }
 
+    //! Gets ODEs which are integrated over each timestep before sim code is run
+    /*! All derivatives are evaluated before any variables are updated so ODEs can be coupled. */
+    virtual ODEVec getODEs() const{ return {}; }
+
+    //! Gets method used to integrate ODEs
+    virtual ODEIntegrator getODEIntegrator() const{ return ODEIntegrator::ForwardEuler; }
+
+    //! Gets number of substeps each timestep is divided into when integrating ODEs
+    /*! For ODEIntegrator::RK45 this only sets the initial step size */
+    virtual unsigned int getODESubsteps() const{ return 1; }
+
+    //! Gets absolute and relative error tolerance used for step size control by ODEIntegrator::RK45
+    virtual double getODETolerance() const{ return 1E-6; }
+
     //----------------------------------------------------------------------------
     // Public API
     //----------------------------------------------------------------------------
+    //! Gets code which integrates ODEs over one timestep using the chosen integrator
+    /*! This is inserted before the sim code and, like it, refers to $(NN) for the value of the variable with name "NN". */
+    std::string getODECode() const;
+
     //! Can this neuron model be merged with other? i.e. can they be simulated using same generated code
     bool canBeMerged(const Base *other) const;
 };
@@ -287,6 +344,57 @@ public:
     SET_NEEDS_AUTO_REFRACTORY(false);
 };
 
+//----------------------------------------------------------------------------
+// NeuronModels::SpikeSourceSchedule
+//----------------------------------------------------------------------------
+//! Spike source which replays a schedule of spikes sorted by timestep
+/*! Rather than storing the times of each neuron's spikes, this model reads the IDs of the neurons
+    which should spike in each timestep from a global, time-sorted schedule. It has no variables and
+    3 extra global parameters:
+
+    - \c spikeTimestepOffsets - Array of numTimesteps + 1 indices into spikeIDs where
+                                 the spikes emitted in each timestep start
+    - \c spikeIDs - Array with IDs of neurons to spike in each timestep, sorted by ID within each timestep.
+                     If an ID appears more than once in a timestep, the neuron only spikes once
+    - \c numTimesteps - Number of timesteps in the schedule
+
+    Where a population has no inputs, the single-threaded CPU backend directly emits the spikes
+    scheduled for each timestep without testing the neurons which don't spike. Otherwise, as
+    on the GPU, each neuron binary searches the current timestep's spikes for its ID.
+    SpikeSchedule, in userproject/include/spikeSchedule.h, can be used to load schedules from binary spike files. */
+class SpikeSourceSchedule : public Base
+{
+public:
+    DECLARE_MODEL(NeuronModels::SpikeSourceSchedule, 0, 0);
+
+    SET_SUPPORT_CODE(
+        "SUPPORT_CODE_FUNC bool isSpikeScheduled(unsigned int id, unsigned int timestep, unsigned int numTimesteps,\n"
+        "                                        const unsigned int *spikeTimestepOffsets, const unsigned int *spikeIDs)\n"
+        "{\n"
+        "    if(timestep >= numTimesteps) {\n"
+        "        return false;\n"
+        "    }\n"
+        "    unsigned int start = spikeTimestepOffsets[timestep];\n"
+        "    unsigned int end = spikeTimestepOffsets[timestep + 1];\n"
+        "    while(start < end) {\n"
+        "        const unsigned int mid = (start + end) / 2;\n"
+        "        if(spikeIDs[mid] < id) {\n"
+        "            start = mid + 1;\n"
+        "        }\n"
+        "        else {\n"
+        "            end = mid;\n"
+        "        }\n"
+        "    }\n"
+        "    return (start < spikeTimestepOffsets[timestep + 1] && spikeIDs[start] == id);\n"
+        "}\n");
+    SET_THRESHOLD_CONDITION_CODE(
+        "isSpikeScheduled($(id), (unsigned int)(($(t) / DT) + 0.5), $(numTimesteps), "
+        "$(spikeTimestepOffsets), $(spikeIDs))");
+    SET_EXTRA_GLOBAL_PARAMS({{"spikeTimestepOffsets", "unsigned int*"}, {"spikeIDs", "unsigned int*"},
+                             {"numTimesteps", "unsigned int"}});
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
 //----------------------------------------------------------------------------
 // NeuronModels::Poisson
 //----------------------------------------------------------------------------
@@ -374,6 +482,40 @@ public:
     SET_NEEDS_AUTO_REFRACTORY(false);
 };
 
+//----------------------------------------------------------------------------
+// NeuronModels::PoissonEventDriven
+//----------------------------------------------------------------------------
+//! Poisson neurons with a homogeneous firing rate, simulated in an event-driven manner
+/*! It has no state variables and 1 parameter:
+
+    - \c rate - Mean firing rate (Hz)
+
+    Each neuron emits a spike in each timestep with probability \f$p = \min(1, \mathrm{rate} \cdot DT / 1000)\f$.
+    Where a population has no inputs, the single-threaded CPU backend does not update every neuron but
+    instead samples the geometrically-distributed number of neurons to skip before the next spiking neuron
+    so the cost of simulating a population scales with the number of spikes it emits rather than its size.
+    Otherwise, as on the GPU, a uniform random number is drawn for every neuron every timestep. */
+class PoissonEventDriven : public Base
+{
+public:
+    DECLARE_MODEL(NeuronModels::PoissonEventDriven, 1, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("$(gennrand_uniform) < $(spikeProb)");
+
+    SET_PARAM_NAMES({"rate"});
+    SET_DERIVED_PARAMS({
+        {"spikeProb", [](const std::vector<double> &pars, double dt){ return std::min(1.0, pars[0] * dt / 1000.0); }},
+        {"logNoSpikeProb",
+         [](const std::vector<double> &pars, double dt)
+         {
+             // **NOTE** if every neuron spikes, log(1 - p) would be -inf which can't be written into generated
+             // code so use the lowest finite float instead which still results in no neurons being skipped
+             const double p = pars[0] * dt / 1000.0;
+             return (p < 1.0) ? std::log1p(-p) : std::numeric_limits<float>::lowest();
+         }}});
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
 //----------------------------------------------------------------------------
 // NeuronModels::TraubMiles
 //----------------------------------------------------------------------------
@@ -191,6 +191,17 @@ public:
     //------------------------------------------------------------------------
     // Public methods
     //------------------------------------------------------------------------
+    //! Find the index of a named parameter
+    size_t getParamIndex(const std::string &paramName) const
+    {
+        const auto paramNames = getParamNames();
+        auto iter = std::find(paramNames.cbegin(), paramNames.cend(), paramName);
+        assert(iter != paramNames.cend());
+
+        // Return 'distance' between first entry in vector and iterator i.e. index
+        return distance(paramNames.cbegin(), iter);
+    }
+
     //! Find the index of a named extra global parameter
     size_t getExtraGlobalParamIndex(const std::string &paramName) const
     {
@@ -43,6 +43,12 @@ public:
     /*! This is ignored for simulations on hardware with a single memory space */
     void setWUVarLocation(const std::string &varName, VarLocation loc);
 
+    //! Set format in which weight update model state variable is stored
+    /*! Only applies to floating point variables of synapse groups with individual or kernel weights.
+        Variables are widened to scalar when they are read by generated code and narrowed when they are written.
+        For VarStorage::INT8 and VarStorage::INT16, the stored integer is multiplied by scale to obtain the value. */
+    void setWUVarStorage(const std::string &varName, VarStorage storage, double scale = 1.0);
+
     //! Set location of weight update model presynaptic state variable
     /*! This is ignored for simulations on hardware with a single memory space */
     void setWUPreVarLocation(const std::string &varName, VarLocation loc);
@@ -65,6 +71,18 @@ public:
         and only applies to extra global parameters which are pointers. */
     void setPSExtraGlobalParamLocation(const std::string &paramName, VarLocation loc);
 
+    //! Set whether weight update model parameter is dynamic
+    /*! Dynamic parameters are not built into the generated code as constants but can be
+        changed at runtime using the generated set<synapse group name><param name> function.
+        If any parameters are dynamic, all derived parameters also become dynamic. */
+    void setWUParamDynamic(const std::string &paramName, bool dynamic = true);
+
+    //! Set whether postsynaptic model parameter is dynamic
+    /*! Dynamic parameters are not built into the generated code as constants but can be
+        changed at runtime using the generated set<synapse group name><param name> function.
+        If any parameters are dynamic, all derived parameters also become dynamic. */
+    void setPSParamDynamic(const std::string &paramName, bool dynamic = true);
+
     //! Set location of sparse connectivity initialiser extra global parameter
     /*! This is ignored for simulations on hardware with a single memory space
         and only applies to extra global parameters which are pointers. */
@@ -106,6 +124,34 @@ public:
     //! Enables or disables using narrow i.e. less than 32-bit types for sparse matrix indices
     void setNarrowSparseIndEnabled(bool enabled);
 
+    //! Enables or disables sparse dendritic delay buffers
+    /*! Rather than sweeping the entire dendritic delay slot every timestep, each slot additionally
+        records a compact list of the postsynaptic neurons which received delayed input so that only these
+        are accumulated into inSyn and zeroed. This is beneficial with long delays and sparse input. */
+    void setSparseDendriticDelayEnabled(bool enabled){ m_SparseDendriticDelayEnabled = enabled; }
+
+    //! Enables or disables storing the range of non-empty words in each row of a bitmask
+    /*! When BITMASK connectivity is stored with PreferencesBase::enableBitmaskOptimisations, this allows
+        very sparse rows to be traversed in time proportional to the words which actually contain synapses */
+    void setBitmaskRowWordRangeEnabled(bool enabled);
+
+    //! Enables or disables reordering postsynaptic input to this synapse group's target neurons
+    /*! After SPARSE connectivity has been initialised, the target neurons are renumbered using
+        the reverse Cuthill-McKee algorithm so that neurons which share presynaptic neurons become
+        neighbours and the input from each spike is accumulated into nearby memory. Only the layout of
+        this synapse group's inSyn buffer is changed so neuron indices seen by models are unaffected.
+        However, the inSynXXX array accessed by user code, copied by pushXXXStateToDevice and pullXXXStateFromDevice
+        and saved and loaded is NOT translated back, so the input to target neuron i is held at inSynXXX[inSynOrderXXX[i]]
+        where XXX is the synapse group name. inSynOrderXXX is saved and loaded alongside the connectivity. */
+    void setPostsynapticReorderingEnabled(bool enabled);
+
+    //! Enables or disables storing SPARSE target indices in a compressed form for presynaptic updates
+    /*! After SPARSE connectivity has been initialised, each row's target indices are delta encoded into a
+        contiguous stream of variable-length bytes indexed by a per-row byte offset rather than the row stride.
+        Rows must be sorted in ascending order, as they are by all the built-in connectivity initialisation snippets.
+        Once encoded, the padded target index array is freed so it cannot be accessed from user code. */
+    void setCompressedSparseIndEnabled(bool enabled);
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
@@ -118,6 +164,13 @@ public:
     unsigned int getMaxConnections() const;
     unsigned int getMaxSourceConnections() const;
     unsigned int getMaxDendriticDelayTimesteps() const{ return m_MaxDendriticDelayTimesteps; }
+
+    //! Get dimensions of kernel shared between synapses (empty if connectivity initialiser doesn't define a kernel)
+    const std::vector<unsigned int> &getKernelSize() const{ return m_KernelSize; }
+
+    //! Get total number of elements in kernel shared between synapses
+    size_t getKernelSizeFlattened() const;
+
     SynapseMatrixType getMatrixType() const{ return m_MatrixType; }
 
     //! Get variable mode used for variables used to combine input from this synapse group
@@ -129,6 +182,18 @@ public:
     //! Get variable mode used for this synapse group's dendritic delay buffers
     VarLocation getDendriticDelayLocation() const{ return m_DendriticDelayLocation; }
 
+    //! Are sparse dendritic delay buffers enabled for this synapse group
+    bool isSparseDendriticDelayEnabled() const{ return m_SparseDendriticDelayEnabled; }
+
+    //! Is the range of non-empty words in each row of this synapse group's bitmask stored
+    bool isBitmaskRowWordRangeEnabled() const;
+
+    //! Is postsynaptic input to this synapse group's target neurons reordered
+    bool isPostsynapticReorderingEnabled() const;
+
+    //! Are this synapse group's SPARSE target indices stored in a compressed form
+    bool isCompressedSparseIndEnabled() const;
+
     //! Does synapse group need to handle 'true' spikes
     bool isTrueSpikeRequired() const;
 
@@ -141,6 +206,13 @@ public:
     const WeightUpdateModels::Base *getWUModel() const{ return m_WUModel; }
 
     const std::vector<double> &getWUParams() const{ return m_WUParams; }
+
+    //! Is weight update model parameter dynamic?
+    bool isWUParamDynamic(size_t index) const{ return m_WUParamDynamic.at(index); }
+
+    //! Are any weight update model parameters (and hence all derived parameters) dynamic?
+    bool isAnyWUParamDynamic() const;
+
     const std::vector<Models::VarInit> &getWUVarInitialisers() const{ return m_WUVarInitialisers; }
     const std::vector<Models::VarInit> &getWUPreVarInitialisers() const{ return m_WUPreVarInitialisers; }
     const std::vector<Models::VarInit> &getWUPostVarInitialisers() const{ return m_WUPostVarInitialisers; }
@@ -149,6 +221,13 @@ public:
     const PostsynapticModels::Base *getPSModel() const{ return m_PSModel; }
 
     const std::vector<double> &getPSParams() const{ return m_PSParams; }
+
+    //! Is postsynaptic model parameter dynamic?
+    bool isPSParamDynamic(size_t index) const{ return m_PSParamDynamic.at(index); }
+
+    //! Are any postsynaptic model parameters (and hence all derived parameters) dynamic?
+    bool isAnyPSParamDynamic() const;
+
     const std::vector<Models::VarInit> &getPSVarInitialisers() const{ return m_PSVarInitialisers; }
     const std::vector<double> getPSConstInitVals() const;
 
@@ -162,6 +241,15 @@ public:
     //! Get location of weight update model per-synapse state variable by index
     VarLocation getWUVarLocation(size_t index) const;
 
+    //! Get format in which weight update model per-synapse state variable is stored
+    VarStorage getWUVarStorage(size_t index) const;
+
+    //! Get scale applied to integer-stored weight update model per-synapse state variable
+    double getWUVarStorageScale(size_t index) const;
+
+    //! Are any weight update model per-synapse state variables stored in reduced precision?
+    bool isWUVarStorageReduced() const;
+
     //! Get location of weight update model presynaptic state variable by name
     VarLocation getWUPreVarLocation(const std::string &var) const;
 
@@ -246,7 +334,11 @@ protected:
     NeuronGroupInternal *getSrcNeuronGroup(){ return m_SrcNeuronGroup; }
     NeuronGroupInternal *getTrgNeuronGroup(){ return m_TrgNeuronGroup; }
 
-    void setEventThresholdReTestRequired(bool req){ m_EventThresholdReTestRequired = req; }
+    void setEventThresholdConditionBit(unsigned int bit)
+    {
+        m_EventThresholdConditionMaskRequired = true;
+        m_EventThresholdConditionBit = bit;
+    }
 
     void setPSModelMergeTarget(const std::string &targetName)
     {
@@ -266,9 +358,12 @@ protected:
 
     const SynapseGroupInternal *getWeightSharingMaster() const { return m_WeightSharingMaster; }
 
-    //!< Does the event threshold needs to be retested in the synapse kernel?
+    //!< Does the synapse kernel need to check which condition each spike-like event was emitted by?
     /*! This is required when the pre-synaptic neuron population's outgoing synapse groups require different event threshold */
-    bool isEventThresholdReTestRequired() const{ return m_EventThresholdReTestRequired; }
+    bool isEventThresholdConditionMaskRequired() const{ return m_EventThresholdConditionMaskRequired; }
+
+    //!< Bit set in presynaptic spike-like events' condition mask when this group's event threshold condition fires
+    unsigned int getEventThresholdConditionBit() const{ return m_EventThresholdConditionBit; }
 
     const std::string &getPSModelTargetName() const{ return m_PSModelTargetName; }
     bool isPSModelMerged() const{ return m_PSModelTargetName != getName(); }
@@ -321,6 +416,12 @@ protected:
     bool canConnectivityHostInitBeMerged(const SynapseGroup &other) const;
 
 private:
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    //! Check that no dynamic weight update and postsynaptic model parameters share names
+    void checkDynamicParamNames() const;
+
     //------------------------------------------------------------------------
     // Members
     //------------------------------------------------------------------------
@@ -345,6 +446,9 @@ private:
     //! Maximum number of source neurons any target neuron can connect to
     unsigned int m_MaxSourceConnections;
 
+    //! Dimensions of kernel shared between synapses
+    std::vector<unsigned int> m_KernelSize;
+
     //! Maximum dendritic delay timesteps supported for synapses in this population
     unsigned int m_MaxDendriticDelayTimesteps;
     
@@ -360,13 +464,28 @@ private:
     //! Pointer to 'master' weight sharing group if this is a slave
     const SynapseGroupInternal *m_WeightSharingMaster;
 
-    //! Does the event threshold needs to be retested in the synapse kernel?
+    //! Does the synapse kernel need to check which condition each spike-like event was emitted by?
     /*! This is required when the pre-synaptic neuron population's outgoing synapse groups require different event threshold */
-    bool m_EventThresholdReTestRequired;
+    bool m_EventThresholdConditionMaskRequired;
+
+    //! Bit set in presynaptic spike-like events' condition mask when this group's event threshold condition fires
+    unsigned int m_EventThresholdConditionBit;
 
     //! Should narrow i.e. less than 32-bit types be used for sparse matrix indices
     bool m_NarrowSparseIndEnabled;
 
+    //! Should dendritic delay buffers record which postsynaptic neurons they contain input for
+    bool m_SparseDendriticDelayEnabled;
+
+    //! Should the range of non-empty words in each bitmask row be stored
+    bool m_BitmaskRowWordRangeEnabled;
+
+    //! Should postsynaptic input be accumulated in reordered target neuron order
+    bool m_PostsynapticReorderingEnabled;
+
+    //! Should SPARSE target indices be delta encoded into a compressed byte stream
+    bool m_CompressedSparseIndEnabled;
+
     //! Variable mode used for variables used to combine input from this synapse group
     VarLocation m_InSynLocation;
 
@@ -379,6 +498,9 @@ private:
     //! Parameters of weight update model
     const std::vector<double> m_WUParams;
 
+    //! Vector specifying which weight update model parameters are dynamic
+    std::vector<bool> m_WUParamDynamic;
+
     //! Derived parameters for weight update model
     std::vector<double> m_WUDerivedParams;
 
@@ -397,6 +519,9 @@ private:
     //! Parameters of post synapse model
     const std::vector<double> m_PSParams;
 
+    //! Vector specifying which post synapse model parameters are dynamic
+    std::vector<bool> m_PSParamDynamic;
+
     //! Derived parameters for post synapse model
     std::vector<double> m_PSDerivedParams;
 
@@ -406,6 +531,12 @@ private:
     //! Location of individual per-synapse state variables
     std::vector<VarLocation> m_WUVarLocation;
 
+    //! Format in which individual per-synapse state variables are stored
+    std::vector<VarStorage> m_WUVarStorage;
+
+    //! Scale applied to individual per-synapse state variables stored as integers
+    std::vector<double> m_WUVarStorageScale;
+
     //! Location of individual presynaptic state variables
     std::vector<VarLocation> m_WUPreVarLocation;
 
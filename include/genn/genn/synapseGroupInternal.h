@@ -31,10 +31,11 @@ public:
     using SynapseGroup::getWeightSharingMaster;
     using SynapseGroup::getWUDerivedParams;
     using SynapseGroup::getPSDerivedParams;
-    using SynapseGroup::setEventThresholdReTestRequired;
+    using SynapseGroup::setEventThresholdConditionBit;
     using SynapseGroup::setPSModelMergeTarget;
     using SynapseGroup::initDerivedParams;
-    using SynapseGroup::isEventThresholdReTestRequired;
+    using SynapseGroup::isEventThresholdConditionMaskRequired;
+    using SynapseGroup::getEventThresholdConditionBit;
     using SynapseGroup::getPSModelTargetName;
     using SynapseGroup::isPSModelMerged;
     using SynapseGroup::getSparseIndType;
@@ -10,6 +10,7 @@ enum class SynapseMatrixConnectivity : unsigned int
     BITMASK     = (1 << 1),
     SPARSE      = (1 << 2),
     PROCEDURAL  = (1 << 3),
+    CSR         = (1 << 4),
 };
 
 //!< Flags defining different types of synaptic matrix connectivity
@@ -19,6 +20,7 @@ enum class SynapseMatrixWeight : unsigned int
     INDIVIDUAL      = (1 << 6),
     PROCEDURAL      = (1 << 7),
     INDIVIDUAL_PSM  = (1 << 8),
+    KERNEL          = (1 << 9),
 };
 
 //!< Supported combinations of SynapticMatrixConnectivity and SynapticMatrixWeight
@@ -33,9 +35,13 @@ enum class SynapseMatrixType : unsigned int
     SPARSE_GLOBALG                      = static_cast<unsigned int>(SynapseMatrixConnectivity::SPARSE) | static_cast<unsigned int>(SynapseMatrixWeight::GLOBAL),
     SPARSE_GLOBALG_INDIVIDUAL_PSM       = static_cast<unsigned int>(SynapseMatrixConnectivity::SPARSE) | static_cast<unsigned int>(SynapseMatrixWeight::GLOBAL) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL_PSM),
     SPARSE_INDIVIDUALG                  = static_cast<unsigned int>(SynapseMatrixConnectivity::SPARSE) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL_PSM),
+    CSR_GLOBALG                         = static_cast<unsigned int>(SynapseMatrixConnectivity::CSR) | static_cast<unsigned int>(SynapseMatrixWeight::GLOBAL),
+    CSR_GLOBALG_INDIVIDUAL_PSM          = static_cast<unsigned int>(SynapseMatrixConnectivity::CSR) | static_cast<unsigned int>(SynapseMatrixWeight::GLOBAL) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL_PSM),
+    CSR_INDIVIDUALG                     = static_cast<unsigned int>(SynapseMatrixConnectivity::CSR) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL_PSM),
     PROCEDURAL_GLOBALG                  = static_cast<unsigned int>(SynapseMatrixConnectivity::PROCEDURAL) | static_cast<unsigned int>(SynapseMatrixWeight::GLOBAL),
     PROCEDURAL_GLOBALG_INDIVIDUAL_PSM   = static_cast<unsigned int>(SynapseMatrixConnectivity::PROCEDURAL) | static_cast<unsigned int>(SynapseMatrixWeight::GLOBAL) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL_PSM),
     PROCEDURAL_PROCEDURALG              = static_cast<unsigned int>(SynapseMatrixConnectivity::PROCEDURAL) | static_cast<unsigned int>(SynapseMatrixWeight::PROCEDURAL) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL_PSM),
+    PROCEDURAL_KERNELG                  = static_cast<unsigned int>(SynapseMatrixConnectivity::PROCEDURAL) | static_cast<unsigned int>(SynapseMatrixWeight::KERNEL) | static_cast<unsigned int>(SynapseMatrixWeight::INDIVIDUAL_PSM),
 };
 
 //----------------------------------------------------------------------------
@@ -23,4 +23,17 @@ enum class VarLocation : uint8_t
 inline bool operator & (VarLocation locA, VarLocation locB)
 {
     return (static_cast<uint8_t>(locA) & static_cast<uint8_t>(locB)) != 0;
-}
\ No newline at end of file
+}
+//----------------------------------------------------------------------------
+// VarStorage
+//----------------------------------------------------------------------------
+//!< Reduced-precision formats in which floating point variables can be stored in memory
+/*! Variables are widened to scalar when loaded by generated code and narrowed when stored */
+enum class VarStorage : uint8_t
+{
+    NATIVE,     //!< Stored using the variable's own type
+    HALF,       //!< IEEE 754 half precision, stored as uint16_t
+    BFLOAT16,   //!< Brain floating point (upper 16 bits of a float), stored as uint16_t
+    INT8,       //!< int8_t scaled by a per-variable scale factor
+    INT16,      //!< int16_t scaled by a per-variable scale factor
+};
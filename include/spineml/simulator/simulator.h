@@ -24,6 +24,18 @@ namespace SpineMLSimulator
 class Simulator
 {
 public:
+    //------------------------------------------------------------------------
+    // PerfCounters
+    //------------------------------------------------------------------------
+    //! Hardware performance counters accumulated in a phase of the simulation
+    struct PerfCounters
+    {
+        unsigned long long cycles;
+        unsigned long long instructions;
+        unsigned long long llcMisses;
+        unsigned long long branchMisses;
+    };
+
     Simulator(plog::Severity logLevel = plog::warning);
     Simulator(const std::string &experimentXML, const std::string &overrideOutputPath = "", plog::Severity logLevel = plog::warning);
     ~Simulator();
@@ -62,6 +74,14 @@ public:
     double getSynapseDynamicsTime() const;
     double getInitSparseTime() const;
 
+    //! Hardware performance counters provided by GeNN if model was generated with them enabled
+    PerfCounters getNeuronUpdatePerfCounters() const;
+    PerfCounters getInitPerfCounters() const;
+    PerfCounters getPresynapticUpdatePerfCounters() const;
+    PerfCounters getPostsynapticUpdatePerfCounters() const;
+    PerfCounters getSynapseDynamicsPerfCounters() const;
+    PerfCounters getInitSparsePerfCounters() const;
+
     //! Calculate duration of simulation read from experiment in timesteps
     unsigned long long calcNumTimesteps() const
     {
@@ -96,6 +116,9 @@ private:
     /*! if allowMissing is true, returns nullptr if symbol is not found, otherwise throws exception */
     void *getLibrarySymbol(const char *name, bool allowMissing = false) const;
 
+    //! Get hardware performance counters from named array in model library
+    PerfCounters getPerfCounters(const char *name) const;
+
 
     NeuronPopSpikeVars getNeuronPopSpikeVars(const std::string &popName) const;
 
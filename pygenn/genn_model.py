@@ -165,6 +165,30 @@ class GeNNModel(object):
     @timing_enabled.setter
     def timing_enabled(self, timing):
         self._model.set_timing(timing)
+
+    @property
+    def profiling_enabled(self):
+        """Is the time taken to update each merged group
+        and each population recorded every timestep"""
+        return self._model.is_profiling_enabled()
+
+    @profiling_enabled.setter
+    def profiling_enabled(self, profiling):
+        if self._built:
+            raise Exception("GeNN model already built")
+        self._model.set_profiling(profiling)
+
+    @property
+    def perf_counters_enabled(self):
+        """Are hardware performance counters recorded
+        around each phase of the simulation"""
+        return self._model.is_perf_counters_enabled()
+
+    @perf_counters_enabled.setter
+    def perf_counters_enabled(self, perf_counters):
+        if self._built:
+            raise Exception("GeNN model already built")
+        self._model.set_perf_counters(perf_counters)
     
     @property
     def default_var_location(self):
@@ -262,6 +286,79 @@ class GeNNModel(object):
     def init_sparse_time(self):
         return self._slm.get_init_sparse_time()
 
+    @property
+    def perf_counters(self):
+        """Dictionary of hardware performance counters
+        accumulated in each phase of the simulation"""
+        if not self._loaded:
+            raise Exception("GeNN model has to be loaded before "
+                            "reading performance counters")
+
+        return {p: self._get_perf_counters(
+                    lambda c: self._slm.get_perf_counter(p, c))
+                for p in ("neuronUpdate", "init", "presynapticUpdate",
+                          "postsynapticUpdate", "synapseDynamics",
+                          "initSparse")}
+
+    @property
+    def perf_counters_available(self):
+        """Could hardware performance counters be opened"""
+        if not self._loaded:
+            raise Exception("GeNN model has to be loaded before "
+                            "reading performance counters")
+        return self._slm.are_perf_counters_available()
+
+    @property
+    def profile(self):
+        """List of dictionaries describing the time taken to update each
+        merged group and each population since the model was loaded
+        or the profile was last reset. Times are in seconds."""
+        if not self._loaded:
+            raise Exception("GeNN model has to be loaded before profiling")
+
+        num_bins = self._slm.get_profile_num_histogram_bins()
+        profile = []
+        for r in range(self._slm.get_profile_num_regions()):
+            profile.append({
+                "name": self._slm.get_profile_region_name(r),
+                "phase": self._slm.get_profile_region_phase(r),
+                "parent": self._slm.get_profile_region_parent(r),
+                "count": self._slm.get_profile_region_count(r),
+                "total_time": self._slm.get_profile_region_total_time(r),
+                "min_time": self._slm.get_profile_region_min_time(r),
+                "max_time": self._slm.get_profile_region_max_time(r),
+                "histogram": [self._slm.get_profile_region_histogram(r, b)
+                              for b in range(num_bins)],
+                "perf_counters": self._get_perf_counters(
+                    lambda c: self._slm.get_profile_region_perf_counter(r, c))})
+        return profile
+
+    def reset_profile(self):
+        """Reset times and trace recorded by profiling"""
+        if not self._loaded:
+            raise Exception("GeNN model has to be loaded before profiling")
+        self._slm.reset_profile()
+
+    def set_profile_trace_capacity(self, capacity):
+        """Set maximum number of events recorded in profile trace"""
+        if not self._loaded:
+            raise Exception("GeNN model has to be loaded before profiling")
+        self._slm.set_profile_trace_capacity(capacity)
+
+    def write_profile_trace(self, path):
+        """Write profile trace in Chrome trace event format which
+        can be viewed in chrome://tracing or Perfetto"""
+        if not self._loaded:
+            raise Exception("GeNN model has to be loaded before profiling")
+        self._slm.write_profile_trace(path)
+
+    def write_profile_summary(self, path):
+        """Write table summarising time taken to update
+        each merged group and each population"""
+        if not self._loaded:
+            raise Exception("GeNN model has to be loaded before profiling")
+        self._slm.write_profile_summary(path)
+
     def add_neuron_population(self, pop_name, num_neurons, neuron,
                               param_space, var_space):
         """Add a neuron population to the GeNN model
@@ -686,6 +783,11 @@ class GeNNModel(object):
         else:
             raise ValueError("'%s' must be a SynapseGroup or string" % context)
 
+    def _get_perf_counters(self, get_counter):
+        # Build dictionary from cycles, instructions, LLC misses and branch misses
+        return dict(zip(("cycles", "instructions", "llc_misses", "branch_misses"),
+                        (get_counter(c) for c in range(4))))
+
 def init_var(init_var_snippet, param_space):
     """This helper function creates a VarInit object
     to easily initialise a variable using a snippet.
@@ -29,7 +29,9 @@ const std::vector<Substitutions::FunctionTemplate> cudaFunctions = {
     {"gennrand_normal", 0, "curand_normal_double($(rng))", "curand_normal($(rng))"},
     {"gennrand_exponential", 0, "exponentialDistDouble($(rng))", "exponentialDistFloat($(rng))"},
     {"gennrand_log_normal", 2, "curand_log_normal_double($(rng), $(0), $(1))", "curand_log_normal_float($(rng), $(0), $(1))"},
-    {"gennrand_gamma", 1, "gammaDistDouble($(rng), $(0))", "gammaDistFloat($(rng), $(0))"}
+    {"gennrand_gamma", 1, "gammaDistDouble($(rng), $(0))", "gammaDistFloat($(rng), $(0))"},
+    {"gennrand_poisson", 1, "poissonDistDouble($(rng), $(0))", "poissonDistFloat($(rng), $(0))"},
+    {"gennrand_binomial", 2, "binomialDistDouble($(rng), $(0), $(1))", "binomialDistFloat($(rng), $(0), $(1))"}
 };
 
 //--------------------------------------------------------------------------
@@ -138,6 +140,12 @@ size_t getNumMergedGroupThreads(const std::vector<T> &groups, G getNumThreads)
         });
 }
 //-----------------------------------------------------------------------
+size_t getNumDenseInitThreads(const SynapseGroupInternal &sg)
+{
+    // If weights are stored in a kernel, one thread is used per kernel element, otherwise one per postsynaptic neuron
+    return (sg.getMatrixType() & SynapseMatrixWeight::KERNEL) ? sg.getKernelSizeFlattened() : sg.getTrgNeuronGroup()->getNumNeurons();
+}
+//-----------------------------------------------------------------------
 template<typename T>
 size_t getGroupStartIDSize(const std::vector<T> &mergedGroups)
 {
@@ -431,6 +439,21 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                                PostsynapticUpdateGroupMergedHandler postLearnHandler, SynapseDynamicsGroupMergedHandler synapseDynamicsHandler,
                                HostHandler pushEGPHandler) const
 {
+    for(const auto &s : modelMerged.getMergedPresynapticUpdateGroups()) {
+        if(s.getArchetype().isBitmaskRowWordRangeEnabled()) {
+            throw std::runtime_error("The CUDA backend does not currently support bitmask row word ranges");
+        }
+        if(s.getArchetype().isPostsynapticReorderingEnabled()) {
+            throw std::runtime_error("The CUDA backend does not currently support postsynaptic reordering");
+        }
+        if(s.getArchetype().isCompressedSparseIndEnabled()) {
+            throw std::runtime_error("The CUDA backend does not currently support compressed sparse indices");
+        }
+        if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            throw std::runtime_error("The CUDA backend does not currently support CSR connectivity");
+        }
+    }
+
     // Generate data structure for accessing merged groups
     size_t totalConstMem = m_ChosenDevice.totalConstMem;
     genMergedKernelDataStructures(os, m_KernelBlockSizes[KernelPresynapticUpdate], totalConstMem,
@@ -459,6 +482,10 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
 
             // Loop through merged synapse groups
             for(const auto &n : modelMerged.getMergedSynapseDendriticDelayUpdateGroups()) {
+                if(n.getArchetype().isSparseDendriticDelayEnabled()) {
+                    throw std::runtime_error("The CUDA backend does not currently support sparse dendritic delay buffers");
+                }
+
                 os << "// merged" << n.getIndex() << std::endl;
                 if(idPreSynapseReset == 0) {
                     os << "if(id < " << n.getGroups().size() << ")";
@@ -751,6 +778,12 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
     {
         CodeStream::Scope b(os);
 
+#ifdef MPI_ENABLE
+        // Receive spikes emitted by remote neurons and copy them to device
+        // **NOTE** all presynaptic updates are performed in a single kernel so this cannot be overlapped with them
+        os << "mpiCompleteSpikeExchange();" << std::endl;
+#endif
+
         // Push any required EGPs
         pushEGPHandler(os);
 
@@ -799,6 +832,12 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                       SynapseConnectivityInitMergedGroupHandler sgSparseConnectHandler, SynapseSparseInitGroupMergedHandler sgSparseInitHandler,
                       HostHandler initPushEGPHandler, HostHandler initSparsePushEGPHandler) const
 {
+    for(const auto &s : modelMerged.getMergedSynapseConnectivityInitGroups()) {
+        if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            throw std::runtime_error("The CUDA backend does not currently support CSR connectivity");
+        }
+    }
+
     os << "#include <iostream>" << std::endl;
     os << "#include <random>" << std::endl;
     os << "#include <cstdint>" << std::endl;
@@ -812,7 +851,7 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                                   modelMerged.getMergedNeuronInitGroups(), "NeuronInit",
                                   [](const NeuronGroupInternal &ng){ return ng.getNumNeurons(); },
                                   modelMerged.getMergedSynapseDenseInitGroups(), "SynapseDenseInit",
-                                  [](const SynapseGroupInternal &sg){ return sg.getTrgNeuronGroup()->getNumNeurons(); },
+                                  [](const SynapseGroupInternal &sg){ return getNumDenseInitThreads(sg); },
                                   modelMerged.getMergedSynapseConnectivityInitGroups(), "SynapseConnectivityInit",
                                   [](const SynapseGroupInternal &sg){ return sg.getSrcNeuronGroup()->getNumNeurons(); });
 
@@ -883,11 +922,17 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
         os << "// ------------------------------------------------------------------------" << std::endl;
         os << "// Synapse groups with dense connectivity" << std::endl;
         genParallelGroup<SynapseDenseInitGroupMerged>(os, kernelSubs, modelMerged.getMergedSynapseDenseInitGroups(), "SynapseDenseInit", idInitStart,
-            [this](const SynapseGroupInternal &sg){ return padSize(sg.getTrgNeuronGroup()->getNumNeurons(), m_KernelBlockSizes[KernelInitialize]); },
+            [this](const SynapseGroupInternal &sg){ return padSize(getNumDenseInitThreads(sg), m_KernelBlockSizes[KernelInitialize]); },
             [sgDenseInitHandler](CodeStream &os, const SynapseDenseInitGroupMerged &sg, Substitutions &popSubs)
             {
-                os << "// only do this for existing postsynaptic neurons" << std::endl;
-                os << "if(" << popSubs["id"] << " < group.numTrgNeurons)";
+                // If weights are stored in a kernel, only do this for existing kernel elements
+                if(sg.getArchetype().getMatrixType() & SynapseMatrixWeight::KERNEL) {
+                    os << "if(" << popSubs["id"] << " < " << sg.getArchetype().getKernelSizeFlattened() << ")";
+                }
+                else {
+                    os << "// only do this for existing postsynaptic neurons" << std::endl;
+                    os << "if(" << popSubs["id"] << " < group.numTrgNeurons)";
+                }
                 {
                     CodeStream::Scope b(os);
                     // If this post synapse requires an RNG for initialisation,
@@ -942,7 +987,7 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                         }
 
                         // Build function template to set correct bit in bitmask
-                        popSubs.addFuncSubstitution("addSynapse", 1,
+                        popSubs.addFuncSubstitution("addSynapse", 1 + sg.getArchetype().getKernelSize().size(),
                                                     "atomicOr(&group.gp[(rowStartGID + $(0)) / 32], 0x80000000 >> ((rowStartGID + $(0)) & 31))");
                     }
                     // Otherwise, if synapse group has ragged connectivity
@@ -952,7 +997,7 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                         os << rowLength << " = 0;" << std::endl;
 
                         // Build function template to increment row length and insert synapse into ind array
-                        popSubs.addFuncSubstitution("addSynapse", 1,
+                        popSubs.addFuncSubstitution("addSynapse", 1 + sg.getArchetype().getKernelSize().size(),
                                                     "group.ind[(" + popSubs["id"] + " * group.rowStride) + (" + rowLength + "++)] = $(0)");
                     }
                     else {
@@ -1222,8 +1267,24 @@ size_t Backend::getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const
     return getPresynapticUpdateStrategy(sg)->getSynapticMatrixRowStride(sg);
 }
 //--------------------------------------------------------------------------
-void Backend::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &) const
+void Backend::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
 {
+    // **NOTE** groups are updated in parallel within fused kernels so they cannot be timed individually
+    if(modelMerged.getModel().isProfilingEnabled()) {
+        LOGW_BACKEND << "Per-group profiling is not supported by the CUDA backend - use a profiler such as Nsight Systems instead";
+    }
+    if(modelMerged.getModel().isPerfCountersEnabled()) {
+        LOGW_BACKEND << "Hardware performance counters are not supported by the CUDA backend - use a profiler such as Nsight Compute instead";
+    }
+    if(modelMerged.getModel().getBatchSize() != 1) {
+        throw std::runtime_error("Batched models are not supported by the CUDA backend");
+    }
+    if(std::any_of(modelMerged.getModel().getSynapseGroups().cbegin(), modelMerged.getModel().getSynapseGroups().cend(),
+                   [&modelMerged](const ModelSpec::SynapseGroupValueType &s){ return modelMerged.getModel().isConnectivityCacheRequired(s.second); }))
+    {
+        LOGW_BACKEND << "Connectivity caching is not supported by the CUDA backend - connectivity will be built on the device every run";
+    }
+
     os << "// Standard C++ includes" << std::endl;
     os << "#include <random>" << std::endl;
     os << "#include <string>" << std::endl;
@@ -1435,6 +1496,9 @@ void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerg
         }
     }
     os << std::endl;
+
+    genDiscreteDistributions(os, "__device__ inline", "Float", "float", "RNG *rng", "curand_uniform(rng)");
+    genDiscreteDistributions(os, "__device__ inline", "Double", "double", "RNG *rng", "curand_uniform_double(rng)");
 }
 //--------------------------------------------------------------------------
 void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &) const
@@ -1487,6 +1551,10 @@ void Backend::genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &mode
     os << std::endl;
 }
 //--------------------------------------------------------------------------
+void Backend::genFreeMemPreamble(CodeStream &, const ModelSpecMerged &) const
+{
+}
+//--------------------------------------------------------------------------
 void Backend::genStepTimeFinalisePreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
 {
     // Synchronise if automatic copying or zero-copy are in use
@@ -1751,9 +1819,18 @@ void Backend::genVariableInit(CodeStream &os, const std::string &, const std::st
     handler(os, varSubs);
 }
 //--------------------------------------------------------------------------
-void Backend::genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMergedBase &,
+void Backend::genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMergedBase &sg,
                                         const Substitutions &kernelSubs, Handler handler) const
 {
+    // If weights are stored in a kernel, each thread initialises one kernel element
+    if(sg.getArchetype().getMatrixType() & SynapseMatrixWeight::KERNEL) {
+        Substitutions varSubs(&kernelSubs);
+        varSubs.addVarSubstitution("id_kernel", kernelSubs["id"]);
+        varSubs.addVarSubstitution("id_syn", kernelSubs["id"]);
+        handler(os, varSubs);
+        return;
+    }
+
     // Pre and postsynaptic ID should already be provided via parallelism
     assert(kernelSubs.hasVarSubstitution("id_pre"));
     assert(kernelSubs.hasVarSubstitution("id_post"));
@@ -1828,7 +1905,74 @@ void Backend::genCurrentVariablePull(CodeStream &os, const NeuronGroupInternal &
     }
 }
 //--------------------------------------------------------------------------
-MemAlloc Backend::genGlobalDeviceRNG(CodeStream &, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &, CodeStream &) const
+void Backend::genArrayStateSave(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, const std::string &count) const
+{
+    // If variable is accessible on host, make sure host copy is up to date and write it
+    if(m_Preferences.automaticCopy || (loc & VarLocation::HOST)) {
+        if(m_Preferences.automaticCopy || (loc & VarLocation::ZERO_COPY)) {
+            os << "CHECK_CUDA_ERRORS(cudaDeviceSynchronize());" << std::endl;
+        }
+        else {
+            os << "CHECK_CUDA_ERRORS(cudaMemcpy(" << name << ", d_" << name << ", " << count << " * sizeof(" << type << "), cudaMemcpyDeviceToHost));" << std::endl;
+        }
+        os << "writeStateSection(stateFile, " << name << ", " << count << " * sizeof(" << type << "));" << std::endl;
+    }
+    // Otherwise, copy device state into temporary buffer and write that
+    else {
+        CodeStream::Scope b(os);
+        os << "std::vector<char> stateBuffer(" << count << " * sizeof(" << type << "));" << std::endl;
+        os << "CHECK_CUDA_ERRORS(cudaMemcpy(stateBuffer.data(), d_" << name << ", stateBuffer.size(), cudaMemcpyDeviceToHost));" << std::endl;
+        os << "writeStateSection(stateFile, stateBuffer.data(), stateBuffer.size());" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genArrayStateLoad(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, const std::string &count) const
+{
+    // If variable is accessible on host, read into host copy and push to device
+    if(m_Preferences.automaticCopy || (loc & VarLocation::HOST)) {
+        os << "readStateSection(stateFile, " << name << ", " << count << " * sizeof(" << type << "));" << std::endl;
+        if(!m_Preferences.automaticCopy && !(loc & VarLocation::ZERO_COPY)) {
+            os << "CHECK_CUDA_ERRORS(cudaMemcpy(d_" << name << ", " << name << ", " << count << " * sizeof(" << type << "), cudaMemcpyHostToDevice));" << std::endl;
+        }
+    }
+    // Otherwise, read into temporary buffer and copy to device
+    else {
+        CodeStream::Scope b(os);
+        os << "std::vector<char> stateBuffer(" << count << " * sizeof(" << type << "));" << std::endl;
+        os << "readStateSection(stateFile, stateBuffer.data(), stateBuffer.size());" << std::endl;
+        os << "CHECK_CUDA_ERRORS(cudaMemcpy(d_" << name << ", stateBuffer.data(), stateBuffer.size(), cudaMemcpyHostToDevice));" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genScalarStateSave(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const
+{
+    // **NOTE** host copies of scalars are kept in sync with the device
+    if(loc & VarLocation::HOST) {
+        os << "writeStateSection(stateFile, &" << name << ", sizeof(" << type << "));" << std::endl;
+    }
+    else {
+        CodeStream::Scope b(os);
+        os << type << " stateValue;" << std::endl;
+        os << "CHECK_CUDA_ERRORS(cudaMemcpyFromSymbol(&stateValue, d_" << name << ", sizeof(" << type << ")));" << std::endl;
+        os << "writeStateSection(stateFile, &stateValue, sizeof(" << type << "));" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genScalarStateLoad(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc) const
+{
+    CodeStream::Scope b(os);
+    os << type << " stateValue;" << std::endl;
+    os << "readStateSection(stateFile, &stateValue, sizeof(" << type << "));" << std::endl;
+    if(loc & VarLocation::HOST) {
+        os << name << " = stateValue;" << std::endl;
+    }
+    if(loc & VarLocation::DEVICE) {
+        os << "CHECK_CUDA_ERRORS(cudaMemcpyToSymbol(d_" << name << ", &stateValue, sizeof(" << type << ")));" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+MemAlloc Backend::genGlobalDeviceRNG(CodeStream &, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &, CodeStream &,
+                                     CodeStream &saveState, CodeStream &loadState) const
 {
     // Define global Phillox RNG
     // **NOTE** this is actually accessed as a global so, unlike other variables, needs device global
@@ -1837,13 +1981,17 @@ MemAlloc Backend::genGlobalDeviceRNG(CodeStream &, CodeStream &definitionsIntern
     // Implement global Phillox RNG
     runner << "__device__ curandStatePhilox4_32_10_t d_rng;" << std::endl;
 
+    // Save and load RNG state via device symbol
+    genScalarStateSaveLoad(saveState, loadState, "curandStatePhilox4_32_10_t", "rng", VarLocation::DEVICE);
+
     return MemAlloc::device(getSize("curandStatePhilox4_32_10_t"));
 }
 //--------------------------------------------------------------------------
 MemAlloc Backend::genPopulationRNG(CodeStream &definitions, CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
-                                   const std::string &name, size_t count) const
+                                   CodeStream &saveState, CodeStream &loadState, const std::string &name, size_t count) const
 {
     // Create an array or XORWOW RNGs
+    genArrayStateSaveLoad(saveState, loadState, "curandState", name, VarLocation::DEVICE, count);
     return genArray(definitions, definitionsInternal, runner, allocations, free, "curandState", name, VarLocation::DEVICE, count);
 }
 //--------------------------------------------------------------------------
@@ -2090,7 +2238,7 @@ size_t Backend::getNumInitialisationRNGStreams(const ModelSpecMerged &modelMerge
     numInitThreads += getNumMergedGroupThreads(modelMerged.getMergedSynapseDenseInitGroups(),
                                                [this](const SynapseGroupInternal &sg)
                                                {
-                                                   return padSize(sg.getTrgNeuronGroup()->getNumNeurons(), getKernelBlockSize(Kernel::KernelInitialize));
+                                                   return padSize(getNumDenseInitThreads(sg), getKernelBlockSize(Kernel::KernelInitialize));
                                                });
 
     // Add on total number of threads used for synapse connectivity initialisation
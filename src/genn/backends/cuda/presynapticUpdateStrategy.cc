@@ -171,7 +171,7 @@ void PreSpan::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, cons
         }
         os << "const unsigned int npost = group.rowLength[preInd];" << std::endl;
 
-        if (!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+        if (!trueSpike && sg.getArchetype().isEventThresholdConditionMaskRequired()) {
             os << "if(";
 
             Substitutions threshSubs(&popSubs);
@@ -223,7 +223,7 @@ void PreSpan::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, cons
             wumSimHandler(os, sg, synSubs);
         }
 
-        if (!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+        if (!trueSpike && sg.getArchetype().isEventThresholdConditionMaskRequired()) {
             os << CodeStream::CB(130);
         }
     }
@@ -352,7 +352,7 @@ void PostSpan::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, con
                 if (!wu->getSimSupportCode().empty()) {
                     os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) <<  ";" << std::endl;
                 }
-                if (!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+                if (!trueSpike && sg.getArchetype().isEventThresholdConditionMaskRequired()) {
                     os << "if(";
                     if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
                         // Note: we will just access global mem. For compute >= 1.2 simultaneous access to same global mem in the (half-)warp will be coalesced - no worries
@@ -418,7 +418,7 @@ void PostSpan::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, con
                     os << CodeStream::CB(140); // end if (id < npost)
                 }
 
-                if (!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+                if (!trueSpike && sg.getArchetype().isEventThresholdConditionMaskRequired()) {
                     os << CodeStream::CB(130); // end if (eCode)
                 }
                 else if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
@@ -479,10 +479,11 @@ size_t PreSpanProcedural::getSynapticMatrixRowStride(const SynapseGroupInternal
 bool PreSpanProcedural::isCompatible(const SynapseGroupInternal &sg, const cudaDeviceProp &, const Preferences &) const
 {
     // Presynaptic procedural parallelism can be used when synapse groups have 
-    // procedural connectivity and weights are either GLOBAL or PROCEDURAL
+    // procedural connectivity and weights are either GLOBAL, PROCEDURAL or KERNEL
     const auto matrixType = sg.getMatrixType();
     return ((matrixType & SynapseMatrixConnectivity::PROCEDURAL)
-            && ((matrixType & SynapseMatrixWeight::GLOBAL) || (matrixType & SynapseMatrixWeight::PROCEDURAL)));
+            && ((matrixType & SynapseMatrixWeight::GLOBAL) || (matrixType & SynapseMatrixWeight::PROCEDURAL)
+                || (matrixType & SynapseMatrixWeight::KERNEL)));
 }
 //----------------------------------------------------------------------------
 size_t PreSpanProcedural::getSharedMemoryPerThread(const PresynapticUpdateGroupMerged &sg, const Backend &backend) const
@@ -555,7 +556,7 @@ void PreSpanProcedural::genUpdate(CodeStream &os, const ModelSpecMerged &modelMe
             os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) <<  ";" << std::endl;
         }
 
-        if (!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+        if (!trueSpike && sg.getArchetype().isEventThresholdConditionMaskRequired()) {
             os << "if(";
 
             // Generate weight update threshold condition
@@ -621,6 +622,11 @@ void PreSpanProcedural::genUpdate(CodeStream &os, const ModelSpecMerged &modelMe
         // going to be, in turn, substituted into procedural connectivity generation code
         presynapticUpdateSubs.addVarSubstitution("id_post", "$(0)");
 
+        // If weights are stored in a kernel, calculate index from the kernel coordinates passed as subsequent parameters
+        if(sg.getArchetype().getMatrixType() & SynapseMatrixWeight::KERNEL) {
+            presynapticUpdateSubs.addVarSubstitution("id_kernel", sg.getKernelIndex());
+        }
+
         // If dendritic delay is required, always use atomic operation to update dendritic delay buffer
         if(sg.getArchetype().isDendriticDelayRequired()) {
             presynapticUpdateSubs.addFuncSubstitution("addToInSynDelay", 2, backend.getFloatAtomicAdd(model.getPrecision()) + "(&group.denDelay[" + sg.getDendriticDelayOffset("$(1)") + "$(id_post)], $(0))");
@@ -643,12 +649,12 @@ void PreSpanProcedural::genUpdate(CodeStream &os, const ModelSpecMerged &modelMe
         wumSimHandler(presynapticUpdate, sg, presynapticUpdateSubs);
 
         // When a synapse should be 'added', substitute in presynaptic update code
-        connSubs.addFuncSubstitution("addSynapse", 1, presynapticUpdateStream.str());
+        connSubs.addFuncSubstitution("addSynapse", 1 + sg.getArchetype().getKernelSize().size(), presynapticUpdateStream.str());
 
         // Generate procedural connectivity code
         wumProceduralConnectHandler(os, sg, connSubs);
 
-        if (!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+        if (!trueSpike && sg.getArchetype().isEventThresholdConditionMaskRequired()) {
             os << CodeStream::CB(130);
         }
     }
@@ -756,7 +762,7 @@ void PostSpanBitmask::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerg
                 if (!wu->getSimSupportCode().empty()) {
                     os << "using namespace " << modelMerged.getPresynapticUpdateSupportCodeNamespace(wu->getSimSupportCode()) <<  ";" << std::endl;
                 }
-                if (!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+                if (!trueSpike && sg.getArchetype().isEventThresholdConditionMaskRequired()) {
                     os << "if(";
 
                     Substitutions threshSubs(&popSubs);
@@ -804,7 +810,7 @@ void PostSpanBitmask::genUpdate(CodeStream &os, const ModelSpecMerged &modelMerg
                 }
 
 
-                if (!trueSpike && sg.getArchetype().isEventThresholdReTestRequired()) {
+                if (!trueSpike && sg.getArchetype().isEventThresholdConditionMaskRequired()) {
                     os << CodeStream::CB(130); // end if (eCode)
                 }
             }
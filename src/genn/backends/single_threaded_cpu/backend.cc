@@ -1,5 +1,11 @@
 #include "backend.h"
 
+// Standard C++ includes
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <vector>
+
 // GeNN includes
 #include "gennUtils.h"
 
@@ -16,12 +22,17 @@ using namespace CodeGenerator;
 //--------------------------------------------------------------------------
 namespace
 {
+//! Number of logarithmic bins in histograms of the time taken to update each group when profiling
+const unsigned int profileHistogramBins = 32;
+
 const std::vector<Substitutions::FunctionTemplate> cpuFunctions = {
     {"gennrand_uniform", 0, "standardUniformDistribution($(rng))", "standardUniformDistribution($(rng))"},
     {"gennrand_normal", 0, "standardNormalDistribution($(rng))", "standardNormalDistribution($(rng))"},
     {"gennrand_exponential", 0, "standardExponentialDistribution($(rng))", "standardExponentialDistribution($(rng))"},
     {"gennrand_log_normal", 2, "std::lognormal_distribution<double>($(0), $(1))($(rng))", "std::lognormal_distribution<float>($(0), $(1))($(rng))"},
-    {"gennrand_gamma", 1, "std::gamma_distribution<double>($(0), 1.0)($(rng))", "std::gamma_distribution<float>($(0), 1.0f)($(rng))"}
+    {"gennrand_gamma", 1, "std::gamma_distribution<double>($(0), 1.0)($(rng))", "std::gamma_distribution<float>($(0), 1.0f)($(rng))"},
+    {"gennrand_poisson", 1, "poissonDist($(rng), $(0))", "poissonDist($(rng), $(0))"},
+    {"gennrand_binomial", 2, "binomialDist($(rng), $(0), $(1))", "binomialDist($(rng), $(0), $(1))"}
 };
 
 //--------------------------------------------------------------------------
@@ -30,17 +41,28 @@ const std::vector<Substitutions::FunctionTemplate> cpuFunctions = {
 class Timer
 {
 public:
-    Timer(CodeStream &codeStream, const std::string &name, bool timingEnabled)
-    :   m_CodeStream(codeStream), m_Name(name), m_TimingEnabled(timingEnabled)
+    Timer(CodeStream &codeStream, const std::string &name, bool timingEnabled, bool perfCountersEnabled)
+    :   m_CodeStream(codeStream), m_Name(name), m_TimingEnabled(timingEnabled), m_PerfCountersEnabled(perfCountersEnabled)
     {
         // Record start event
         if(m_TimingEnabled) {
             m_CodeStream << "const auto " << m_Name << "Start = std::chrono::high_resolution_clock::now();" << std::endl;
         }
+
+        // Read hardware performance counters
+        if(m_PerfCountersEnabled) {
+            m_CodeStream << "uint64_t " << m_Name << "PerfCountersStart[4];" << std::endl;
+            m_CodeStream << "readPerfCounters(" << m_Name << "PerfCountersStart);" << std::endl;
+        }
     }
 
     ~Timer()
     {
+        // Accumulate hardware performance counters
+        if(m_PerfCountersEnabled) {
+            m_CodeStream << "accumulatePerfCounters(" << m_Name << "PerfCounters, " << m_Name << "PerfCountersStart);" << std::endl;
+        }
+
         // Record stop event
         if(m_TimingEnabled) {
             m_CodeStream << m_Name << "Time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - " << m_Name << "Start).count();" << std::endl;
@@ -54,8 +76,572 @@ private:
     CodeStream &m_CodeStream;
     const std::string m_Name;
     const bool m_TimingEnabled;
+    const bool m_PerfCountersEnabled;
+};
+
+//--------------------------------------------------------------------------
+// ProfileTimer
+//--------------------------------------------------------------------------
+class ProfileTimer
+{
+public:
+    ProfileTimer(CodeStream &codeStream, const std::string &name, const std::string &region, const ModelSpecInternal &model)
+    :   m_CodeStream(codeStream), m_Name(name), m_Region(region), m_ProfilingEnabled(model.isProfilingEnabled()),
+        m_PerfCountersEnabled(model.isPerfCountersEnabled())
+    {
+        // Record start time
+        if(m_ProfilingEnabled) {
+            m_CodeStream << "const auto " << m_Name << "Start = std::chrono::high_resolution_clock::now();" << std::endl;
+
+            // Read hardware performance counters
+            if(m_PerfCountersEnabled) {
+                m_CodeStream << "uint64_t " << m_Name << "PerfCountersStart[4];" << std::endl;
+                m_CodeStream << "readPerfCounters(" << m_Name << "PerfCountersStart);" << std::endl;
+            }
+        }
+    }
+
+    ~ProfileTimer()
+    {
+        // Record time taken in region and, if enabled, hardware performance counters
+        if(m_ProfilingEnabled) {
+            m_CodeStream << "recordProfileRegion(" << m_Region << ", " << m_Name << "Start";
+            if(m_PerfCountersEnabled) {
+                m_CodeStream << ", " << m_Name << "PerfCountersStart";
+            }
+            m_CodeStream << ");" << std::endl;
+        }
+    }
+
+private:
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    CodeStream &m_CodeStream;
+    const std::string m_Name;
+    const std::string m_Region;
+    const bool m_ProfilingEnabled;
+    const bool m_PerfCountersEnabled;
+};
+
+//--------------------------------------------------------------------------
+// ProfileRegions
+//--------------------------------------------------------------------------
+//! Layout of regions timed when profiling is enabled - the region of each
+//! merged group is followed by the regions of each of the groups merged into it
+class ProfileRegions
+{
+public:
+    struct Region
+    {
+        std::string name;
+        std::string phase;
+        int parent;
+    };
+
+    ProfileRegions(const ModelSpecMerged &modelMerged) : m_BatchSize(modelMerged.getModel().getBatchSize())
+    {
+        addMergedGroups("neuronUpdate", "NeuronUpdate", modelMerged.getMergedNeuronUpdateGroups());
+        addMergedGroups("synapseDynamics", "SynapseDynamics", modelMerged.getMergedSynapseDynamicsGroups());
+        addMergedGroups("presynapticUpdate", "PresynapticUpdate", modelMerged.getMergedPresynapticUpdateGroups());
+        addMergedGroups("postsynapticUpdate", "PostsynapticUpdate", modelMerged.getMergedPostsynapticUpdateGroups());
+    }
+
+    //! Get index of region used to time merged group
+    size_t getMergedGroupRegion(const std::string &phase, size_t index) const{ return m_MergedGroupRegions.at(std::make_pair(phase, index)); }
+
+    //! Get expression for index of region used to time group g of merged group
+    /*! **NOTE** in batched models, all instances of a group are timed in the same region */
+    std::string getGroupRegion(const std::string &phase, size_t index) const
+    {
+        const std::string group = (m_BatchSize == 1) ? "g" : ("(g / " + std::to_string(m_BatchSize) + ")");
+        return std::to_string(getMergedGroupRegion(phase, index) + 1) + " + " + group;
+    }
+
+    const std::vector<Region> &getRegions() const{ return m_Regions; }
+
+private:
+    template<typename G>
+    void addMergedGroups(const std::string &phase, const std::string &name, const std::vector<G> &mergedGroups)
+    {
+        for(const auto &m : mergedGroups) {
+            const int mergedRegion = (int)m_Regions.size();
+            m_MergedGroupRegions.emplace(std::make_pair(phase, m.getIndex()), m_Regions.size());
+            m_Regions.push_back({"merged" + name + "Group" + std::to_string(m.getIndex()), phase, -1});
+            for(const auto &g : m.getGroups()) {
+                m_Regions.push_back({g.get().getName(), phase, mergedRegion});
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    const unsigned int m_BatchSize;
+    std::vector<Region> m_Regions;
+    std::map<std::pair<std::string, size_t>, size_t> m_MergedGroupRegions;
 };
+
+//--------------------------------------------------------------------------
+//! Size of the huge pages large arrays are aligned to
+const size_t hugePageBytes = 2 * 1024 * 1024;
+
+//--------------------------------------------------------------------------
+//! Get number of bytes actually allocated for array using policy
+//! **NOTE** this must match the padding applied by the generated allocateHostArray function
+size_t getAllocatedBytes(size_t bytes, const SingleThreadedCPU::AllocationPolicy &policy)
+{
+    if(policy.alignment == 0) {
+        return bytes;
+    }
+    else {
+        const bool hugePages = (policy.hugePageThreshold > 0 && bytes >= policy.hugePageThreshold);
+        const size_t alignment = hugePages ? hugePageBytes : policy.alignment;
+        return std::max(alignment, padSize(bytes, alignment));
+    }
+}
+//--------------------------------------------------------------------------
+void genHostArrayAllocation(CodeStream &os)
+{
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// host array allocation" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "#ifdef _WIN32" << std::endl;
+    os << "#include <malloc.h>" << std::endl;
+    os << "#else" << std::endl;
+    os << "#include <cstdlib>" << std::endl;
+    os << "#endif" << std::endl;
+    os << "#ifdef __linux__" << std::endl;
+    os << "#include <sys/mman.h>" << std::endl;
+    os << "#endif" << std::endl;
+    os << std::endl;
+
+    os << "void *allocateHostArray(size_t bytes, size_t alignment, size_t hugePageThreshold, bool firstTouch)";
+    {
+        CodeStream::Scope b(os);
+
+        // **NOTE** padding to a multiple of the alignment means huge pages are never shared with other arrays
+        os << "const bool hugePages = (hugePageThreshold > 0 && bytes >= hugePageThreshold);" << std::endl;
+        os << "if(hugePages)";
+        {
+            CodeStream::Scope b(os);
+            os << "alignment = " << hugePageBytes << ";" << std::endl;
+        }
+        os << "bytes = std::max(alignment, ((bytes + alignment - 1) / alignment) * alignment);" << std::endl;
+        os << "#ifdef _WIN32" << std::endl;
+        os << "void *ptr = _aligned_malloc(bytes, alignment);" << std::endl;
+        os << "#else" << std::endl;
+        os << "void *ptr = nullptr;" << std::endl;
+        os << "if(posix_memalign(&ptr, alignment, bytes) != 0)";
+        {
+            CodeStream::Scope b(os);
+            os << "ptr = nullptr;" << std::endl;
+        }
+        os << "#endif" << std::endl;
+        os << "if(ptr == nullptr)";
+        {
+            CodeStream::Scope b(os);
+            os << "throw std::runtime_error(\"Unable to allocate \" + std::to_string(bytes) + \" byte host array\");" << std::endl;
+        }
+        os << "#ifdef MADV_HUGEPAGE" << std::endl;
+        os << "if(hugePages)";
+        {
+            CodeStream::Scope b(os);
+            os << "madvise(ptr, bytes, MADV_HUGEPAGE);" << std::endl;
+        }
+        os << "#endif" << std::endl;
+
+        // Touch memory from allocating thread so, on NUMA systems, pages are placed on its node
+        os << "if(firstTouch)";
+        {
+            CodeStream::Scope b(os);
+            os << "std::memset(ptr, 0, bytes);" << std::endl;
+        }
+        os << "return ptr;" << std::endl;
+    }
+    os << std::endl;
+
+    os << "void freeHostArray(void *ptr)";
+    {
+        CodeStream::Scope b(os);
+        os << "#ifdef _WIN32" << std::endl;
+        os << "_aligned_free(ptr);" << std::endl;
+        os << "#else" << std::endl;
+        os << "free(ptr);" << std::endl;
+        os << "#endif" << std::endl;
+    }
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void genPerfCounters(CodeStream &os)
+{
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// hardware performance counters" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "#ifdef __linux__" << std::endl;
+    os << "#include <linux/perf_event.h>" << std::endl;
+    os << "#include <sys/ioctl.h>" << std::endl;
+    os << "#include <sys/syscall.h>" << std::endl;
+    os << "#include <unistd.h>" << std::endl;
+    os << "#endif" << std::endl;
+    os << std::endl;
+    os << "namespace";
+    {
+        CodeStream::Scope b(os);
+        os << "int perfCounterFDs[4] = {-1, -1, -1, -1};" << std::endl;
+    }
+    os << std::endl;
+
+    // **NOTE** counters are opened as a group so they are scheduled together and can all be read with a single system call
+    os << "void openPerfCounters()";
+    {
+        CodeStream::Scope b(os);
+        os << "#ifdef __linux__" << std::endl;
+        os << "if(perfCounterFDs[0] != -1)";
+        {
+            CodeStream::Scope b(os);
+            os << "return;" << std::endl;
+        }
+        os << "const uint64_t configs[4] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};" << std::endl;
+        os << "for(unsigned int i = 0; i < 4; i++)";
+        {
+            CodeStream::Scope b(os);
+            os << "perf_event_attr attr;" << std::endl;
+            os << "std::memset(&attr, 0, sizeof(perf_event_attr));" << std::endl;
+            os << "attr.type = PERF_TYPE_HARDWARE;" << std::endl;
+            os << "attr.size = sizeof(perf_event_attr);" << std::endl;
+            os << "attr.config = configs[i];" << std::endl;
+            os << "attr.disabled = (i == 0) ? 1 : 0;" << std::endl;
+            os << "attr.exclude_kernel = 1;" << std::endl;
+            os << "attr.exclude_hv = 1;" << std::endl;
+            os << "attr.read_format = PERF_FORMAT_GROUP;" << std::endl;
+            os << "perfCounterFDs[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, perfCounterFDs[0], 0);" << std::endl;
+            os << std::endl;
+            os << "// If counter can't be opened e.g. due to perf_event_paranoid setting or virtualisation, close any others" << std::endl;
+            os << "if(perfCounterFDs[i] == -1)";
+            {
+                CodeStream::Scope b(os);
+                os << "std::cerr << \"Warning: cannot open hardware performance counters - counters will not be recorded\" << std::endl;" << std::endl;
+                os << "for(unsigned int j = 0; j < i; j++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "close(perfCounterFDs[j]);" << std::endl;
+                    os << "perfCounterFDs[j] = -1;" << std::endl;
+                }
+                os << "return;" << std::endl;
+            }
+        }
+        os << "ioctl(perfCounterFDs[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);" << std::endl;
+        os << "ioctl(perfCounterFDs[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);" << std::endl;
+        os << "#endif" << std::endl;
+    }
+    os << std::endl;
+
+    // **NOTE** counters are reset so re-opening after freeMem doesn't leak file descriptors
+    os << "void closePerfCounters()";
+    {
+        CodeStream::Scope b(os);
+        os << "#ifdef __linux__" << std::endl;
+        os << "for(unsigned int i = 0; i < 4; i++)";
+        {
+            CodeStream::Scope b(os);
+            os << "if(perfCounterFDs[i] != -1)";
+            {
+                CodeStream::Scope b(os);
+                os << "close(perfCounterFDs[i]);" << std::endl;
+                os << "perfCounterFDs[i] = -1;" << std::endl;
+            }
+        }
+        os << "#endif" << std::endl;
+    }
+    os << std::endl;
+
+    os << "void readPerfCounters(uint64_t *counters)";
+    {
+        CodeStream::Scope b(os);
+        os << "#ifdef __linux__" << std::endl;
+        os << "// Group is read as the number of counters followed by their values" << std::endl;
+        os << "uint64_t values[5];" << std::endl;
+        os << "if(perfCounterFDs[0] != -1 && read(perfCounterFDs[0], values, sizeof(values)) == sizeof(values))";
+        {
+            CodeStream::Scope b(os);
+            os << "std::copy_n(&values[1], 4, counters);" << std::endl;
+            os << "return;" << std::endl;
+        }
+        os << "#endif" << std::endl;
+        os << "std::fill_n(counters, 4, 0);" << std::endl;
+    }
+    os << std::endl;
+
+    os << "void accumulatePerfCounters(unsigned long long *totals, const uint64_t *start)";
+    {
+        CodeStream::Scope b(os);
+        os << "uint64_t end[4];" << std::endl;
+        os << "readPerfCounters(end);" << std::endl;
+        os << "for(unsigned int i = 0; i < 4; i++)";
+        {
+            CodeStream::Scope b(os);
+            os << "totals[i] += (unsigned long long)(end[i] - start[i]);" << std::endl;
+        }
+    }
+    os << std::endl;
+    os << "bool arePerfCountersAvailable(){ return (perfCounterFDs[0] != -1); }" << std::endl;
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+void genProfiler(CodeStream &os, const ModelSpecMerged &modelMerged)
+{
+    const ProfileRegions profileRegions(modelMerged);
+    const auto &regions = profileRegions.getRegions();
+    const bool perfCountersEnabled = modelMerged.getModel().isPerfCountersEnabled();
+
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// profiling" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "namespace";
+    {
+        CodeStream::Scope b(os);
+        os << "struct ProfileRegion";
+        {
+            CodeStream::Scope b(os);
+            os << "const char *name;" << std::endl;
+            os << "const char *phase;" << std::endl;
+            os << "int parent;" << std::endl;
+            os << "unsigned long long count;" << std::endl;
+            os << "double totalTime;" << std::endl;
+            os << "double minTime;" << std::endl;
+            os << "double maxTime;" << std::endl;
+            os << "unsigned long long histogram[" << profileHistogramBins << "];" << std::endl;
+            os << "unsigned long long perfCounters[4];" << std::endl;
+        }
+        os << ";" << std::endl;
+        os << std::endl;
+        os << "struct ProfileEvent";
+        {
+            CodeStream::Scope b(os);
+            os << "unsigned int region;" << std::endl;
+            os << "double start;" << std::endl;
+            os << "double duration;" << std::endl;
+        }
+        os << ";" << std::endl;
+        os << std::endl;
+
+        // **NOTE** one extra, unused, region is allocated so array is never empty
+        os << "ProfileRegion profileRegions[" << regions.size() + 1 << "] = ";
+        {
+            CodeStream::Scope b(os);
+            for(const auto &r : regions) {
+                os << "{\"" << r.name << "\", \"" << r.phase << "\", " << r.parent << ", 0, 0.0, 0.0, 0.0, {}, {}}," << std::endl;
+            }
+            os << "{\"\", \"\", -1, 0, 0.0, 0.0, 0.0, {}, {}}" << std::endl;
+        }
+        os << ";" << std::endl;
+        os << "std::vector<ProfileEvent> profileTrace;" << std::endl;
+        os << "unsigned long long profileTraceCapacity = 1048576;" << std::endl;
+        os << "const auto profileEpoch = std::chrono::high_resolution_clock::now();" << std::endl;
+    }
+    os << std::endl;
+
+    os << "void recordProfileRegion(unsigned int region, std::chrono::high_resolution_clock::time_point start" << (perfCountersEnabled ? ", const uint64_t *perfCountersStart)" : ")");
+    {
+        CodeStream::Scope b(os);
+        os << "ProfileRegion &r = profileRegions[region];" << std::endl;
+        if(perfCountersEnabled) {
+            os << "accumulatePerfCounters(r.perfCounters, perfCountersStart);" << std::endl;
+        }
+        os << "const double duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();" << std::endl;
+        os << "r.minTime = (r.count == 0) ? duration : std::min(r.minTime, duration);" << std::endl;
+        os << "r.maxTime = (r.count == 0) ? duration : std::max(r.maxTime, duration);" << std::endl;
+        os << "r.count++;" << std::endl;
+        os << "r.totalTime += duration;" << std::endl;
+        os << std::endl;
+        os << "// Histogram bin b counts durations between 2^b and 2^(b+1) nanoseconds" << std::endl;
+        os << "const uint64_t durationNs = (uint64_t)(duration * 1E9);" << std::endl;
+        os << "const int bin = (durationNs == 0) ? 0 : (63 - gennCLZ64(durationNs));" << std::endl;
+        os << "r.histogram[std::min(bin, " << profileHistogramBins - 1 << ")]++;" << std::endl;
+        os << std::endl;
+        os << "// Add event to trace if there's space" << std::endl;
+        os << "if(profileTrace.size() < profileTraceCapacity)";
+        {
+            CodeStream::Scope b(os);
+            os << "profileTrace.push_back({region, std::chrono::duration<double>(start - profileEpoch).count(), duration});" << std::endl;
+        }
+    }
+    os << std::endl;
+
+    os << "void resetProfile()";
+    {
+        CodeStream::Scope b(os);
+        os << "for(unsigned int i = 0; i < " << regions.size() << "; i++)";
+        {
+            CodeStream::Scope b(os);
+            os << "ProfileRegion &r = profileRegions[i];" << std::endl;
+            os << "r.count = 0;" << std::endl;
+            os << "r.totalTime = r.minTime = r.maxTime = 0.0;" << std::endl;
+            os << "std::fill_n(r.histogram, " << profileHistogramBins << ", 0);" << std::endl;
+            os << "std::fill_n(r.perfCounters, 4, 0);" << std::endl;
+        }
+        os << "profileTrace.clear();" << std::endl;
+    }
+    os << std::endl;
+    os << "void setProfileTraceCapacity(unsigned long long capacity){ profileTraceCapacity = capacity; }" << std::endl;
+    os << "unsigned int getProfileNumRegions(){ return " << regions.size() << "; }" << std::endl;
+    os << "const char *getProfileRegionName(unsigned int region){ return profileRegions[region].name; }" << std::endl;
+    os << "const char *getProfileRegionPhase(unsigned int region){ return profileRegions[region].phase; }" << std::endl;
+    os << "int getProfileRegionParent(unsigned int region){ return profileRegions[region].parent; }" << std::endl;
+    os << "unsigned long long getProfileRegionCount(unsigned int region){ return profileRegions[region].count; }" << std::endl;
+    os << "double getProfileRegionTotalTime(unsigned int region){ return profileRegions[region].totalTime; }" << std::endl;
+    os << "double getProfileRegionMinTime(unsigned int region){ return profileRegions[region].minTime; }" << std::endl;
+    os << "double getProfileRegionMaxTime(unsigned int region){ return profileRegions[region].maxTime; }" << std::endl;
+    os << "unsigned int getProfileNumHistogramBins(){ return " << profileHistogramBins << "; }" << std::endl;
+    os << "unsigned long long getProfileRegionHistogram(unsigned int region, unsigned int bin){ return profileRegions[region].histogram[bin]; }" << std::endl;
+    os << "unsigned long long getProfileRegionPerfCounter(unsigned int region, unsigned int counter){ return profileRegions[region].perfCounters[counter]; }" << std::endl;
+    os << std::endl;
+
+    // Write trace in Chrome trace event format with complete events, times in microseconds
+    os << "void writeProfileTrace(const char *path)";
+    {
+        CodeStream::Scope b(os);
+        os << "FILE *traceFile = std::fopen(path, \"w\");" << std::endl;
+        os << "if(traceFile == nullptr)";
+        {
+            CodeStream::Scope b(os);
+            os << "throw std::runtime_error(std::string(\"Cannot open profile trace file '\") + path + \"'\");" << std::endl;
+        }
+        os << "std::fprintf(traceFile, \"{\\\"displayTimeUnit\\\": \\\"ms\\\", \\\"traceEvents\\\": [\");" << std::endl;
+        os << "for(size_t i = 0; i < profileTrace.size(); i++)";
+        {
+            CodeStream::Scope b(os);
+            os << "const ProfileEvent &e = profileTrace[i];" << std::endl;
+            os << "const ProfileRegion &r = profileRegions[e.region];" << std::endl;
+            os << "std::fprintf(traceFile, \"%s\\n{\\\"name\\\": \\\"%s\\\", \\\"cat\\\": \\\"%s\\\", \\\"ph\\\": \\\"X\\\", \\\"pid\\\": 0, \\\"tid\\\": 0, \\\"ts\\\": %.3f, \\\"dur\\\": %.3f}\",";
+            os << " (i == 0) ? \"\" : \",\", r.name, r.phase, e.start * 1E6, e.duration * 1E6);" << std::endl;
+        }
+        os << "std::fprintf(traceFile, \"\\n]}\\n\");" << std::endl;
+        os << "std::fclose(traceFile);" << std::endl;
+    }
+    os << std::endl;
+
+    // Write summary with merged groups sorted by total time, each followed by its groups sorted by total time
+    os << "void writeProfileSummary(const char *path)";
+    {
+        CodeStream::Scope b(os);
+        os << "FILE *summaryFile = std::fopen(path, \"w\");" << std::endl;
+        os << "if(summaryFile == nullptr)";
+        {
+            CodeStream::Scope b(os);
+            os << "throw std::runtime_error(std::string(\"Cannot open profile summary file '\") + path + \"'\");" << std::endl;
+        }
+        os << "std::vector<unsigned int> order(" << regions.size() << ");" << std::endl;
+        os << "for(unsigned int i = 0; i < order.size(); i++)";
+        {
+            CodeStream::Scope b(os);
+            os << "order[i] = i;" << std::endl;
+        }
+        os << "const auto getSortKey = [](unsigned int i){ return (profileRegions[i].parent == -1) ? profileRegions[i].totalTime : profileRegions[profileRegions[i].parent].totalTime; };" << std::endl;
+        os << "std::stable_sort(order.begin(), order.end(),";
+        os << "[&getSortKey](unsigned int a, unsigned int b)";
+        {
+            CodeStream::Scope b(os);
+            os << "// Sort by total time of merged group, then keep merged group above its groups, then by total time" << std::endl;
+            os << "const int parentA = (profileRegions[a].parent == -1) ? (int)a : profileRegions[a].parent;" << std::endl;
+            os << "const int parentB = (profileRegions[b].parent == -1) ? (int)b : profileRegions[b].parent;" << std::endl;
+            os << "if(parentA != parentB)";
+            {
+                CodeStream::Scope b(os);
+                os << "return (getSortKey(a) != getSortKey(b)) ? (getSortKey(a) > getSortKey(b)) : (parentA < parentB);" << std::endl;
+            }
+            os << "else if((profileRegions[a].parent == -1) != (profileRegions[b].parent == -1))";
+            {
+                CodeStream::Scope b(os);
+                os << "return (profileRegions[a].parent == -1);" << std::endl;
+            }
+            os << "else";
+            {
+                CodeStream::Scope b(os);
+                os << "return (profileRegions[a].totalTime > profileRegions[b].totalTime);" << std::endl;
+            }
+        }
+        os << ");" << std::endl;
+        os << "std::fprintf(summaryFile, \"%-20s %-40s %12s %14s %14s %14s %14s\", \"Phase\", \"Group\", \"Calls\", \"Total [ms]\", \"Mean [us]\", \"Min [us]\", \"Max [us]\");" << std::endl;
+        if(perfCountersEnabled) {
+            os << "std::fprintf(summaryFile, \" %16s %16s %8s %14s %14s\", \"Cycles\", \"Instructions\", \"IPC\", \"LLC misses\", \"Branch misses\");" << std::endl;
+        }
+        os << "std::fprintf(summaryFile, \"\\n\");" << std::endl;
+        os << "for(unsigned int i : order)";
+        {
+            CodeStream::Scope b(os);
+            os << "const ProfileRegion &r = profileRegions[i];" << std::endl;
+            os << "const std::string name = ((r.parent == -1) ? \"\" : \"  \") + std::string(r.name);" << std::endl;
+            os << "std::fprintf(summaryFile, \"%-20s %-40s %12llu %14.3f %14.3f %14.3f %14.3f\", r.phase, name.c_str(), r.count, r.totalTime * 1E3,";
+            os << " (r.count == 0) ? 0.0 : (r.totalTime * 1E6 / (double)r.count), r.minTime * 1E6, r.maxTime * 1E6);" << std::endl;
+            if(perfCountersEnabled) {
+                os << "std::fprintf(summaryFile, \" %16llu %16llu %8.2f %14llu %14llu\", r.perfCounters[0], r.perfCounters[1],";
+                os << " (r.perfCounters[0] == 0) ? 0.0 : ((double)r.perfCounters[1] / (double)r.perfCounters[0]), r.perfCounters[2], r.perfCounters[3]);" << std::endl;
+            }
+            os << "std::fprintf(summaryFile, \"\\n\");" << std::endl;
+        }
+        os << "std::fclose(summaryFile);" << std::endl;
+    }
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+std::string getAddToInSynDelay(const SynapseGroupMergedBase &sg, const std::string &postIdx)
+{
+    // If dendritic delay buffer is sparse, use helper to also record newly-occupied entries
+    if(sg.getArchetype().isSparseDendriticDelayEnabled()) {
+        return "addToDenDelaySparse(group.denDelay, group.denDelayInd, group.denDelayCnt, " + sg.getDendriticDelaySlot("$(1)") + ", group.numTrgNeurons, " + postIdx + ", $(0))";
+    }
+    else {
+        return "group.denDelay[" + sg.getDendriticDelayOffset("$(1)") + postIdx + "] += $(0)";
+    }
 }
+//--------------------------------------------------------------------------
+bool isDenseStaticPulse(const PresynapticUpdateGroupMerged &sg, Models::Base::Var &weight)
+{
+    // Static pulse kernels only apply to dense connectivity with individual or global weights
+    const SynapseMatrixType matrixType = sg.getArchetype().getMatrixType();
+    if((matrixType != SynapseMatrixType::DENSE_INDIVIDUALG && matrixType != SynapseMatrixType::DENSE_GLOBALG)
+       || sg.getArchetype().isDendriticDelayRequired())
+    {
+        return false;
+    }
+
+    // Strip whitespace from sim code
+    const auto *wu = sg.getArchetype().getWUModel();
+    std::string simCode = wu->getSimCode();
+    simCode.erase(std::remove_if(simCode.begin(), simCode.end(), ::isspace), simCode.end());
+
+    // If sim code does nothing other than add a weight update model variable to inSyn, return variable
+    const auto vars = wu->getVars();
+    const auto var = std::find_if(vars.cbegin(), vars.cend(),
+                                  [&simCode](const Models::Base::Var &v)
+                                  {
+                                      return (simCode == ("$(addToInSyn,$(" + v.name + "));"));
+                                  });
+    if(var == vars.cend()) {
+        return false;
+    }
+    else {
+        weight = *var;
+        return true;
+    }
+}
+//--------------------------------------------------------------------------
+template<typename M>
+bool isEventDrivenNeuronModel(const NeuronUpdateGroupMerged &ng)
+{
+    // Neurons which don't spike can only be skipped if all groups use the model and nothing else needs updating every timestep
+    return std::all_of(ng.getGroups().cbegin(), ng.getGroups().cend(),
+                       [](const NeuronGroupInternal &n)
+                       {
+                           return (dynamic_cast<const M*>(n.getNeuronModel()) != nullptr)
+                                   && n.getMergedInSyn().empty() && n.getCurrentSources().empty()
+                                   && n.getInSynWithPostCode().empty() && n.getOutSynWithPreCode().empty()
+                                   && !n.isSpikeEventRequired() && !(n.isSpikeTimeRequired() && n.isDelayRequired());
+                       });
+}
+}   // Anonymous namespace
 
 //--------------------------------------------------------------------------
 // CodeGenerator::SingleThreadedCPU::Backend
@@ -64,6 +650,25 @@ namespace CodeGenerator
 {
 namespace SingleThreadedCPU
 {
+Backend::Backend(const std::string &scalarType, const Preferences &preferences)
+:   BackendBase(scalarType), m_Preferences(preferences)
+{
+    // Check allocation policies can be used with posix_memalign and _aligned_malloc
+    auto checkAllocationPolicy =
+        [](const AllocationPolicy &policy)
+        {
+            if(policy.alignment != 0 
+               && ((policy.alignment & (policy.alignment - 1)) != 0 || policy.alignment < sizeof(void*)))
+            {
+                throw std::runtime_error("Host array alignment must be zero or a power of two which is at least the size of a pointer");
+            }
+        };
+    checkAllocationPolicy(m_Preferences.allocationPolicy);
+    for(const auto &p : m_Preferences.locationAllocationPolicies) {
+        checkAllocationPolicy(p.second);
+    }
+}
+//--------------------------------------------------------------------------
 void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, 
                               NeuronGroupSimHandler simHandler, NeuronUpdateGroupMergedHandler wuVarUpdateHandler,
                               HostHandler pushEGPHandler) const
@@ -79,35 +684,27 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
         // Push any required EGPs
         pushEGPHandler(os);
 
-        Timer t(os, "neuronUpdate", model.isTimingEnabled());
-
-        // Loop through merged neuron spike queue update groups
-        for(const auto &n : modelMerged.getMergedNeuronSpikeQueueUpdateGroups()) {
-            CodeStream::Scope b(os);
-            os << "// merged neuron spike queue update group " << n.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
-            {
-                CodeStream::Scope b(os);
-
-                // Get reference to group
-                os << "const auto &group = mergedNeuronSpikeQueueUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
+        Timer t(os, "neuronUpdate", model.isTimingEnabled(), model.isPerfCountersEnabled());
+        const ProfileRegions profileRegions(modelMerged);
 
-                // Generate spike count reset
-                n.genMergedGroupSpikeCountReset(os);
-            }
-            
-        }
         // Loop through merged neuron update groups
+        // **NOTE** rather than resetting spike counts of all neuron groups in a separate sweep over
+        // merged spike queue update groups, they are reset while each group's structure is in cache
         for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
             CodeStream::Scope b(os);
             os << "// merged neuron update group " << n.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
+            ProfileTimer mt(os, "profileMerged", std::to_string(profileRegions.getMergedGroupRegion("neuronUpdate", n.getIndex())), model);
+            os << "for(unsigned int g = 0; g < " << (n.getGroups().size() * model.getBatchSize()) << "; g++)";
             {
                 CodeStream::Scope b(os);
+                ProfileTimer gt(os, "profile", profileRegions.getGroupRegion("neuronUpdate", n.getIndex()), model);
 
                 // Get reference to group
                 os << "const auto &group = mergedNeuronUpdateGroup" << n.getIndex() << "[g]; " << std::endl;
 
+                // Generate spike count reset
+                n.genMergedGroupSpikeCountReset(os);
+
                 // If axonal delays are required
                 if(n.getArchetype().isDelayRequired()) {
                     // We should READ from delay slot before spkQuePtr
@@ -118,34 +715,99 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
                 }
                 os << std::endl;
 
-                os << "for(unsigned int i = 0; i < group.numNeurons; i++)";
-                {
-                    CodeStream::Scope b(os);
+                // If group contains event-driven Poisson neurons, rather than testing every neuron,
+                // sample the number of neurons which don't spike before each one that does
+                if(isEventDrivenNeuronModel<NeuronModels::PoissonEventDriven>(n)) {
+                    Substitutions popSubs(&funcSubs);
+                    popSubs.addVarSubstitution("id", "i");
+                    popSubs.addVarSubstitution("rng", "rng");
+                    popSubs.addVarValueSubstitution(n.getArchetype().getNeuronModel()->getDerivedParams(), n.getArchetype().getDerivedParams(),
+                                                    [&n](size_t i) { return n.isDerivedParamHeterogeneous(i); },
+                                                    "", "group.");
+
+                    std::string skipCode = "std::floor(std::log($(gennrand_uniform)) / $(logNoSpikeProb))";
+                    popSubs.applyCheckUnreplaced(skipCode, "event-driven Poisson : merged" + std::to_string(n.getIndex()));
 
+                    os << "for(unsigned int i = 0;; i++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "const double skip = " << skipCode << ";" << std::endl;
+
+                        // **NOTE** negated comparison also terminates if skip is NaN
+                        os << "if(!(skip < (double)(group.numNeurons - i)))";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "break;" << std::endl;
+                        }
+                        os << "i += (unsigned int)skip;" << std::endl;
+                        genEmitSpike(os, n, popSubs, true);
+                    }
+                }
+                // Otherwise, if group contains spike source schedules, directly emit spikes scheduled for this timestep
+                else if(isEventDrivenNeuronModel<NeuronModels::SpikeSourceSchedule>(n)) {
                     Substitutions popSubs(&funcSubs);
                     popSubs.addVarSubstitution("id", "i");
+                    popSubs.addVarNameSubstitution(n.getArchetype().getNeuronModel()->getExtraGlobalParams(), "", "group.");
 
-                    // If this neuron group requires a simulation RNG, substitute in global RNG
-                    if(n.getArchetype().isSimRNGRequired()) {
-                        popSubs.addVarSubstitution("rng", "rng");
+                    std::string scheduleCode = 
+                        "const unsigned int timestep = (unsigned int)(($(t) / DT) + 0.5);\n"
+                        "const unsigned int scheduleStart = (timestep < $(numTimesteps)) ? $(spikeTimestepOffsets)[timestep] : 0;\n"
+                        "const unsigned int scheduleEnd = (timestep < $(numTimesteps)) ? $(spikeTimestepOffsets)[timestep + 1] : 0;\n";
+                    popSubs.applyCheckUnreplaced(scheduleCode, "spike source schedule : merged" + std::to_string(n.getIndex()));
+                    os << scheduleCode;
+
+                    std::string idCode = "const unsigned int i = $(spikeIDs)[s];\n";
+                    popSubs.applyCheckUnreplaced(idCode, "spike source schedule : merged" + std::to_string(n.getIndex()));
+
+                    // **NOTE** IDs are sorted within each timestep so any duplicates are adjacent
+                    std::string duplicateCode = "(s > scheduleStart) && (i == $(spikeIDs)[s - 1])";
+                    popSubs.applyCheckUnreplaced(duplicateCode, "spike source schedule : merged" + std::to_string(n.getIndex()));
+
+                    os << "for(unsigned int s = scheduleStart; s < scheduleEnd; s++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << idCode;
+
+                        // Skip duplicate IDs so, as when threshold condition is tested, each neuron spikes at most once per timestep
+                        os << "if(" << duplicateCode << ")";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "continue;" << std::endl;
+                        }
+                        genEmitSpike(os, n, popSubs, true);
                     }
+                }
+                // Otherwise, update every neuron
+                else {
+                    os << "for(unsigned int i = 0; i < group.numNeurons; i++)";
+                    {
+                        CodeStream::Scope b(os);
 
-                    simHandler(os, n, popSubs,
-                               // Emit true spikes
-                               [this, wuVarUpdateHandler](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
-                               {
-                                   // Insert code to update WU vars
-                                   wuVarUpdateHandler(os, ng, subs);
-
-                                   // Insert code to emit true spikes
-                                   genEmitSpike(os, ng, subs, true);
-                               },
-                               // Emit spike-like events
-                                   [this](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
-                               {
-                                   // Insert code to emit spike-like events
-                                   genEmitSpike(os, ng, subs, false);
-                               });
+                        Substitutions popSubs(&funcSubs);
+                        popSubs.addVarSubstitution("id", "i");
+
+                        // If this neuron group requires a simulation RNG, substitute in global RNG
+                        if(n.getArchetype().isSimRNGRequired()) {
+                            popSubs.addVarSubstitution("rng", "rng");
+                        }
+
+                        simHandler(os, n, popSubs,
+                                   // Emit true spikes
+                                   [this, wuVarUpdateHandler](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
+                                   {
+                                       // Insert code to update WU vars
+                                       wuVarUpdateHandler(os, ng, subs);
+
+                                       // Insert code to emit true spikes
+                                       genEmitSpike(os, ng, subs, true);
+                                   },
+                                   // Emit spike-like events
+                                       [this](CodeStream &os, const NeuronUpdateGroupMerged &ng, Substitutions &subs)
+                                   {
+                                       // Insert code to emit spike-like events
+                                       genEmitSpike(os, ng, subs, false);
+                                   });
+                    }
                 }
             }
         }
@@ -154,10 +816,17 @@ void Backend::genNeuronUpdate(CodeStream &os, const ModelSpecMerged &modelMerged
 //--------------------------------------------------------------------------
 void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged,
                                PresynapticUpdateGroupMergedHandler wumThreshHandler, PresynapticUpdateGroupMergedHandler wumSimHandler,
-                               PresynapticUpdateGroupMergedHandler wumEventHandler, PresynapticUpdateGroupMergedHandler,
+                               PresynapticUpdateGroupMergedHandler wumEventHandler, PresynapticUpdateGroupMergedHandler wumProceduralConnectHandler,
                                PostsynapticUpdateGroupMergedHandler postLearnHandler, SynapseDynamicsGroupMergedHandler synapseDynamicsHandler,
                                HostHandler pushEGPHandler) const
 {
+    // **NOTE** sparse dendritic delay buffers record the indices of postsynaptic neurons rather than their reordered inSyn positions
+    for(const auto &s : modelMerged.getMergedPresynapticUpdateGroups()) {
+        if(s.getArchetype().isPostsynapticReorderingEnabled() && s.getArchetype().isSparseDendriticDelayEnabled()) {
+            throw std::runtime_error("Postsynaptic reordering cannot be used with sparse dendritic delay buffers");
+        }
+    }
+
     const ModelSpecInternal &model = modelMerged.getModel();
     os << "void updateSynapses(" << model.getTimePrecision() << " t)";
     {
@@ -168,16 +837,20 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
         // Push any required EGPs
         pushEGPHandler(os);
 
+        const ProfileRegions profileRegions(modelMerged);
+
         // Synapse dynamics
         {
             // Loop through merged synapse dynamics groups
-            Timer t(os, "synapseDynamics", model.isTimingEnabled());
+            Timer t(os, "synapseDynamics", model.isTimingEnabled(), model.isPerfCountersEnabled());
             for(const auto &s : modelMerged.getMergedSynapseDynamicsGroups()) {
                 CodeStream::Scope b(os);
                 os << "// merged synapse dynamics group " << s.getIndex() << std::endl;
-                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                ProfileTimer mt(os, "profileMerged", std::to_string(profileRegions.getMergedGroupRegion("synapseDynamics", s.getIndex())), model);
+                os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
                 {
                     CodeStream::Scope b(os);
+                    ProfileTimer gt(os, "profile", profileRegions.getGroupRegion("synapseDynamics", s.getIndex()), model);
 
                     // Get reference to group
                     os << "const auto &group = mergedSynapseDynamicsGroup" << s.getIndex() << "[g]; " << std::endl;
@@ -200,12 +873,16 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                         if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
                             os << "for(unsigned int s = 0; s < group.rowLength[i]; s++)";
                         }
+                        // Otherwise, if it's CSR, loop through synapses between this row's pointers
+                        else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                            os << "for(unsigned int n = group.rowPtr[i]; n < group.rowPtr[i + 1]; n++)";
+                        }
                         // Otherwise, if it's dense, loop through each postsynaptic neuron
                         else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::DENSE) {
                             os << "for (unsigned int j = 0; j < group.numTrgNeurons; j++)";
                         }
                         else {
-                            throw std::runtime_error("Only DENSE and SPARSE format connectivity can be used for synapse dynamics");
+                            throw std::runtime_error("Only DENSE, SPARSE and CSR format connectivity can be used for synapse dynamics");
                         }
                         {
                             CodeStream::Scope b(os);
@@ -218,6 +895,11 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
 
                                 synSubs.addVarSubstitution("id_syn", "n");
                             }
+                            else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                                os << "const unsigned int j = group.ind[n];" << std::endl;
+
+                                synSubs.addVarSubstitution("id_syn", "n");
+                            }
                             else {
                                 synSubs.addVarSubstitution("id_syn", "(i * group.numTrgNeurons) + j");
                             }
@@ -228,7 +910,7 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
 
                             // Add correct functions for apply synaptic input
                             if(s.getArchetype().isDendriticDelayRequired()) {
-                                synSubs.addFuncSubstitution("addToInSynDelay", 2, "group.denDelay[" + s.getDendriticDelayOffset("$(1)") + "j] += $(0)");
+                                synSubs.addFuncSubstitution("addToInSynDelay", 2, getAddToInSynDelay(s, "j"));
                             }
                             else {
                                 synSubs.addFuncSubstitution("addToInSyn", 1, "group.inSyn[j] += $(0)");
@@ -244,51 +926,68 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
 
         // Presynaptic update
         {
-            Timer t(os, "presynapticUpdate", model.isTimingEnabled());
-            for(const auto &s : modelMerged.getMergedPresynapticUpdateGroups()) {
-                CodeStream::Scope b(os);
-                os << "// merged presynaptic update group " << s.getIndex() << std::endl;
-                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
-                {
+            Timer t(os, "presynapticUpdate", model.isTimingEnabled(), model.isPerfCountersEnabled());
+
+            // Loop through merged presynaptic update groups with local, followed by remote, presynaptic neurons
+            // **NOTE** with MPI, spikes emitted by remote neurons are received while local spikes are processed
+            for(bool remote : {false, true}) {
+#ifdef MPI_ENABLE
+                if(remote) {
+                    os << "mpiCompleteSpikeExchange();" << std::endl;
+                }
+#endif
+                for(const auto &s : modelMerged.getMergedPresynapticUpdateGroups()) {
+                    if(s.getArchetype().getSrcNeuronGroup()->isRemote() != remote) {
+                        continue;
+                    }
                     CodeStream::Scope b(os);
+                    os << "// merged presynaptic update group " << s.getIndex() << std::endl;
+                    ProfileTimer mt(os, "profileMerged", std::to_string(profileRegions.getMergedGroupRegion("presynapticUpdate", s.getIndex())), model);
+                    os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
+                    {
+                        CodeStream::Scope b(os);
+                        ProfileTimer gt(os, "profile", profileRegions.getGroupRegion("presynapticUpdate", s.getIndex()), model);
 
-                    // Get reference to group
-                    os << "const auto &group = mergedPresynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
+                        // Get reference to group
+                        os << "const auto &group = mergedPresynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
 
-                    // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
-                    if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
-                        os << "const unsigned int preReadDelaySlot = " << s.getPresynapticAxonalDelaySlot() << ";" << std::endl;
-                        os << "const unsigned int preReadDelayOffset = preReadDelaySlot * group.numSrcNeurons;" << std::endl;
-                    }
+                        // If presynaptic neuron group has variable queues, calculate offset to read from its variables with axonal delay
+                        if(s.getArchetype().getSrcNeuronGroup()->isDelayRequired()) {
+                            os << "const unsigned int preReadDelaySlot = " << s.getPresynapticAxonalDelaySlot() << ";" << std::endl;
+                            os << "const unsigned int preReadDelayOffset = preReadDelaySlot * group.numSrcNeurons;" << std::endl;
+                        }
 
-                    // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
-                    if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
-                        os << "const unsigned int postReadDelayOffset = " << s.getPostsynapticBackPropDelaySlot() << " * group.numTrgNeurons;" << std::endl;
-                    }
+                        // If postsynaptic neuron group has variable queues, calculate offset to read from its variables at current time
+                        if(s.getArchetype().getTrgNeuronGroup()->isDelayRequired()) {
+                            os << "const unsigned int postReadDelayOffset = " << s.getPostsynapticBackPropDelaySlot() << " * group.numTrgNeurons;" << std::endl;
+                        }
 
-                    // generate the code for processing spike-like events
-                    if (s.getArchetype().isSpikeEventRequired()) {
-                        genPresynapticUpdate(os, modelMerged, s, funcSubs, false, wumThreshHandler, wumEventHandler);
-                    }
+                        // generate the code for processing spike-like events
+                        if (s.getArchetype().isSpikeEventRequired()) {
+                            genPresynapticUpdate(os, modelMerged, s, funcSubs, false, wumThreshHandler, wumEventHandler, wumProceduralConnectHandler);
+                        }
 
-                    // generate the code for processing true spike events
-                    if (s.getArchetype().isTrueSpikeRequired()) {
-                        genPresynapticUpdate(os, modelMerged, s, funcSubs, true, wumThreshHandler, wumSimHandler);
+                        // generate the code for processing true spike events
+                        if (s.getArchetype().isTrueSpikeRequired()) {
+                            genPresynapticUpdate(os, modelMerged, s, funcSubs, true, wumThreshHandler, wumSimHandler, wumProceduralConnectHandler);
+                        }
+                        os << std::endl;
                     }
-                    os << std::endl;
                 }
             }
         }
 
         // Postsynaptic update
         {
-            Timer t(os, "postsynapticUpdate", model.isTimingEnabled());
+            Timer t(os, "postsynapticUpdate", model.isTimingEnabled(), model.isPerfCountersEnabled());
             for(const auto &s : modelMerged.getMergedPostsynapticUpdateGroups()) {
                 CodeStream::Scope b(os);
                 os << "// merged postsynaptic update group " << s.getIndex() << std::endl;
-                os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+                ProfileTimer mt(os, "profileMerged", std::to_string(profileRegions.getMergedGroupRegion("postsynapticUpdate", s.getIndex())), model);
+                os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
                 {
                     CodeStream::Scope b(os);
+                    ProfileTimer gt(os, "profile", profileRegions.getGroupRegion("postsynapticUpdate", s.getIndex()), model);
 
                     // Get reference to group
                     os << "const auto &group = mergedPostsynapticUpdateGroup" << s.getIndex() << "[g]; " << std::endl;
@@ -321,7 +1020,7 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                         os << "const unsigned int spike = group.trgSpk[" << offsetTrueSpkPost << "j];" << std::endl;
 
                         // Loop through column of presynaptic neurons
-                        if (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                        if ((s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR)) {
                             os << "const unsigned int npre = group.colLength[spike];" << std::endl;
                             os << "for (unsigned int i = 0; i < npre; i++)";
                         }
@@ -340,6 +1039,14 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                                 synSubs.addVarSubstitution("id_pre", "(rowMajorIndex / group.rowStride)");
                                 synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
                             }
+                            else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                                os << "const unsigned int colMajorIndex = (spike * group.colStride) + i;" << std::endl;
+                                os << "const unsigned int rowMajorIndex = group.remap[colMajorIndex];" << std::endl;
+
+                                // Without padding, row containing synapse is found by searching row pointers
+                                synSubs.addVarSubstitution("id_pre", "(unsigned int)(std::upper_bound(group.rowPtr, group.rowPtr + group.numSrcNeurons + 1, rowMajorIndex) - group.rowPtr - 1)");
+                                synSubs.addVarSubstitution("id_syn", "rowMajorIndex");
+                            }
                             else {
                                 synSubs.addVarSubstitution("id_pre", "i");
                                 synSubs.addVarSubstitution("id_syn", "((group.numTrgNeurons * i) + spike)");
@@ -353,6 +1060,53 @@ void Backend::genSynapseUpdate(CodeStream &os, const ModelSpecMerged &modelMerge
                 }
             }
         }
+
+        // Accumulate input from current slot of sparse dendritic delay buffers into inSyn
+        for(const auto &d : modelMerged.getMergedSynapseDendriticDelayUpdateGroups()) {
+            if(d.getArchetype().isSparseDendriticDelayEnabled()) {
+                CodeStream::Scope b(os);
+                os << "// merged sparse dendritic delay group " << d.getIndex() << std::endl;
+                os << "for(unsigned int g = 0; g < " << (d.getGroups().size() * model.getBatchSize()) << "; g++)";
+                {
+                    CodeStream::Scope b(os);
+
+                    // Get reference to group
+                    os << "const auto &group = mergedSynapseDendriticDelayUpdateGroup" << d.getIndex() << "[g]; " << std::endl;
+
+                    os << "const unsigned int slotOffset = *group.denDelayPtr * group.numTrgNeurons;" << std::endl;
+                    os << model.getPrecision() << " *denDelaySlot = &group.denDelay[slotOffset];" << std::endl;
+                    os << "const unsigned int count = group.denDelayCnt[*group.denDelayPtr];" << std::endl;
+
+                    // If slot's list of occupied entries overflowed, sweep whole slot
+                    os << "if(count > group.numTrgNeurons)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "for(unsigned int i = 0; i < group.numTrgNeurons; i++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "group.inSyn[i] += denDelaySlot[i];" << std::endl;
+                            os << "denDelaySlot[i] = " << model.scalarExpr(0.0) << ";" << std::endl;
+                        }
+                    }
+                    // Otherwise, only visit occupied entries
+                    os << "else";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "const unsigned int *denDelayIndSlot = &group.denDelayInd[slotOffset];" << std::endl;
+                        os << "for(unsigned int j = 0; j < count; j++)";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "const unsigned int i = denDelayIndSlot[j];" << std::endl;
+                            os << "group.inSyn[i] += denDelaySlot[i];" << std::endl;
+                            os << "denDelaySlot[i] = " << model.scalarExpr(0.0) << ";" << std::endl;
+                        }
+                    }
+
+                    // Empty slot
+                    os << "group.denDelayCnt[*group.denDelayPtr] = 0;" << std::endl;
+                }
+            }
+        }
     }
 }
 //--------------------------------------------------------------------------
@@ -370,7 +1124,7 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
         // Push any required EGPs
         initPushEGPHandler(os);
 
-        Timer t(os, "init", model.isTimingEnabled());
+        Timer t(os, "init", model.isTimingEnabled(), model.isPerfCountersEnabled());
 
         // If model requires a host RNG, add RNG to substitutions
         if(isGlobalHostRNGRequired(modelMerged)) {
@@ -382,7 +1136,7 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
         for(const auto &n : modelMerged.getMergedNeuronInitGroups()) {
             CodeStream::Scope b(os);
             os << "// merged neuron init group " << n.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << n.getGroups().size() << "; g++)";
+            os << "for(unsigned int g = 0; g < " << (n.getGroups().size() * model.getBatchSize()) << "; g++)";
             {
                 CodeStream::Scope b(os);
 
@@ -398,7 +1152,7 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
         for(const auto &s : modelMerged.getMergedSynapseDenseInitGroups()) {
             CodeStream::Scope b(os);
             os << "// merged synapse dense init group " << s.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+            os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
             {
                 CodeStream::Scope b(os);
 
@@ -421,6 +1175,30 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                 // Get reference to group
                 os << "const auto &group = mergedSynapseConnectivityInitGroup" << s.getIndex() << "[g]; " << std::endl;
 
+                // Get names of groups whose connectivity is cached
+                std::vector<std::pair<size_t, std::string>> cachedGroups;
+                for(size_t g = 0; g < s.getGroups().size(); g++) {
+                    if(model.isConnectivityCacheRequired(s.getGroups()[g].get())) {
+                        cachedGroups.emplace_back(g, s.getGroups()[g].get().getName());
+                    }
+                }
+
+                // If connectivity can be loaded from the cache, skip building it
+                if(!cachedGroups.empty()) {
+                    os << "if(";
+                    for(const auto &c : cachedGroups) {
+                        if(&c != &cachedGroups.front()) {
+                            os << " || ";
+                        }
+                        os << "(g == " << c.first << " && loadCachedConnectivity" << c.second << "())";
+                    }
+                    os << ")";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "continue;" << std::endl;
+                    }
+                }
+
                 // If matrix connectivity is ragged
                 if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
                     // Zero row lengths
@@ -439,13 +1217,87 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                         popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
                         
                         // Add function to increment row length and insert synapse into ind array
-                        popSubs.addFuncSubstitution("addSynapse", 1,
+                        // **NOTE** any kernel coordinates passed after the postsynaptic index are ignored
+                        popSubs.addFuncSubstitution("addSynapse", 1 + s.getArchetype().getKernelSize().size(),
                                                     "group.ind[(i * group.rowStride) + (group.rowLength[i]++)] = $(0)");
 
                         sgSparseConnectHandler(os, s, popSubs);
                     }
 
                 }
+                // Otherwise, if matrix connectivity is CSR
+                else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                    // Zero row pointers so first pass can count each row's synapses into the following entry
+                    os << "std::fill_n(group.rowPtr, group.numSrcNeurons + 1, 0);" << std::endl;
+
+                    // If connectivity is built using the RNG, snapshot its state so second pass generates identical rows
+                    const bool rngRequired = ::Utils::isRNGRequired(s.getArchetype().getConnectivityInitialiser().getSnippet()->getRowBuildCode());
+                    if(rngRequired) {
+                        os << "const auto rngSnapshot = rng;" << std::endl;
+                        os << "const auto standardUniformDistributionSnapshot = standardUniformDistribution;" << std::endl;
+                        os << "const auto standardNormalDistributionSnapshot = standardNormalDistribution;" << std::endl;
+                        os << "const auto standardExponentialDistributionSnapshot = standardExponentialDistribution;" << std::endl;
+                    }
+
+                    // Count synapses in each row
+                    os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                    {
+                        CodeStream::Scope b(os);
+
+                        Substitutions popSubs(&funcSubs);
+                        popSubs.addVarSubstitution("id_pre", "i");
+                        popSubs.addVarSubstitution("id_post_begin", "0");
+                        popSubs.addVarSubstitution("id_thread", "0");
+                        popSubs.addVarSubstitution("num_threads", "1");
+                        popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+                        popSubs.addFuncSubstitution("addSynapse", 1 + s.getArchetype().getKernelSize().size(),
+                                                    "group.rowPtr[i + 1]++");
+
+                        sgSparseConnectHandler(os, s, popSubs);
+                    }
+
+                    // Convert row lengths into row pointers
+                    os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "group.rowPtr[i + 1] += group.rowPtr[i];" << std::endl;
+                    }
+
+                    // Allocate exactly enough synapses for this group
+                    for(size_t g = 0; g < s.getGroups().size(); g++) {
+                        os << "if(g == " << g << ")";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "allocateSynapses" << s.getGroups()[g].get().getName() << "(group.rowPtr[group.numSrcNeurons]);" << std::endl;
+                        }
+                    }
+
+                    // Restore RNG state
+                    if(rngRequired) {
+                        os << "rng = rngSnapshot;" << std::endl;
+                        os << "standardUniformDistribution = standardUniformDistributionSnapshot;" << std::endl;
+                        os << "standardNormalDistribution = standardNormalDistributionSnapshot;" << std::endl;
+                        os << "standardExponentialDistribution = standardExponentialDistributionSnapshot;" << std::endl;
+                    }
+
+                    // Fill rows with target indices
+                    os << "for (unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "unsigned int rowEnd = group.rowPtr[i];" << std::endl;
+
+                        Substitutions popSubs(&funcSubs);
+                        popSubs.addVarSubstitution("id_pre", "i");
+                        popSubs.addVarSubstitution("id_post_begin", "0");
+                        popSubs.addVarSubstitution("id_thread", "0");
+                        popSubs.addVarSubstitution("num_threads", "1");
+                        popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+                        popSubs.addFuncSubstitution("addSynapse", 1 + s.getArchetype().getKernelSize().size(),
+                                                    "group.ind[rowEnd++] = $(0)");
+
+                        sgSparseConnectHandler(os, s, popSubs);
+                    }
+                }
                 // Otherwise, if matrix connectivity is a bitmask
                 else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
                     // Zero memory before setting sparse bits
@@ -466,14 +1318,23 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                         popSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
 
                         // Add function to increment row length and insert synapse into ind array
-                        popSubs.addFuncSubstitution("addSynapse", 1,
+                        popSubs.addFuncSubstitution("addSynapse", 1 + s.getArchetype().getKernelSize().size(),
                                                     "setB(group.gp[(rowStartGID + $(0)) / 32], (rowStartGID + $(0)) & 31)");
 
                         sgSparseConnectHandler(os, s, popSubs);
                     }
                 }
                 else {
-                    throw std::runtime_error("Only BITMASK and SPARSE format connectivity can be generated using a connectivity initialiser");
+                    throw std::runtime_error("Only BITMASK, SPARSE and CSR format connectivity can be generated using a connectivity initialiser");
+                }
+
+                // Write newly-built connectivity to cache
+                for(const auto &c : cachedGroups) {
+                    os << "if(g == " << c.first << ")";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "saveCachedConnectivity" << c.second << "();" << std::endl;
+                    }
                 }
             }
         }
@@ -487,29 +1348,77 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
         // Push any required EGPs
         initSparsePushEGPHandler(os);
 
-        Timer t(os, "initSparse", model.isTimingEnabled());
+        Timer t(os, "initSparse", model.isTimingEnabled(), model.isPerfCountersEnabled());
 
         // If model requires RNG, add it to substitutions
         if(isGlobalHostRNGRequired(modelMerged)) {
             funcSubs.addVarSubstitution("rng", "rng");
         }
 
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Synapse groups with bitmask row word ranges" << std::endl;
+        for(const auto &s : model.getSynapseGroups()) {
+            // **NOTE** this runs after connectivity has been initialised or provided by the user
+            if(!s.second.isWeightSharingSlave() && s.second.isBitmaskRowWordRangeEnabled()) {
+                CodeStream::Scope b(os);
+                os << "// " << s.first << std::endl;
+                os << "const unsigned int rowWords = " << ceilDivide(s.second.getTrgNeuronGroup()->getNumNeurons(), 32) << ";" << std::endl;
+                os << "for(unsigned int i = 0; i < " << s.second.getSrcNeuronGroup()->getNumNeurons() << "; i++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const uint32_t *rowGP = &gp" << s.first << "[i * rowWords];" << std::endl;
+
+                    // Trim empty words from start and end of row
+                    os << "unsigned int rowWordStart = 0;" << std::endl;
+                    os << "while(rowWordStart < rowWords && rowGP[rowWordStart] == 0)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "rowWordStart++;" << std::endl;
+                    }
+                    os << "unsigned int rowWordEnd = rowWords;" << std::endl;
+                    os << "while(rowWordEnd > rowWordStart && rowGP[rowWordEnd - 1] == 0)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "rowWordEnd--;" << std::endl;
+                    }
+                    os << "rowWordRange" << s.first << "[i * 2] = rowWordStart;" << std::endl;
+                    os << "rowWordRange" << s.first << "[(i * 2) + 1] = rowWordEnd;" << std::endl;
+                }
+            }
+        }
+
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Synapse groups with postsynaptic reordering" << std::endl;
+        for(const auto &s : model.getSynapseGroups()) {
+            // **NOTE** like row word ranges, this runs after connectivity has been initialised or provided by the user
+            if(!s.second.isWeightSharingSlave() && s.second.isPostsynapticReorderingEnabled()) {
+                os << "reorderPostsynaptic(rowLength" << s.first << ", ind" << s.first << ", indInSyn" << s.first << ", inSynOrder" << s.first << ", ";
+                os << s.second.getSrcNeuronGroup()->getNumNeurons() << ", " << s.second.getTrgNeuronGroup()->getNumNeurons() << ", ";
+                os << getSynapticMatrixRowStride(s.second) << ");" << std::endl;
+            }
+        }
+
         os << "// ------------------------------------------------------------------------" << std::endl;
         os << "// Synapse groups with sparse connectivity" << std::endl;
         for(const auto &s : modelMerged.getMergedSynapseSparseInitGroups()) {
             CodeStream::Scope b(os);
             os << "// merged sparse synapse init group " << s.getIndex() << std::endl;
-            os << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
+            os << "for(unsigned int g = 0; g < " << (s.getGroups().size() * model.getBatchSize()) << "; g++)";
             {
                 CodeStream::Scope b(os);
 
                 // Get reference to group
                 os << "const auto &group = mergedSynapseSparseInitGroup" << s.getIndex() << "[g]; " << std::endl;
 
+                // Connectivity is shared between instances of batched models so column
+                // lengths and remapping should only be calculated for first instance
+                const std::string firstInstanceCond = (model.getBatchSize() == 1) ? "" : ("if((g % " + std::to_string(model.getBatchSize()) + ") == 0) ");
+                const bool csr = (s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR);
+
                 // If postsynaptic learning is required, initially zero column lengths
                 if (!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
                     os << "// Zero column lengths" << std::endl;
-                    os << "std::fill_n(group.colLength, group.numTrgNeurons, 0);" << std::endl;
+                    os << firstInstanceCond << "std::fill_n(group.colLength, group.numTrgNeurons, 0);" << std::endl;
                 }
 
                 os << "// Loop through presynaptic neurons" << std::endl;
@@ -521,21 +1430,26 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                     if(s.getArchetype().isWUVarInitRequired()) {
                         Substitutions popSubs(&funcSubs);
                         popSubs.addVarSubstitution("id_pre", "i");
-                        popSubs.addVarSubstitution("row_len", "group.rowLength[i]");
+                        popSubs.addVarSubstitution("row_len", csr ? "(group.rowPtr[i + 1] - group.rowPtr[i])" : "group.rowLength[i]");
                         sgSparseInitHandler(os, s, popSubs);
                     }
 
                     // If postsynaptic learning is required
                     if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
                         os << "// Loop through synapses in corresponding matrix row" << std::endl;
-                        os << "for(unsigned int j = 0; j < group.rowLength[i]; j++)" << std::endl;
+                        if(csr) {
+                            os << firstInstanceCond << "for(unsigned int j = 0; j < (group.rowPtr[i + 1] - group.rowPtr[i]); j++)" << std::endl;
+                        }
+                        else {
+                            os << firstInstanceCond << "for(unsigned int j = 0; j < group.rowLength[i]; j++)" << std::endl;
+                        }
                         {
                             CodeStream::Scope b(os);
 
                             // If postsynaptic learning is required, calculate column length and remapping
                             if(!s.getArchetype().getWUModel()->getLearnPostCode().empty()) {
                                 os << "// Calculate index of this synapse in the row-major matrix" << std::endl;
-                                os << "const unsigned int rowMajorIndex = (i * group.rowStride) + j;" << std::endl;
+                                os << "const unsigned int rowMajorIndex = " << (csr ? "group.rowPtr[i] + j;" : "(i * group.rowStride) + j;") << std::endl;
                                 os << "// Using this, lookup postsynaptic target" << std::endl;
                                 os << "const unsigned int postIndex = group.ind[rowMajorIndex];" << std::endl;
                                 os << "// From this calculate index of this synapse in the column-major matrix" << std::endl;
@@ -550,12 +1464,31 @@ void Backend::genInit(CodeStream &os, const ModelSpecMerged &modelMerged,
                 }
             }
         }
+
+        os << "// ------------------------------------------------------------------------" << std::endl;
+        os << "// Synapse groups with compressed sparse indices" << std::endl;
+        for(const auto &s : model.getSynapseGroups()) {
+            // **NOTE** this runs after weights have been initialised as sparse initialisation reads the padded target indices
+            if(!s.second.isWeightSharingSlave() && s.second.isCompressedSparseIndEnabled()) {
+                // Size encoded rows, allocate exactly enough space for them and encode
+                const unsigned int numSrcNeurons = s.second.getSrcNeuronGroup()->getNumNeurons();
+                const size_t rowStride = getSynapticMatrixRowStride(s.second);
+                os << "calcCompressedSparseIndRowOffsets(rowLength" << s.first << ", ind" << s.first << ", rowOffset" << s.first << ", ";
+                os << numSrcNeurons << ", " << rowStride << ");" << std::endl;
+                os << "allocateIndCompressed" << s.first << "(rowOffset" << s.first << "[" << numSrcNeurons << "]);" << std::endl;
+                os << "compressSparseInd(rowLength" << s.first << ", ind" << s.first << ", rowOffset" << s.first << ", indCompressed" << s.first << ", ";
+                os << numSrcNeurons << ", " << rowStride << ");" << std::endl;
+                genVariableFree(os, "ind" + s.first, s.second.getSparseConnectivityLocation());
+                os << "ind" << s.first << " = nullptr;" << std::endl;
+            }
+        }
     }
 }
 //--------------------------------------------------------------------------
 size_t Backend::getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const
 {
-    if (sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+    // **NOTE** CSR rows aren't padded but the maximum row length still bounds column-major structures
+    if ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (sg.getMatrixType() & SynapseMatrixConnectivity::CSR)) {
         return sg.getMaxConnections();
     }
     else if(m_Preferences.enableBitmaskOptimisations && (sg.getMatrixType() & SynapseMatrixConnectivity::BITMASK)) {
@@ -589,12 +1522,63 @@ void Backend::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &mode
         os << "EXPORT_VAR " << "std::exponential_distribution<" << model.getPrecision() << "> standardExponentialDistribution;" << std::endl;
         os << std::endl;
     }
+
+    // If hardware performance counters are enabled, declare function to check they could be opened
+    if(model.isPerfCountersEnabled()) {
+        os << "extern \"C\"";
+        {
+            CodeStream::Scope b(os);
+            os << "EXPORT_FUNC bool arePerfCountersAvailable();" << std::endl;
+        }
+        os << std::endl;
+    }
+
+    // If profiling is enabled, declare functions to access profile
+    if(model.isProfilingEnabled()) {
+        os << "extern \"C\"";
+        {
+            CodeStream::Scope b(os);
+            os << "EXPORT_FUNC void resetProfile();" << std::endl;
+            os << "EXPORT_FUNC void setProfileTraceCapacity(unsigned long long capacity);" << std::endl;
+            os << "EXPORT_FUNC unsigned int getProfileNumRegions();" << std::endl;
+            os << "EXPORT_FUNC const char *getProfileRegionName(unsigned int region);" << std::endl;
+            os << "EXPORT_FUNC const char *getProfileRegionPhase(unsigned int region);" << std::endl;
+            os << "EXPORT_FUNC int getProfileRegionParent(unsigned int region);" << std::endl;
+            os << "EXPORT_FUNC unsigned long long getProfileRegionCount(unsigned int region);" << std::endl;
+            os << "EXPORT_FUNC double getProfileRegionTotalTime(unsigned int region);" << std::endl;
+            os << "EXPORT_FUNC double getProfileRegionMinTime(unsigned int region);" << std::endl;
+            os << "EXPORT_FUNC double getProfileRegionMaxTime(unsigned int region);" << std::endl;
+            os << "EXPORT_FUNC unsigned int getProfileNumHistogramBins();" << std::endl;
+            os << "EXPORT_FUNC unsigned long long getProfileRegionHistogram(unsigned int region, unsigned int bin);" << std::endl;
+            os << "EXPORT_FUNC unsigned long long getProfileRegionPerfCounter(unsigned int region, unsigned int counter);" << std::endl;
+            os << "EXPORT_FUNC void writeProfileTrace(const char *path);" << std::endl;
+            os << "EXPORT_FUNC void writeProfileSummary(const char *path);" << std::endl;
+        }
+        os << std::endl;
+    }
 }
 //--------------------------------------------------------------------------
-void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &) const
+void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
 {
     os << "#define SUPPORT_CODE_FUNC inline" << std::endl;
 
+    // Declare functions used to allocate and free aligned host arrays
+    os << "void *allocateHostArray(size_t bytes, size_t alignment, size_t hugePageThreshold, bool firstTouch);" << std::endl;
+    os << "void freeHostArray(void *ptr);" << std::endl;
+
+    // If hardware performance counters are enabled, declare functions used by generated code to read them
+    const ModelSpecInternal &model = modelMerged.getModel();
+    if(model.isPerfCountersEnabled()) {
+        os << "void readPerfCounters(uint64_t *counters);" << std::endl;
+        os << "void accumulatePerfCounters(unsigned long long *totals, const uint64_t *start);" << std::endl;
+    }
+
+    // If profiling is enabled, declare function used by generated code to record time taken to update groups
+    if(model.isProfilingEnabled()) {
+        os << "void recordProfileRegion(unsigned int region, std::chrono::high_resolution_clock::time_point start";
+        os << (model.isPerfCountersEnabled() ? ", const uint64_t *perfCountersStart);" : ");") << std::endl;
+    }
+
     // On windows, define an inline function, matching the signature of __builtin_clz which counts leading zeros
 #ifdef _WIN32
     os << "#include <intrin.h>" << std::endl;
@@ -614,11 +1598,276 @@ void Backend::genDefinitionsInternalPreamble(CodeStream &os, const ModelSpecMerg
             os << "return 32;" << std::endl;
         }
     }
-    // Otherwise, on *nix, use __builtin_clz intrinsic
+    os << std::endl;
+    os << "int inline gennCLZ64(uint64_t value)";
+    {
+        CodeStream::Scope b(os);
+        os << "unsigned long leadingZero = 0;" << std::endl;
+        os << "if( _BitScanReverse64(&leadingZero, value))";
+        {
+            CodeStream::Scope b(os);
+            os << "return 63 - leadingZero;" << std::endl;
+        }
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            os << "return 64;" << std::endl;
+        }
+    }
+    // Otherwise, on *nix, use __builtin_clz intrinsics
 #else
     os << "#define gennCLZ __builtin_clz" << std::endl;
+    os << "#define gennCLZ64 __builtin_clzll" << std::endl;
 #endif
     os << std::endl;
+
+    // If a global RNG is required, define discrete distributions built on the standard uniform distribution
+    if(isGlobalHostRNGRequired(modelMerged)) {
+        genDiscreteDistributions(os, "inline", "", modelMerged.getModel().getPrecision(),
+                                 "RNG &rng", "standardUniformDistribution(rng)");
+    }
+
+    // If any synapse groups use sparse dendritic delay buffers, define function to add input to them
+    const auto &dendriticDelayGroups = modelMerged.getMergedSynapseDendriticDelayUpdateGroups();
+    if(std::any_of(dendriticDelayGroups.cbegin(), dendriticDelayGroups.cend(),
+                   [](const SynapseDendriticDelayUpdateGroupMerged &d){ return d.getArchetype().isSparseDendriticDelayEnabled(); }))
+    {
+        const std::string &precision = modelMerged.getModel().getPrecision();
+        os << "inline void addToDenDelaySparse(" << precision << " *denDelay, unsigned int *denDelayInd, unsigned int *denDelayCnt, ";
+        os << "unsigned int slot, unsigned int numNeurons, unsigned int id, " << precision << " x)";
+        {
+            CodeStream::Scope b(os);
+            os << precision << " &value = denDelay[(slot * numNeurons) + id];" << std::endl;
+
+            // If this entry of the slot is currently empty
+            os << "if(value == " << modelMerged.getModel().scalarExpr(0.0) << ")";
+            {
+                CodeStream::Scope b(os);
+                os << "unsigned int &count = denDelayCnt[slot];" << std::endl;
+
+                // If there's space, add neuron to slot's list of occupied entries
+                os << "if(count < numNeurons)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "denDelayInd[(slot * numNeurons) + count++] = id;" << std::endl;
+                }
+                // Otherwise (only possible if input has cancelled out to exactly zero), flag that slot must be swept densely
+                os << "else";
+                {
+                    CodeStream::Scope b(os);
+                    os << "count = numNeurons + 1;" << std::endl;
+                }
+            }
+            os << "value += x;" << std::endl;
+        }
+        os << std::endl;
+    }
+
+    // If any synapse groups reorder their postsynaptic input, define function to calculate reverse Cuthill-McKee ordering
+    const auto &synapseGroups = modelMerged.getModel().getSynapseGroups();
+    if(std::any_of(synapseGroups.cbegin(), synapseGroups.cend(),
+                   [](const ModelSpec::SynapseGroupValueType &s){ return s.second.isPostsynapticReorderingEnabled(); }))
+    {
+        os << "#include <vector>" << std::endl << std::endl;
+        os << "template<typename I>" << std::endl;
+        os << "inline void reorderPostsynaptic(const unsigned int *rowLength, const I *ind, I *indInSyn, unsigned int *inSynOrder, ";
+        os << "unsigned int numPre, unsigned int numPost, unsigned int rowStride)";
+        {
+            CodeStream::Scope b(os);
+
+            // Build column-major copy of connectivity to find presynaptic neurons targetting each postsynaptic neuron
+            os << "std::vector<unsigned int> colStart(numPost + 1, 0);" << std::endl;
+            os << "for(unsigned int i = 0; i < numPre; i++)";
+            {
+                CodeStream::Scope b(os);
+                os << "for(unsigned int j = 0; j < rowLength[i]; j++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "colStart[ind[(i * rowStride) + j] + 1]++;" << std::endl;
+                }
+            }
+            os << "for(unsigned int k = 0; k < numPost; k++)";
+            {
+                CodeStream::Scope b(os);
+                os << "colStart[k + 1] += colStart[k];" << std::endl;
+            }
+            os << "std::vector<unsigned int> colPre(colStart[numPost]);" << std::endl;
+            os << "std::vector<unsigned int> colEnd(colStart.cbegin(), colStart.cend() - 1);" << std::endl;
+            os << "for(unsigned int i = 0; i < numPre; i++)";
+            {
+                CodeStream::Scope b(os);
+                os << "for(unsigned int j = 0; j < rowLength[i]; j++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "colPre[colEnd[ind[(i * rowStride) + j]]++] = i;" << std::endl;
+                }
+            }
+            os << "const auto degreeLess = [&colStart](unsigned int a, unsigned int b){ return (colStart[a + 1] - colStart[a]) < (colStart[b + 1] - colStart[b]); };" << std::endl;
+            os << std::endl;
+
+            // Start each connected component from its unvisited neuron with the lowest degree
+            os << "std::vector<unsigned int> byDegree(numPost);" << std::endl;
+            os << "for(unsigned int k = 0; k < numPost; k++)";
+            {
+                CodeStream::Scope b(os);
+                os << "byDegree[k] = k;" << std::endl;
+            }
+            os << "std::stable_sort(byDegree.begin(), byDegree.end(), degreeLess);" << std::endl;
+            os << std::endl;
+
+            // Breadth-first search in which neighbours are postsynaptic neurons sharing a presynaptic neuron
+            // **NOTE** each presynaptic row only needs expanding once as it's targets are all visited by the first expansion
+            os << "std::vector<bool> postVisited(numPost, false);" << std::endl;
+            os << "std::vector<bool> preExpanded(numPre, false);" << std::endl;
+            os << "std::vector<unsigned int> order;" << std::endl;
+            os << "order.reserve(numPost);" << std::endl;
+            os << "for(unsigned int start : byDegree)";
+            {
+                CodeStream::Scope b(os);
+                os << "if(postVisited[start])";
+                {
+                    CodeStream::Scope b(os);
+                    os << "continue;" << std::endl;
+                }
+                os << "postVisited[start] = true;" << std::endl;
+                os << "order.push_back(start);" << std::endl;
+                os << "for(size_t q = order.size() - 1; q < order.size(); q++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const unsigned int post = order[q];" << std::endl;
+                    os << "const size_t firstNew = order.size();" << std::endl;
+                    os << "for(unsigned int c = colStart[post]; c < colStart[post + 1]; c++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "const unsigned int pre = colPre[c];" << std::endl;
+                        os << "if(!preExpanded[pre])";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "preExpanded[pre] = true;" << std::endl;
+                            os << "for(unsigned int j = 0; j < rowLength[pre]; j++)";
+                            {
+                                CodeStream::Scope b(os);
+                                os << "const unsigned int neighbour = ind[(pre * rowStride) + j];" << std::endl;
+                                os << "if(!postVisited[neighbour])";
+                                {
+                                    CodeStream::Scope b(os);
+                                    os << "postVisited[neighbour] = true;" << std::endl;
+                                    os << "order.push_back(neighbour);" << std::endl;
+                                }
+                            }
+                        }
+                    }
+                    os << "std::stable_sort(order.begin() + firstNew, order.end(), degreeLess);" << std::endl;
+                }
+            }
+            os << std::endl;
+
+            // Reverse Cuthill-McKee order to obtain position of each neuron's input and translate target indices
+            os << "for(unsigned int k = 0; k < numPost; k++)";
+            {
+                CodeStream::Scope b(os);
+                os << "inSynOrder[order[numPost - 1 - k]] = k;" << std::endl;
+            }
+            os << "for(unsigned int i = 0; i < numPre; i++)";
+            {
+                CodeStream::Scope b(os);
+                os << "for(unsigned int j = 0; j < rowLength[i]; j++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "indInSyn[(i * rowStride) + j] = (I)inSynOrder[ind[(i * rowStride) + j]];" << std::endl;
+                }
+            }
+        }
+        os << std::endl;
+    }
+
+    // If any synapse groups compress their target indices, define functions to encode and decode them
+    if(std::any_of(synapseGroups.cbegin(), synapseGroups.cend(),
+                   [](const ModelSpec::SynapseGroupValueType &s){ return s.second.isCompressedSparseIndEnabled(); }))
+    {
+        // Calculate byte offset of each row once encoded as differences between successive target indices, 7 bits per byte
+        os << "template<typename I>" << std::endl;
+        os << "inline void calcCompressedSparseIndRowOffsets(const unsigned int *rowLength, const I *ind, uint64_t *rowOffset, ";
+        os << "unsigned int numPre, unsigned int rowStride)";
+        {
+            CodeStream::Scope b(os);
+            os << "uint64_t offset = 0;" << std::endl;
+            os << "for(unsigned int i = 0; i < numPre; i++)";
+            {
+                CodeStream::Scope b(os);
+                os << "rowOffset[i] = offset;" << std::endl;
+                os << "unsigned int prevPost = 0;" << std::endl;
+                os << "for(unsigned int j = 0; j < rowLength[i]; j++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const unsigned int post = ind[(i * rowStride) + j];" << std::endl;
+                    os << "if(post < prevPost)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "throw std::runtime_error(\"Compressed sparse indices require the target indices in each row to be sorted in ascending order\");" << std::endl;
+                    }
+                    os << "unsigned int delta = post - prevPost;" << std::endl;
+                    os << "prevPost = post;" << std::endl;
+                    os << "do";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "offset++;" << std::endl;
+                        os << "delta >>= 7;" << std::endl;
+                    }
+                    os << "while(delta != 0);" << std::endl;
+                }
+            }
+            os << "rowOffset[numPre] = offset;" << std::endl;
+        }
+        os << std::endl;
+
+        // Encode each row at its offset, 7 bits per byte with the top bit marking continuation
+        os << "template<typename I>" << std::endl;
+        os << "inline void compressSparseInd(const unsigned int *rowLength, const I *ind, const uint64_t *rowOffset, uint8_t *indCompressed, ";
+        os << "unsigned int numPre, unsigned int rowStride)";
+        {
+            CodeStream::Scope b(os);
+            os << "for(unsigned int i = 0; i < numPre; i++)";
+            {
+                CodeStream::Scope b(os);
+                os << "uint8_t *stream = &indCompressed[rowOffset[i]];" << std::endl;
+                os << "unsigned int prevPost = 0;" << std::endl;
+                os << "for(unsigned int j = 0; j < rowLength[i]; j++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const unsigned int post = ind[(i * rowStride) + j];" << std::endl;
+                    os << "unsigned int delta = post - prevPost;" << std::endl;
+                    os << "prevPost = post;" << std::endl;
+                    os << "while(delta >= 0x80)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "*stream++ = (uint8_t)(delta | 0x80);" << std::endl;
+                        os << "delta >>= 7;" << std::endl;
+                    }
+                    os << "*stream++ = (uint8_t)delta;" << std::endl;
+                }
+            }
+        }
+        os << std::endl;
+
+        os << "inline unsigned int decodeCompressedSparseInd(const uint8_t *&stream)";
+        {
+            CodeStream::Scope b(os);
+            os << "unsigned int delta = 0;" << std::endl;
+            os << "unsigned int shift = 0;" << std::endl;
+            os << "uint8_t byte;" << std::endl;
+            os << "do";
+            {
+                CodeStream::Scope b(os);
+                os << "byte = *stream++;" << std::endl;
+                os << "delta |= (unsigned int)(byte & 0x7F) << shift;" << std::endl;
+                os << "shift += 7;" << std::endl;
+            }
+            os << "while(byte & 0x80);" << std::endl;
+            os << "return delta;" << std::endl;
+        }
+        os << std::endl;
+    }
 }
 //--------------------------------------------------------------------------
 void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
@@ -639,10 +1888,35 @@ void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &modelMerg
         os << "return &devSymbol;" << std::endl;
     }
     os << std::endl;
+
+    // Implement functions used to allocate aligned host arrays
+    genHostArrayAllocation(os);
+
+    // If hardware performance counters are enabled, implement functions to read them
+    if(model.isPerfCountersEnabled()) {
+        genPerfCounters(os);
+    }
+
+    // If profiling is enabled, implement profiler
+    if(model.isProfilingEnabled()) {
+        genProfiler(os, modelMerged);
+    }
 }
 //--------------------------------------------------------------------------
-void Backend::genAllocateMemPreamble(CodeStream &, const ModelSpecMerged &) const
+void Backend::genAllocateMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
 {
+    // If hardware performance counters are enabled, open them
+    if(modelMerged.getModel().isPerfCountersEnabled()) {
+        os << "openPerfCounters();" << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+void Backend::genFreeMemPreamble(CodeStream &os, const ModelSpecMerged &modelMerged) const
+{
+    // If hardware performance counters are enabled, close them
+    if(modelMerged.getModel().isPerfCountersEnabled()) {
+        os << "closePerfCounters();" << std::endl;
+    }
 }
 //--------------------------------------------------------------------------
 void Backend::genStepTimeFinalisePreamble(CodeStream &, const ModelSpecMerged &) const
@@ -659,16 +1933,30 @@ void Backend::genVariableImplementation(CodeStream &os, const std::string &type,
     os << type << " " << name << ";" << std::endl;
 }
 //--------------------------------------------------------------------------
-MemAlloc Backend::genVariableAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation, size_t count) const
+MemAlloc Backend::genVariableAllocation(CodeStream &os, const std::string &type, const std::string &name, VarLocation loc, size_t count) const
 {
-    os << name << " = new " << type << "[" << count << "];" << std::endl;
+    const auto &policy = getAllocationPolicy(loc);
+    const size_t bytes = count * getSize(type);
+    if(policy.alignment == 0) {
+        os << name << " = new " << type << "[" << count << "];" << std::endl;
+    }
+    else {
+        os << name << " = static_cast<" << type << "*>(allocateHostArray(" << bytes << ", " << policy.alignment << ", ";
+        os << policy.hugePageThreshold << ", " << (policy.firstTouch ? "true" : "false") << "));" << std::endl;
+    }
 
-    return MemAlloc::host(count * getSize(type));
+    // Return footprint including any padding added to align array
+    return MemAlloc::host(getAllocatedBytes(bytes, policy));
 }
 //--------------------------------------------------------------------------
-void Backend::genVariableFree(CodeStream &os, const std::string &name, VarLocation) const
+void Backend::genVariableFree(CodeStream &os, const std::string &name, VarLocation loc) const
 {
-    os << "delete[] " << name << ";" << std::endl;
+    if(getAllocationPolicy(loc).alignment == 0) {
+        os << "delete[] " << name << ";" << std::endl;
+    }
+    else {
+        os << "freeHostArray(" << name << ");" << std::endl;
+    }
 }
 //--------------------------------------------------------------------------
 void Backend::genExtraGlobalParamDefinition(CodeStream &definitions, const std::string &type, const std::string &name, VarLocation) const
@@ -682,13 +1970,22 @@ void Backend::genExtraGlobalParamImplementation(CodeStream &os, const std::strin
 }
 //--------------------------------------------------------------------------
 void Backend::genExtraGlobalParamAllocation(CodeStream &os, const std::string &type, const std::string &name, 
-                                            VarLocation, const std::string &countVarName, const std::string &prefix) const
+                                            VarLocation loc, const std::string &countVarName, const std::string &prefix) const
 {
     // Get underlying type
     // **NOTE** could use std::remove_pointer but it seems unnecessarily elaborate
     const std::string underlyingType = Utils::getUnderlyingType(type);
+    const std::string pointer = Utils::isTypePointerToPointer(type) ? ("*" + prefix + name) : (prefix + name);
 
-    os << prefix << name << " = new " << underlyingType << "[" << countVarName << "];" << std::endl;
+    // **NOTE** extra global parameters are freed with genVariableFree so must be allocated using the same policy
+    const auto &policy = getAllocationPolicy(loc);
+    if(policy.alignment == 0) {
+        os << pointer << " = new " << underlyingType << "[" << countVarName << "];" << std::endl;
+    }
+    else {
+        os << pointer << " = static_cast<" << underlyingType << "*>(allocateHostArray((" << countVarName << ") * sizeof(" << underlyingType << "), ";
+        os << policy.alignment << ", " << policy.hugePageThreshold << ", " << (policy.firstTouch ? "true" : "false") << "));" << std::endl;
+    }
 }
 //--------------------------------------------------------------------------
 void Backend::genExtraGlobalParamPush(CodeStream &, const std::string &, const std::string &, 
@@ -745,9 +2042,26 @@ void Backend::genVariableInit(CodeStream &os, const std::string &count, const st
 void Backend::genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMergedBase &sg, 
                                         const Substitutions &kernelSubs, Handler handler) const
 {
+    // If weights are stored in a kernel, loop through kernel elements
+    if(sg.getArchetype().getMatrixType() & SynapseMatrixWeight::KERNEL) {
+        os << "for (unsigned k = 0; k < " << sg.getArchetype().getKernelSizeFlattened() << "; k++)";
+        {
+            CodeStream::Scope b(os);
+
+            Substitutions varSubs(&kernelSubs);
+            varSubs.addVarSubstitution("id_kernel", "k");
+            varSubs.addVarSubstitution("id_syn", "k");
+            handler(os, varSubs);
+        }
+        return;
+    }
+
     if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
         os << "for (unsigned j = 0; j < group.rowLength[" << kernelSubs["id_pre"] << "]; j++)";
     }
+    else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+        os << "for (unsigned j = group.rowPtr[" << kernelSubs["id_pre"] << "]; j < group.rowPtr[" << kernelSubs["id_pre"] << " + 1]; j++)";
+    }
     else {
         os << "for (unsigned j = 0; j < group.numTrgNeurons; j++)";
     }
@@ -759,6 +2073,10 @@ void Backend::genSynapseVariableRowInit(CodeStream &os, const SynapseGroupMerged
             varSubs.addVarSubstitution("id_syn", "(" + kernelSubs["id_pre"] + " * group.rowStride) + j");
             varSubs.addVarSubstitution("id_post", "group.ind[(" + kernelSubs["id_pre"] + " * group.rowStride) + j]");
         }
+        else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            varSubs.addVarSubstitution("id_syn", "j");
+            varSubs.addVarSubstitution("id_post", "group.ind[j]");
+        }
         else {
             varSubs.addVarSubstitution("id_syn", "(" + kernelSubs["id_pre"] + " * group.rowStride) + j");
             varSubs.addVarSubstitution("id_post", "j");
@@ -807,14 +2125,34 @@ void Backend::genCurrentSpikeLikeEventPull(CodeStream&, const NeuronGroupInterna
     assert(!m_Preferences.automaticCopy);
 }
 //--------------------------------------------------------------------------
-MemAlloc Backend::genGlobalDeviceRNG(CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &) const
+void Backend::genArrayStateSave(CodeStream &os, const std::string &type, const std::string &name, VarLocation, const std::string &count) const
+{
+    os << "writeStateSection(stateFile, " << name << ", " << count << " * sizeof(" << type << "));" << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genArrayStateLoad(CodeStream &os, const std::string &type, const std::string &name, VarLocation, const std::string &count) const
+{
+    os << "readStateSection(stateFile, " << name << ", " << count << " * sizeof(" << type << "));" << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genScalarStateSave(CodeStream &os, const std::string &type, const std::string &name, VarLocation) const
+{
+    os << "writeStateSection(stateFile, &" << name << ", sizeof(" << type << "));" << std::endl;
+}
+//--------------------------------------------------------------------------
+void Backend::genScalarStateLoad(CodeStream &os, const std::string &type, const std::string &name, VarLocation) const
+{
+    os << "readStateSection(stateFile, &" << name << ", sizeof(" << type << "));" << std::endl;
+}
+//--------------------------------------------------------------------------
+MemAlloc Backend::genGlobalDeviceRNG(CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &) const
 {
     assert(false);
     return MemAlloc::host(0);
 }
 //--------------------------------------------------------------------------
 MemAlloc Backend::genPopulationRNG(CodeStream &, CodeStream &, CodeStream &, CodeStream &, CodeStream &,
-                                   const std::string&, size_t) const
+                                   CodeStream &, CodeStream &, const std::string&, size_t) const
 {
     // No need for population RNGs for single-threaded CPU
     return MemAlloc::zero();
@@ -946,8 +2284,16 @@ Backend::MemorySpaces Backend::getMergedGroupMemorySpaces(const ModelSpecMerged
 }
 //--------------------------------------------------------------------------
 void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg, const Substitutions &popSubs,
-                                   bool trueSpike, PresynapticUpdateGroupMergedHandler wumThreshHandler, PresynapticUpdateGroupMergedHandler wumSimHandler) const
+                                   bool trueSpike, PresynapticUpdateGroupMergedHandler wumThreshHandler, PresynapticUpdateGroupMergedHandler wumSimHandler,
+                                   PresynapticUpdateGroupMergedHandler wumProceduralConnectHandler) const
 {
+    // If sim code implements a static pulse onto a dense matrix, generate specialised kernel
+    Models::Base::Var staticPulseWeight;
+    if(trueSpike && isDenseStaticPulse(sg, staticPulseWeight)) {
+        genDenseStaticPulseUpdate(os, modelMerged, sg, staticPulseWeight);
+        return;
+    }
+
     // Get suffix based on type of events
     const std::string eventSuffix = trueSpike ? "" : "Evnt";
     const auto *wu = sg.getArchetype().getWUModel();
@@ -969,8 +2315,9 @@ void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelM
         const std::string queueOffset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
         os << "const unsigned int ipre = group.srcSpk" << eventSuffix << "[" << queueOffset << "i];" << std::endl;
 
-        // If this is a spike-like event, insert threshold check for this presynaptic neuron
-        if (!trueSpike) {
+        // If this is a spike-like event emitted by one of several conditions, check it was emitted by this group's condition
+        const bool conditionMaskRequired = (!trueSpike && sg.getArchetype().isEventThresholdConditionMaskRequired());
+        if (conditionMaskRequired) {
             os << "if(";
 
             Substitutions threshSubs(&popSubs);
@@ -989,7 +2336,11 @@ void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelM
         synSubs.addVarSubstitution("id_syn", "synAddress");
 
         if(sg.getArchetype().isDendriticDelayRequired()) {
-            synSubs.addFuncSubstitution("addToInSynDelay", 2, "group.denDelay[" + sg.getDendriticDelayOffset("$(1)") + "ipost] += $(0)");
+            synSubs.addFuncSubstitution("addToInSynDelay", 2, getAddToInSynDelay(sg, "ipost"));
+        }
+        // Otherwise, if postsynaptic input is reordered, accumulate into position of target in reordered inSyn
+        else if(sg.getArchetype().isPostsynapticReorderingEnabled()) {
+            synSubs.addFuncSubstitution("addToInSyn", 1, "group.inSyn[group.indInSyn[synAddress]] += $(0)");
         }
         else {
             synSubs.addFuncSubstitution("addToInSyn", 1, "group.inSyn[ipost] += $(0)");
@@ -997,29 +2348,112 @@ void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelM
 
         if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
             os << "const unsigned int npost = group.rowLength[ipre];" << std::endl;
+
+            // If target indices are compressed, start decoding differences from the start of row's stream
+            if(sg.getArchetype().isCompressedSparseIndEnabled()) {
+                os << "const uint8_t *indStream = &group.indCompressed[group.rowOffset[ipre]];" << std::endl;
+                os << "unsigned int ipost = 0;" << std::endl;
+            }
             os << "for (unsigned int j = 0; j < npost; j++)";
             {
                 CodeStream::Scope b(os);
 
                 // **TODO** seperate stride from max connection
                 os << "const unsigned int synAddress = (ipre * group.rowStride) + j;" << std::endl;
+                if(sg.getArchetype().isCompressedSparseIndEnabled()) {
+                    os << "ipost += decodeCompressedSparseInd(indStream);" << std::endl;
+                }
+                else {
+                    os << "const unsigned int ipost = group.ind[synAddress];" << std::endl;
+                }
+
+                wumSimHandler(os, sg, synSubs);
+            }
+        }
+        else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+            os << "for (unsigned int synAddress = group.rowPtr[ipre]; synAddress < group.rowPtr[ipre + 1]; synAddress++)";
+            {
+                CodeStream::Scope b(os);
                 os << "const unsigned int ipost = group.ind[synAddress];" << std::endl;
 
                 wumSimHandler(os, sg, synSubs);
             }
         }
         else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) {
-            throw std::runtime_error("The single-threaded CPU backend does not support procedural connectivity.");
+            // **NOTE** rows are regenerated every time a presynaptic neuron spikes so, unlike on the GPU
+            // where each row has its own RNG stream, connectivity and weights must be deterministic
+            if(::Utils::isRNGRequired(sg.getArchetype().getConnectivityInitialiser().getSnippet()->getRowBuildCode())
+               || ((sg.getArchetype().getMatrixType() & SynapseMatrixWeight::PROCEDURAL) && ::Utils::isRNGRequired(sg.getArchetype().getWUVarInitialisers())))
+            {
+                throw std::runtime_error("The single-threaded CPU backend does not support procedural connectivity or weights which require an RNG.");
+            }
+
+            // Create substitution stack for generating procedural connectivity code
+            Substitutions connSubs(&synSubs);
+            connSubs.addVarSubstitution("id_post_begin", "0");
+            connSubs.addVarSubstitution("id_thread", "0");
+            connSubs.addVarSubstitution("num_threads", "1");
+            connSubs.addVarSubstitution("num_post", "group.numTrgNeurons");
+
+            // Replace $(id_post) with first 'function' parameter as simulation code is
+            // going to be, in turn, substituted into procedural connectivity generation code
+            Substitutions presynapticUpdateSubs(&synSubs);
+            presynapticUpdateSubs.addVarSubstitution("id_post", "$(0)");
+
+            // If weights are stored in a kernel, calculate index from the kernel coordinates passed as subsequent parameters
+            const size_t numKernelDims = sg.getArchetype().getKernelSize().size();
+            if(sg.getArchetype().getMatrixType() & SynapseMatrixWeight::KERNEL) {
+                presynapticUpdateSubs.addVarSubstitution("id_kernel", sg.getKernelIndex());
+            }
+
+            if(sg.getArchetype().isDendriticDelayRequired()) {
+                presynapticUpdateSubs.addFuncSubstitution("addToInSynDelay", 2, getAddToInSynDelay(sg, "$(id_post)"));
+            }
+            else {
+                presynapticUpdateSubs.addFuncSubstitution("addToInSyn", 1, "group.inSyn[$(id_post)] += $(0)");
+            }
+
+            // Generate presynaptic simulation code into new stringstream-backed code stream
+            std::ostringstream presynapticUpdateStream;
+            CodeStream presynapticUpdate(presynapticUpdateStream);
+            {
+                CodeStream::Scope b(presynapticUpdate);
+                wumSimHandler(presynapticUpdate, sg, presynapticUpdateSubs);
+            }
+
+            // When a synapse should be 'added', substitute in presynaptic update code
+            connSubs.addFuncSubstitution("addSynapse", 1 + numKernelDims, presynapticUpdateStream.str());
+
+            // Generate procedural connectivity code
+            wumProceduralConnectHandler(os, sg, connSubs);
         }
         else if(m_Preferences.enableBitmaskOptimisations && (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK)) {
             // Determine the number of words in each row
             os << "const unsigned int rowWords = ((group.numTrgNeurons + 32 - 1) / 32);" << std::endl;
-            os << "for(unsigned int w = 0; w < rowWords; w++)";
+
+            // If range of non-empty words is stored, only process these
+            if(sg.getArchetype().isBitmaskRowWordRangeEnabled()) {
+                os << "const unsigned int rowWordStart = group.rowWordRange[ipre * 2];" << std::endl;
+                os << "const unsigned int rowWordEnd = group.rowWordRange[(ipre * 2) + 1];" << std::endl;
+            }
+            else {
+                os << "const unsigned int rowWordStart = 0;" << std::endl;
+                os << "const unsigned int rowWordEnd = rowWords;" << std::endl;
+            }
+
+            // Process row 64-bits at a time so empty regions are skipped in fewer iterations
+            os << "const uint32_t *rowGP = &group.gp[ipre * rowWords];" << std::endl;
+            os << "for(unsigned int w = rowWordStart; w < rowWordEnd; w += 2)";
             {
                 CodeStream::Scope b(os);
 
-                // Read row word
-                os << "uint32_t connectivityWord = group.gp[(ipre * rowWords) + w];" << std::endl;
+                // Combine pair of words with the first in the upper half so bits remain ordered by postsynaptic index
+                os << "uint64_t connectivityWord = ((uint64_t)rowGP[w] << 32);" << std::endl;
+                os << "if((w + 1) < rowWordEnd)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "connectivityWord |= rowGP[w + 1];" << std::endl;
+                }
 
                 // Set ipost to first synapse in connectivity word
                 os << "unsigned int ipost = w * 32;" << std::endl;
@@ -1030,11 +2464,11 @@ void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelM
                     CodeStream::Scope b(os);
 
                     // Cound leading zeros (as bits are indexed backwards this is index of next synapse)
-                    os << "const int numLZ = gennCLZ(connectivityWord);" << std::endl;
+                    os << "const int numLZ = gennCLZ64(connectivityWord);" << std::endl;
 
                     // Shift off zeros and the one just discovered
-                    // **NOTE** << 32 appears to result in undefined behaviour
-                    os << "connectivityWord = (numLZ == 31) ? 0 : (connectivityWord << (numLZ + 1));" << std::endl;
+                    // **NOTE** << 64 appears to result in undefined behaviour
+                    os << "connectivityWord = (numLZ == 63) ? 0 : (connectivityWord << (numLZ + 1));" << std::endl;
 
                     // Add to ipost
                     os << "ipost += numLZ;" << std::endl;
@@ -1054,6 +2488,10 @@ void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelM
         }
         // Otherwise (DENSE or BITMASK)
         else {
+            if(sg.getArchetype().isBitmaskRowWordRangeEnabled()) {
+                throw std::runtime_error("Bitmask row word ranges require word-padded rows so can only be used with enableBitmaskOptimisations");
+            }
+
             os << "for (unsigned int ipost = 0; ipost < group.numTrgNeurons; ipost++)";
             {
                 CodeStream::Scope b(os);
@@ -1072,13 +2510,85 @@ void Backend::genPresynapticUpdate(CodeStream &os, const ModelSpecMerged &modelM
                 }
             }
         }
-        // If this is a spike-like event, close braces around threshold check
-        if (!trueSpike) {
+        // If this is a spike-like event, close braces around condition check
+        if (conditionMaskRequired) {
             os << CodeStream::CB(10);
         }
     }
 }
 //--------------------------------------------------------------------------
+void Backend::genDenseStaticPulseUpdate(CodeStream &os, const ModelSpecMerged &modelMerged, const PresynapticUpdateGroupMerged &sg,
+                                        const Models::Base::Var &weight) const
+{
+    const bool delay = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired();
+    os << "// process presynaptic events: True Spikes (dense static pulse)" << std::endl;
+    {
+        CodeStream::Scope b(os);
+        os << "const unsigned int numSpikes = group.srcSpkCnt[" << (delay ? "preReadDelaySlot" : "0") << "];" << std::endl;
+
+        // **NOTE** accessing inSyn through a __restrict pointer rather than the merged
+        // group structure lets the compiler prove stores don't alias weights so the loops vectorise
+        os << modelMerged.getModel().getPrecision() << " *__restrict inSyn = group.inSyn;" << std::endl;
+
+        // If weights are global, every postsynaptic neuron receives the same input from every spike
+        // **NOTE** the weight is still added once per spike rather than adding numSpikes * weight so
+        // floating point rounding matches the generic presynaptic update; the inner loop vectorises
+        if(sg.getArchetype().getMatrixType() & SynapseMatrixWeight::GLOBAL) {
+            Substitutions weightSubs;
+            weightSubs.addVarValueSubstitution(sg.getArchetype().getWUModel()->getVars(), sg.getArchetype().getWUConstInitVals(),
+                                               [&sg](size_t v) { return sg.isWUGlobalVarHeterogeneous(v); },
+                                               "", "group.");
+            std::string weightCode = "$(" + weight.name + ")";
+            weightSubs.applyCheckUnreplaced(weightCode, "static pulse weight : merged" + std::to_string(sg.getIndex()));
+            weightCode = ensureFtype(weightCode, modelMerged.getModel().getPrecision());
+
+            os << "for (unsigned int i = 0; i < numSpikes; i++)";
+            {
+                CodeStream::Scope b(os);
+                os << "for (unsigned int ipost = 0; ipost < group.numTrgNeurons; ipost++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "inSyn[ipost] += " << weightCode << ";" << std::endl;
+                }
+            }
+        }
+        // Otherwise, process spikes in GEMV-style blocks of postsynaptic neurons so inSyn stays in cache
+        else {
+            // **NOTE** weights stored in reduced precision are widened as they are accumulated so
+            // the inner loop streams through less memory and can still be vectorised
+            const size_t weightIndex = sg.getArchetype().getWUModel()->getVarIndex(weight.name);
+            const VarStorage weightStorage = sg.getArchetype().getWUVarStorage(weightIndex);
+            const std::string weightType = getVarStorageType(weight.type, weightStorage);
+            const std::string weightLoad = getVarStorageLoad("gRow[ipost]", weightStorage, sg.getArchetype().getWUVarStorageScale(weightIndex),
+                                                             modelMerged.getModel().getPrecision());
+
+            os << "const unsigned int *__restrict srcSpk = &group.srcSpk[" << (delay ? "preReadDelayOffset" : "0") << "];" << std::endl;
+            os << "const " << weightType << " *__restrict weights = group." << weight.name << ";" << std::endl;
+            os << "for (unsigned int blockStart = 0; blockStart < group.numTrgNeurons; blockStart += " << m_Preferences.denseStaticPulseBlockSize << ")";
+            {
+                CodeStream::Scope b(os);
+                os << "const unsigned int blockEnd = (group.numTrgNeurons < (blockStart + " << m_Preferences.denseStaticPulseBlockSize << ")) ? group.numTrgNeurons : (blockStart + " << m_Preferences.denseStaticPulseBlockSize << ");" << std::endl;
+                os << "for (unsigned int i = 0; i < numSpikes; i++)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "const " << weightType << " *__restrict gRow = &weights[(size_t)srcSpk[i] * group.numTrgNeurons];" << std::endl;
+                    os << "for (unsigned int ipost = blockStart; ipost < blockEnd; ipost++)";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "inSyn[ipost] += " << weightLoad << ";" << std::endl;
+                    }
+                }
+            }
+        }
+    }
+}
+//--------------------------------------------------------------------------
+const AllocationPolicy &Backend::getAllocationPolicy(VarLocation loc) const
+{
+    const auto policy = m_Preferences.locationAllocationPolicies.find(loc);
+    return (policy == m_Preferences.locationAllocationPolicies.cend()) ? m_Preferences.allocationPolicy : policy->second;
+}
+//--------------------------------------------------------------------------
 void Backend::genEmitSpike(CodeStream &os, const NeuronUpdateGroupMerged &ng, const Substitutions &subs, bool trueSpike) const
 {
     // Determine if delay is required and thus, at what offset we should write into the spike queue
@@ -5,6 +5,10 @@
 #include <Objbase.h>
 #endif
 
+#ifdef MPI_ENABLE
+#include <mpi.h>
+#endif
+
 // PLOG includes
 #include <plog/Appenders/ConsoleAppender.h>
 
@@ -30,9 +34,37 @@ Preferences GENN_PREFERENCES;
 // Include model
 #include MODEL
 
+#ifdef MPI_ENABLE
+//--------------------------------------------------------------------------
+// MPIGuard
+//--------------------------------------------------------------------------
+//! Initialises MPI on construction and finalises it on destruction so every exit path from main finalises MPI
+class MPIGuard
+{
+public:
+    MPIGuard(int *argc, char ***argv)
+    {
+        MPI_Init(argc, argv);
+    }
+
+    ~MPIGuard()
+    {
+        MPI_Finalize();
+    }
+
+    MPIGuard(const MPIGuard &) = delete;
+    MPIGuard &operator = (const MPIGuard &) = delete;
+};
+#endif
+
 int main(int argc,     //!< number of arguments; expected to be 2
          char *argv[]) //!< Arguments; expected to contain the target directory for code generation.
 {
+#ifdef MPI_ENABLE
+    // Initialise MPI for the lifetime of the generator
+    const MPIGuard mpiGuard(&argc, &argv);
+#endif
+
     try
     {
         if (argc != 2) {
@@ -51,11 +83,25 @@ int main(int argc,     //!< number of arguments; expected to be 2
         plog::ConsoleAppender<plog::TxtFormatter> consoleAppender;
         Logging::init(GENN_PREFERENCES.logLevel, GENN_PREFERENCES.logLevel, &consoleAppender, &consoleAppender);
 
+#ifdef MPI_ENABLE
+        // Determine which host we are generating code for
+        int hostID = 0;
+        MPI_Comm_rank(MPI_COMM_WORLD, &hostID);
+        LOGI_CODE_GEN << "Generating code for host " << hostID;
+
+        // Remove populations not simulated on this host
+        model.partition(hostID);
+#endif
+
         // Finalize model
         model.finalize();
 
         // Create code generation path
+#ifdef MPI_ENABLE
+        const filesystem::path outputPath = targetPath / (model.getName() + "_CODE_" + std::to_string(hostID));
+#else
         const filesystem::path outputPath = targetPath / (model.getName() + "_CODE");
+#endif
 
         // Create output path
         filesystem::create_directory(outputPath);
@@ -66,7 +112,17 @@ int main(int argc,     //!< number of arguments; expected to be 2
                                                 GENN_PREFERENCES);
 
         // Generate code
-        const auto moduleNames = CodeGenerator::generateAll(model, backend, outputPath).first;
+        const auto output = CodeGenerator::generateAll(model, backend, outputPath);
+        const auto &moduleNames = output.first;
+        const auto &memAlloc = output.second;
+
+        // Write memory requirements so tools such as the benchmark suite can read them
+        {
+            std::ofstream memAllocFile((outputPath / "memAlloc.txt").str());
+            memAllocFile << "hostBytes " << memAlloc.getHostBytes() << std::endl;
+            memAllocFile << "deviceBytes " << memAlloc.getDeviceBytes() << std::endl;
+            memAllocFile << "zeroCopyBytes " << memAlloc.getZeroCopyBytes() << std::endl;
+        }
 
 #ifdef _WIN32
         // If runner GUID file doesn't exist
@@ -47,3 +47,145 @@ size_t CodeGenerator::BackendBase::getSize(const std::string &type) const
         }
     }
 }
+//--------------------------------------------------------------------------
+void CodeGenerator::BackendBase::genDiscreteDistributions(CodeStream &os, const std::string &qualifier, const std::string &suffix,
+                                                          const std::string &type, const std::string &rngParam, const std::string &uniformExpr) const
+{
+    const std::string f = (type == "float") ? "f" : "";
+
+    // Poisson distribution - PTRS transformed rejection (Hormann 1993) for large lambda and multiplication of uniforms otherwise
+    os << "template<typename RNG>" << std::endl;
+    os << qualifier << " unsigned int poissonDist" << suffix << "(" << rngParam << ", " << type << " lambda)";
+    {
+        CodeStream::Scope b(os);
+        os << "if(lambda < 10.0" << f << ")";
+        {
+            CodeStream::Scope b(os);
+            os << "const " << type << " expMinusLambda = exp(-lambda);" << std::endl;
+            os << "unsigned int k = 0;" << std::endl;
+            os << type << " p = " << uniformExpr << ";" << std::endl;
+            os << "while(p > expMinusLambda)";
+            {
+                CodeStream::Scope b(os);
+                os << "k++;" << std::endl;
+                os << "p *= " << uniformExpr << ";" << std::endl;
+            }
+            os << "return k;" << std::endl;
+        }
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            os << "const " << type << " logLambda = log(lambda);" << std::endl;
+            os << "const " << type << " b = 0.931" << f << " + (2.53" << f << " * sqrt(lambda));" << std::endl;
+            os << "const " << type << " a = -0.059" << f << " + (0.02483" << f << " * b);" << std::endl;
+            os << "const " << type << " logInvAlpha = log(1.1239" << f << " + (1.1328" << f << " / (b - 3.4" << f << ")));" << std::endl;
+            os << "const " << type << " vR = 0.9277" << f << " - (3.6224" << f << " / (b - 2.0" << f << "));" << std::endl;
+            os << "while(true)";
+            {
+                CodeStream::Scope b(os);
+                os << "const " << type << " u = " << uniformExpr << " - 0.5" << f << ";" << std::endl;
+                os << "const " << type << " v = " << uniformExpr << ";" << std::endl;
+                os << "const " << type << " us = 0.5" << f << " - fabs(u);" << std::endl;
+                os << "const " << type << " k = floor((((2.0" << f << " * a) / us) + b) * u + lambda + 0.43" << f << ");" << std::endl;
+                os << "if(us >= 0.07" << f << " && v <= vR)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "return (unsigned int)k;" << std::endl;
+                }
+                os << "if(k < 0.0" << f << " || (us < 0.013" << f << " && v > us))";
+                {
+                    CodeStream::Scope b(os);
+                    os << "continue;" << std::endl;
+                }
+                os << "if((log(v) + logInvAlpha - log((a / (us * us)) + b)) <= (-lambda + (k * logLambda) - lgamma(k + 1.0" << f << ")))";
+                {
+                    CodeStream::Scope b(os);
+                    os << "return (unsigned int)k;" << std::endl;
+                }
+            }
+        }
+    }
+    os << std::endl;
+
+    // Binomial distribution - BTRS transformed rejection (Hormann 1993) for large n*p and inversion otherwise
+    os << "template<typename RNG>" << std::endl;
+    os << qualifier << " unsigned int binomialDist" << suffix << "(" << rngParam << ", unsigned int n, " << type << " p)";
+    {
+        CodeStream::Scope b(os);
+        os << "if(p <= 0.0" << f << ")";
+        {
+            CodeStream::Scope b(os);
+            os << "return 0;" << std::endl;
+        }
+        os << "else if(p >= 1.0" << f << ")";
+        {
+            CodeStream::Scope b(os);
+            os << "return n;" << std::endl;
+        }
+        os << std::endl;
+
+        // Sample number of the less-likely outcome and flip result if required
+        os << "const bool flip = (p > 0.5" << f << ");" << std::endl;
+        os << "const " << type << " pMin = flip ? (1.0" << f << " - p) : p;" << std::endl;
+        os << "const " << type << " q = 1.0" << f << " - pMin;" << std::endl;
+        os << "unsigned int k = 0;" << std::endl;
+        os << "if(((" << type << ")n * pMin) < 10.0" << f << ")";
+        {
+            CodeStream::Scope b(os);
+            os << "const " << type << " s = pMin / q;" << std::endl;
+            os << "const " << type << " a = (" << type << ")(n + 1) * s;" << std::endl;
+            os << type << " r = pow(q, (" << type << ")n);" << std::endl;
+            os << type << " u = " << uniformExpr << ";" << std::endl;
+            os << "while(u > r && k < n)";
+            {
+                CodeStream::Scope b(os);
+                os << "u -= r;" << std::endl;
+                os << "k++;" << std::endl;
+                os << "r *= (a / (" << type << ")k) - s;" << std::endl;
+            }
+        }
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            os << "const " << type << " nF = (" << type << ")n;" << std::endl;
+            os << "const " << type << " spq = sqrt(nF * pMin * q);" << std::endl;
+            os << "const " << type << " b = 1.15" << f << " + (2.53" << f << " * spq);" << std::endl;
+            os << "const " << type << " a = -0.0873" << f << " + (0.0248" << f << " * b) + (0.01" << f << " * pMin);" << std::endl;
+            os << "const " << type << " c = (nF * pMin) + 0.5" << f << ";" << std::endl;
+            os << "const " << type << " vR = 0.92" << f << " - (4.2" << f << " / b);" << std::endl;
+            os << "const " << type << " logAlpha = log((2.83" << f << " + (5.1" << f << " / b)) * spq);" << std::endl;
+            os << "const " << type << " logR = log(pMin / q);" << std::endl;
+            os << "const " << type << " m = floor((nF + 1.0" << f << ") * pMin);" << std::endl;
+            os << "const " << type << " logFM = lgamma(m + 1.0" << f << ") + lgamma(nF - m + 1.0" << f << ");" << std::endl;
+            os << "while(true)";
+            {
+                CodeStream::Scope b(os);
+                os << "const " << type << " u = " << uniformExpr << " - 0.5" << f << ";" << std::endl;
+                os << "const " << type << " v = " << uniformExpr << ";" << std::endl;
+                os << "const " << type << " us = 0.5" << f << " - fabs(u);" << std::endl;
+                os << "const " << type << " kF = floor((((2.0" << f << " * a) / us) + b) * u + c);" << std::endl;
+                os << "if(kF < 0.0" << f << " || kF > nF)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "continue;" << std::endl;
+                }
+                os << "if(us >= 0.07" << f << " && v <= vR)";
+                {
+                    CodeStream::Scope b(os);
+                    os << "k = (unsigned int)kF;" << std::endl;
+                    os << "break;" << std::endl;
+                }
+
+                // Accept if v lies under the ratio of the probability mass at kF to that at the mode
+                os << "if((log(v) + logAlpha - log((a / (us * us)) + b)) <= (logFM - lgamma(kF + 1.0" << f << ") - lgamma(nF - kF + 1.0" << f << ") + ((kF - m) * logR)))";
+                {
+                    CodeStream::Scope b(os);
+                    os << "k = (unsigned int)kF;" << std::endl;
+                    os << "break;" << std::endl;
+                }
+            }
+        }
+        os << "return flip ? (n - k) : k;" << std::endl;
+    }
+    os << std::endl;
+}
@@ -346,6 +346,60 @@ void functionSubstitute(std::string &code, const std::string &funcName,
     }
 }
 
+std::string getVarStorageType(const std::string &type, VarStorage storage)
+{
+    switch(storage) {
+    case VarStorage::NATIVE:
+        return type;
+    case VarStorage::HALF:
+    case VarStorage::BFLOAT16:
+        return "uint16_t";
+    case VarStorage::INT8:
+        return "int8_t";
+    case VarStorage::INT16:
+        return "int16_t";
+    default:
+        throw std::runtime_error("Unsupported variable storage format");
+    }
+}
+//--------------------------------------------------------------------------
+std::string getVarStorageLoad(const std::string &value, VarStorage storage, double scale, const std::string &precision)
+{
+    switch(storage) {
+    case VarStorage::NATIVE:
+        return value;
+    case VarStorage::HALF:
+        return "gennHalfToFloat(" + value + ")";
+    case VarStorage::BFLOAT16:
+        return "gennBFloat16ToFloat(" + value + ")";
+    case VarStorage::INT8:
+    case VarStorage::INT16:
+        return "((" + precision + ")" + value + " * " + ensureFtype(Utils::writePreciseString(scale), precision) + ")";
+    default:
+        throw std::runtime_error("Unsupported variable storage format");
+    }
+}
+//--------------------------------------------------------------------------
+std::string getVarStorageStore(const std::string &value, VarStorage storage, double scale, const std::string &precision)
+{
+    // **NOTE** integer formats are narrowed by multiplying by the reciprocal of the scale,
+    // which is exact when scale is a power of two, before rounding and saturating
+    switch(storage) {
+    case VarStorage::NATIVE:
+        return value;
+    case VarStorage::HALF:
+        return "gennFloatToHalf(" + value + ")";
+    case VarStorage::BFLOAT16:
+        return "gennFloatToBFloat16(" + value + ")";
+    case VarStorage::INT8:
+        return "gennFloatToInt8((" + value + ") * " + ensureFtype(Utils::writePreciseString(1.0 / scale), precision) + ")";
+    case VarStorage::INT16:
+        return "gennFloatToInt16((" + value + ") * " + ensureFtype(Utils::writePreciseString(1.0 / scale), precision) + ")";
+    default:
+        throw std::runtime_error("Unsupported variable storage format");
+    }
+}
+//--------------------------------------------------------------------------
 void genScalarEGPPush(CodeStream &os, const MergedStructData &mergedStructData, const std::string &suffix, const BackendBase &backend)
 {
     // Loop through all merged EGPs
@@ -96,6 +96,10 @@ std::pair<std::vector<std::string>, CodeGenerator::MemAlloc> CodeGenerator::gene
         LOGI_CODE_GEN << "\t" << modelMerged.getMergedNeuronSpikeQueueUpdateGroups().size() << " merged neuron spike queue update groups";
         LOGI_CODE_GEN << "\t" << modelMerged.getMergedSynapseDendriticDelayUpdateGroups().size() << " merged synapse dendritic delay update groups";
         LOGI_CODE_GEN << "\t" << modelMerged.getMergedSynapseConnectivityHostInitGroups().size() << " merged synapse connectivity host init groups";
+
+        // Show how much space merged structures take and how much was saved by specialising homogeneous fields
+        LOGI_CODE_GEN << "Merged group structures require " << mergedStructData.getTotalMergedGroupBytes() << " bytes";
+        LOGI_CODE_GEN << "Specialising homogeneous merged group fields saved " << mergedStructData.getTotalSpecialisedFieldBytes() << " bytes";
     }
 
     // Return list of modules
@@ -180,7 +180,16 @@ void genInitWUVarCode(CodeGenerator::CodeStream &os, const CodeGenerator::Backen
                 [&backend, &vars, &varInit, &sg, &ftype, k]
                 (CodeStream &os, Substitutions &varSubs)
                 {
-                    varSubs.addVarSubstitution("value", "group." + vars[k].name + "[" + varSubs["id_syn"] +  "]");
+                    // If variable is stored in reduced precision, initialise local variable to narrow afterwards
+                    const VarStorage storage = sg.getArchetype().getWUVarStorage(k);
+                    const std::string value = "group." + vars[k].name + "[" + varSubs["id_syn"] +  "]";
+                    if(storage == VarStorage::NATIVE) {
+                        varSubs.addVarSubstitution("value", value);
+                    }
+                    else {
+                        os << ftype << " l" << vars[k].name << ";" << std::endl;
+                        varSubs.addVarSubstitution("value", "l" + vars[k].name);
+                    }
                     varSubs.addParamValueSubstitution(varInit.getSnippet()->getParamNames(), varInit.getParams(),
                                                       [k, &sg](size_t p) { return sg.isWUVarInitParamHeterogeneous(k, p); },
                                                       "", "group.", vars[k].name);
@@ -194,6 +203,11 @@ void genInitWUVarCode(CodeGenerator::CodeStream &os, const CodeGenerator::Backen
                     varSubs.applyCheckUnreplaced(code, "initVar : merged" + vars[k].name + std::to_string(sg.getIndex()));
                     code = ensureFtype(code, ftype);
                     os << code << std::endl;
+
+                    if(storage != VarStorage::NATIVE) {
+                        os << value << " = " << getVarStorageStore("l" + vars[k].name, storage,
+                                                                   sg.getArchetype().getWUVarStorageScale(k), ftype) << ";" << std::endl;
+                    }
                 });
         }
     }
@@ -285,6 +299,19 @@ void CodeGenerator::generateInit(CodeStream &os, const MergedStructData &mergedS
                                 os << "group.denDelayInSyn" << i << "[" << denDelayIndex << "] = " << model.scalarExpr(0.0) << ";" << std::endl;
                             }
                         });
+
+                    // If dendritic delay buffer is sparse, zero the number of occupied entries in each slot
+                    if(sg->isSparseDendriticDelayEnabled()) {
+                        backend.genPopVariableInit(os, popSubs,
+                            [sg, i](CodeStream &os, Substitutions &)
+                            {
+                                os << "for (unsigned int d = 0; d < " << sg->getMaxDendriticDelayTimesteps() << "; d++)";
+                                {
+                                    CodeStream::Scope b(os);
+                                    os << "group.denDelayCntInSyn" << i << "[d] = 0;" << std::endl;
+                                }
+                            });
+                    }
                 }
 
                 // If postsynaptic model variables should be individual
@@ -342,13 +369,18 @@ void CodeGenerator::generateInit(CodeStream &os, const MergedStructData &mergedS
         // Dense syanptic matrix variable initialisation
         [&backend, &model](CodeStream &os, const SynapseDenseInitGroupMerged &sg, Substitutions &popSubs)
         {
-            // Loop through rows
-            os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
-            {
-                CodeStream::Scope b(os);
-                popSubs.addVarSubstitution("id_pre", "i");
+            // If weights are stored in a kernel, initialise each kernel element rather than each row
+            if(sg.getArchetype().getMatrixType() & SynapseMatrixWeight::KERNEL) {
                 genInitWUVarCode(os, backend, popSubs, sg, model.getPrecision());
-
+            }
+            // Otherwise, loop through rows
+            else {
+                os << "for(unsigned int i = 0; i < group.numSrcNeurons; i++)";
+                {
+                    CodeStream::Scope b(os);
+                    popSubs.addVarSubstitution("id_pre", "i");
+                    genInitWUVarCode(os, backend, popSubs, sg, model.getPrecision());
+                }
             }
         },
         // Sparse synaptic matrix connectivity initialisation
@@ -156,7 +156,7 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedStructData
 
             // If neuron model sim code references ISyn (could still be the case if there are no incoming synapses)
             // OR any incoming synapse groups have post synaptic models which reference $(Isyn), declare it
-            if (nm->getSimCode().find("$(Isyn)") != std::string::npos ||
+            if (nm->getSimCode().find("$(Isyn)") != std::string::npos || nm->getODECode().find("$(Isyn)") != std::string::npos ||
                 std::any_of(ng.getArchetype().getMergedInSyn().cbegin(), ng.getArchetype().getMergedInSyn().cend(),
                             [](const std::pair<SynapseGroupInternal*, std::vector<SynapseGroupInternal*>> &p)
                             {
@@ -189,11 +189,18 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedStructData
                 const auto *sg = ng.getArchetype().getMergedInSyn()[i].first;;
                 const auto *psm = sg->getPSModel();
 
+                // If postsynaptic input is reordered, look up where this neuron's input is accumulated
+                const std::string inSynIdx = sg->isPostsynapticReorderingEnabled() ? "inSynIdx" + std::to_string(i) : popSubs["id"];
+                if(sg->isPostsynapticReorderingEnabled()) {
+                    os << "const unsigned int " << inSynIdx << " = group.inSynOrderInSyn" << i << "[" << popSubs["id"] << "];" << std::endl;
+                }
+
                 os << "// pull inSyn values in a coalesced access" << std::endl;
-                os << model.getPrecision() << " linSyn = group.inSynInSyn" << i << "[" << popSubs["id"] << "];" << std::endl;
+                os << model.getPrecision() << " linSyn = group.inSynInSyn" << i << "[" << inSynIdx << "];" << std::endl;
 
                 // If dendritic delay is required
-                if (sg->isDendriticDelayRequired()) {
+                // **NOTE** sparse dendritic delay buffers are accumulated into inSyn during synapse update
+                if (sg->isDendriticDelayRequired() && !sg->isSparseDendriticDelayEnabled()) {
                     // Get reference to dendritic delay buffer input for this timestep
                     os << model.getPrecision() << " &denDelayFront = ";
                     os << "group.denDelayInSyn" << i << "[(*group.denDelayPtrInSyn" << i << " * group.numNeurons) + " << popSubs["id"] << "];" << std::endl;
@@ -259,7 +266,7 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedStructData
                 }
 
                 // Write back linSyn
-                os << "group.inSynInSyn"  << i << "[" << inSynSubs["id"] << "] = linSyn;" << std::endl;
+                os << "group.inSynInSyn"  << i << "[" << inSynIdx << "] = linSyn;" << std::endl;
 
                 // Copy any non-readonly postsynaptic model variables back to global state variables dd_V etc
                 for (const auto &v : psm->getVars()) {
@@ -334,7 +341,7 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedStructData
             }*/
 
             os << "// calculate membrane potential" << std::endl;
-            std::string sCode = nm->getSimCode();
+            std::string sCode = nm->getODECode() + nm->getSimCode();
             neuronSubs.applyCheckUnreplaced(sCode, "simCode : merged" + std::to_string(ng.getIndex()));
             sCode = ensureFtype(sCode, model.getPrecision());
 
@@ -343,10 +350,18 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedStructData
             // look for spike type events first.
             if (ng.getArchetype().isSpikeEventRequired()) {
                 // Create local variable
-                os << "bool spikeLikeEvent = false;" << std::endl;
+                // **NOTE** if there are several conditions, record which fired as a mask with a bit per condition
+                const bool conditionMaskRequired = ng.getArchetype().isSpikeEventConditionMaskRequired();
+                if(conditionMaskRequired) {
+                    os << "uint32_t spikeLikeEvent = 0;" << std::endl;
+                }
+                else {
+                    os << "bool spikeLikeEvent = false;" << std::endl;
+                }
 
                 // Loop through outgoing synapse populations that will contribute to event condition code
                 size_t i = 0;
+                unsigned int conditionBit = 0;
                 for(const auto &spkEventCond : ng.getArchetype().getSpikeEventCondition()) {
                     // Replace of parameters, derived parameters and extraglobalsynapse parameters
                     Substitutions spkEventCondSubs(&popSubs);
@@ -371,7 +386,17 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedStructData
                     }
 
                     // Combine this event threshold test with
-                    os << "spikeLikeEvent |= (" << eCode << ");" << std::endl;
+                    if(conditionMaskRequired) {
+                        os << "if (" << eCode << ")";
+                        {
+                            CodeStream::Scope b(os);
+                            os << "spikeLikeEvent |= (1u << " << conditionBit << ");" << std::endl;
+                        }
+                    }
+                    else {
+                        os << "spikeLikeEvent |= (" << eCode << ");" << std::endl;
+                    }
+                    conditionBit++;
 
                     // Close scope for spike-like event test
                     os << CodeStream::CB(31);
@@ -381,6 +406,12 @@ void CodeGenerator::generateNeuronUpdate(CodeStream &os, const MergedStructData
                 os << "if (spikeLikeEvent)";
                 {
                     CodeStream::Scope b(os);
+
+                    // Store conditions which fired so synapse groups don't need to re-evaluate them
+                    if(conditionMaskRequired) {
+                        const std::string queueOffset = ng.getArchetype().isDelayRequired() ? "writeDelayOffset + " : "";
+                        os << "group.spkEvntCond[" << queueOffset << popSubs["id"] << "] = spikeLikeEvent;" << std::endl;
+                    }
                     genEmitSpikeLikeEvent(os, ng, popSubs);
                 }
             }
@@ -1,12 +1,17 @@
 #include "code_generator/generateRunner.h"
 
 // Standard C++ includes
+#include <functional>
+#include <map>
 #include <random>
 #include <sstream>
 #include <string>
+#include <tuple>
+#include <vector>
 
 // GeNN includes
 #include "gennUtils.h"
+#include "logging.h"
 
 // GeNN code generator
 #include "code_generator/codeGenUtils.h"
@@ -25,6 +30,22 @@ using namespace CodeGenerator;
 //--------------------------------------------------------------------------
 namespace
 {
+//! Version of the binary format written by generated saveState functions
+const uint32_t stateVersion = 1;
+
+//! Version of the binary format used for cached connectivity
+const uint32_t connectivityCacheVersion = 2;
+//-------------------------------------------------------------------------
+uint64_t hashFNV1a(const std::string &data)
+{
+    // **NOTE** 64-bit FNV-1a is used as it is simple and stable between compilers
+    uint64_t hash = 14695981039346656037ull;
+    for(const char c : data) {
+        hash = (hash ^ (uint8_t)c) * 1099511628211ull;
+    }
+    return hash;
+}
+//-------------------------------------------------------------------------
 void genTypeRange(CodeStream &os, const std::string &precision, const std::string &prefix)
 {
     os << "#define " << prefix << "_MIN ";
@@ -49,6 +70,143 @@ void genTypeRange(CodeStream &os, const std::string &precision, const std::strin
     os << std::endl;
 }
 //-------------------------------------------------------------------------
+void genVarStorageConversions(CodeStream &os)
+{
+    // **NOTE** these are written into definitions.h so they can also be used from user code
+    // to read and write variables stored in reduced precision. Where available, hardware
+    // conversion instructions are used: F16C on x86 hosts and the CUDA half intrinsics on device
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// reduced-precision variable storage conversions" << std::endl;
+    os << "#ifdef __CUDACC__" << std::endl;
+    os << "#include <cuda_fp16.h>" << std::endl;
+    os << "#define GENN_STORAGE_FUNC __host__ __device__ inline" << std::endl;
+    os << "#else" << std::endl;
+    os << "#define GENN_STORAGE_FUNC inline" << std::endl;
+    os << "#endif" << std::endl;
+    os << "#if defined(__F16C__) && !defined(__CUDA_ARCH__)" << std::endl;
+    os << "#include <immintrin.h>" << std::endl;
+    os << "#endif" << std::endl;
+    os << "#include <cmath>" << std::endl;
+    os << "#include <cstdint>" << std::endl;
+    os << "#include <cstring>" << std::endl;
+    os << std::endl;
+
+    os << "GENN_STORAGE_FUNC float gennHalfToFloat(uint16_t h)";
+    {
+        CodeStream::Scope b(os);
+        os << "#if defined(__CUDA_ARCH__)" << std::endl;
+        os << "return __half2float(__ushort_as_half(h));" << std::endl;
+        os << "#elif defined(__F16C__)" << std::endl;
+        os << "return _cvtsh_ss(h);" << std::endl;
+        os << "#else" << std::endl;
+        os << "const uint32_t exponent = (h >> 10) & 0x1F;" << std::endl;
+        os << "const uint32_t mantissa = h & 0x3FF;" << std::endl;
+        os << "uint32_t bits = (uint32_t)(h & 0x8000) << 16;" << std::endl;
+        os << "if(exponent == 0x1F)";
+        {
+            CodeStream::Scope b(os);
+            os << "bits |= 0x7F800000 | (mantissa << 13);" << std::endl;
+        }
+        os << "else if(exponent != 0)";
+        {
+            CodeStream::Scope b(os);
+            os << "bits |= ((exponent + 112) << 23) | (mantissa << 13);" << std::endl;
+        }
+        os << "else if(mantissa != 0)";
+        {
+            CodeStream::Scope b(os);
+            os << "const float f = (float)mantissa * 5.9604644775390625e-8f;" << std::endl;
+            os << "return (h & 0x8000) ? -f : f;" << std::endl;
+        }
+        os << "float f;" << std::endl;
+        os << "memcpy(&f, &bits, sizeof(float));" << std::endl;
+        os << "return f;" << std::endl;
+        os << "#endif" << std::endl;
+    }
+    os << std::endl;
+
+    os << "GENN_STORAGE_FUNC uint16_t gennFloatToHalf(float f)";
+    {
+        CodeStream::Scope b(os);
+        os << "#if defined(__CUDA_ARCH__)" << std::endl;
+        os << "return __half_as_ushort(__float2half_rn(f));" << std::endl;
+        os << "#elif defined(__F16C__)" << std::endl;
+        os << "return _cvtss_sh(f, 0);" << std::endl;
+        os << "#else" << std::endl;
+        os << "uint32_t bits;" << std::endl;
+        os << "memcpy(&bits, &f, sizeof(float));" << std::endl;
+        os << "const uint16_t sign = (bits >> 16) & 0x8000;" << std::endl;
+        os << "const uint32_t absBits = bits & 0x7FFFFFFF;" << std::endl;
+        os << "// Infinity and NaN" << std::endl;
+        os << "if(absBits >= 0x7F800000)";
+        {
+            CodeStream::Scope b(os);
+            os << "return sign | 0x7C00 | ((absBits > 0x7F800000) ? 0x200 : 0);" << std::endl;
+        }
+        os << "// Values which round to infinity" << std::endl;
+        os << "else if(absBits >= 0x477FF000)";
+        {
+            CodeStream::Scope b(os);
+            os << "return sign | 0x7C00;" << std::endl;
+        }
+        os << "// Normal values - round mantissa to nearest even and rebias exponent" << std::endl;
+        os << "else if(absBits >= 0x38800000)";
+        {
+            CodeStream::Scope b(os);
+            os << "return sign | (uint16_t)((absBits + 0xFFF + ((absBits >> 13) & 1) - 0x38000000) >> 13);" << std::endl;
+        }
+        os << "// Subnormal values - scale to multiples of 2^-24 and round" << std::endl;
+        os << "else";
+        {
+            CodeStream::Scope b(os);
+            os << "float a;" << std::endl;
+            os << "memcpy(&a, &absBits, sizeof(float));" << std::endl;
+            os << "return sign | (uint16_t)rintf(a * 16777216.0f);" << std::endl;
+        }
+        os << "#endif" << std::endl;
+    }
+    os << std::endl;
+
+    os << "GENN_STORAGE_FUNC float gennBFloat16ToFloat(uint16_t b)";
+    {
+        CodeStream::Scope b(os);
+        os << "const uint32_t bits = (uint32_t)b << 16;" << std::endl;
+        os << "float f;" << std::endl;
+        os << "memcpy(&f, &bits, sizeof(float));" << std::endl;
+        os << "return f;" << std::endl;
+    }
+    os << std::endl;
+
+    os << "GENN_STORAGE_FUNC uint16_t gennFloatToBFloat16(float f)";
+    {
+        CodeStream::Scope b(os);
+        os << "uint32_t bits;" << std::endl;
+        os << "memcpy(&bits, &f, sizeof(float));" << std::endl;
+        os << "// Keep NaNs quiet rather than letting rounding turn them into infinity" << std::endl;
+        os << "if((bits & 0x7FFFFFFF) > 0x7F800000)";
+        {
+            CodeStream::Scope b(os);
+            os << "return (uint16_t)((bits >> 16) | 0x40);" << std::endl;
+        }
+        os << "return (uint16_t)((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);" << std::endl;
+    }
+    os << std::endl;
+
+    os << "GENN_STORAGE_FUNC int8_t gennFloatToInt8(float f)";
+    {
+        CodeStream::Scope b(os);
+        os << "return (int8_t)fminf(fmaxf(rintf(f), -128.0f), 127.0f);" << std::endl;
+    }
+    os << std::endl;
+
+    os << "GENN_STORAGE_FUNC int16_t gennFloatToInt16(float f)";
+    {
+        CodeStream::Scope b(os);
+        os << "return (int16_t)fminf(fmaxf(rintf(f), -32768.0f), 32767.0f);" << std::endl;
+    }
+    os << std::endl;
+}
+//-------------------------------------------------------------------------
 void genSpikeMacros(CodeStream &os, const NeuronGroupInternal &ng, bool trueSpike)
 {
     const bool delayRequired = trueSpike
@@ -225,8 +383,9 @@ void genStatePushPull(CodeStream &definitionsFunc, CodeStream &runnerPushFunc, C
 //-------------------------------------------------------------------------
 MemAlloc genVariable(const BackendBase &backend, CodeStream &definitionsVar, CodeStream &definitionsFunc,
                      CodeStream &definitionsInternal, CodeStream &runner, CodeStream &allocations, CodeStream &free,
-                     CodeStream &push, CodeStream &pull, const std::string &type, const std::string &name,
-                     VarLocation loc, bool autoInitialized, size_t count, std::vector<std::string> &statePushPullFunction)
+                     CodeStream &push, CodeStream &pull, CodeStream &saveState, CodeStream &loadState,
+                     const std::string &type, const std::string &name, VarLocation loc, bool autoInitialized, size_t count,
+                     std::vector<std::string> &statePushPullFunction)
 {
     // Generate push and pull functions
     genVarPushPullScope(definitionsFunc, push, pull, loc, backend.isAutomaticCopyEnabled(), name, statePushPullFunction,
@@ -235,6 +394,9 @@ MemAlloc genVariable(const BackendBase &backend, CodeStream &definitionsVar, Cod
             backend.genVariablePushPull(push, pull, type, name, loc, autoInitialized, count);
         });
 
+    // Generate code to save and load variable state
+    backend.genArrayStateSaveLoad(saveState, loadState, type, name, loc, count);
+
     // Generate variables
     return backend.genArray(definitionsVar, definitionsInternal, runner, allocations, free,
                             type, name, loc, count);
@@ -305,12 +467,105 @@ void genExtraGlobalParam(const BackendBase &backend, CodeStream &definitionsVar,
     }
 }
 //-------------------------------------------------------------------------
-MemAlloc genGlobalHostRNG(CodeStream &definitionsVar, CodeStream &runnerVarDecl,
-                          CodeStream &runnerVarAlloc, unsigned int seed)
+template<typename D>
+void genDynamicParams(CodeStream &definitionsVar, CodeStream &definitionsFunc, CodeStream &runner,
+                      CodeStream &dynamicParam, CodeStream &runnerSaveState, CodeStream &runnerLoadState,
+                      const std::string &precision, double dt, const std::string &groupName,
+                      const Snippet::Base *model, const std::vector<double> &params, 
+                      const std::vector<double> &derivedParams, D isParamDynamic)
+{
+    // Determine which derived parameters depend on each parameter by checking whether perturbing it changes their value
+    // **NOTE** derived parameters are calculated using functions only available at code generation time so cannot be recalculated by setters
+    const auto derivedParamDefs = model->getDerivedParams();
+    auto getDependentDerivedParams =
+        [&derivedParamDefs, &params, &derivedParams, dt](size_t paramIndex)
+        {
+            std::vector<std::string> dependentDerivedParams;
+            for(size_t i = 0; i < derivedParamDefs.size(); i++) {
+                for(double perturbedValue : {params[paramIndex] + 1.0, params[paramIndex] * 2.0}) {
+                    auto perturbedParams = params;
+                    perturbedParams[paramIndex] = perturbedValue;
+                    if(derivedParamDefs[i].func(perturbedParams, dt) != derivedParams[i]) {
+                        dependentDerivedParams.push_back(derivedParamDefs[i].name);
+                        break;
+                    }
+                }
+            }
+            return dependentDerivedParams;
+        };
+
+    // Declare runner variable containing dynamic parameter, initialised to original value, and function to set it
+    auto genDynamicParam =
+        [&definitionsVar, &definitionsFunc, &runner, &dynamicParam, &runnerSaveState, &runnerLoadState, &precision, &groupName]
+        (const std::string &paramName, double value, const std::vector<std::string> &dependentDerivedParams)
+        {
+            definitionsVar << "EXPORT_VAR " << precision << " " << paramName << groupName << ";" << std::endl;
+            runner << precision << " " << paramName << groupName << " = " << Utils::writePreciseString(value) << ";" << std::endl;
+
+            definitionsFunc << "EXPORT_FUNC void set" << groupName << paramName << "(" << precision << " value);" << std::endl;
+            dynamicParam << "void set" << groupName << paramName << "(" << precision << " value)";
+            {
+                CodeStream::Scope b(dynamicParam);
+                if(!dependentDerivedParams.empty()) {
+                    dynamicParam << "// **NOTE** derived parameters are not recalculated - call ";
+                    for(size_t i = 0; i < dependentDerivedParams.size(); i++) {
+                        dynamicParam << ((i == 0) ? "" : ", ") << "set" << groupName << dependentDerivedParams[i];
+                    }
+                    dynamicParam << " manually" << std::endl;
+                }
+                dynamicParam << paramName << groupName << " = value;" << std::endl;
+            }
+
+            // Dynamic parameters only live on the host and are pushed to the device every timestep so checkpoint host copy
+            runnerSaveState << "writeStateSection(stateFile, &" << paramName << groupName << ", sizeof(" << precision << "));" << std::endl;
+            runnerLoadState << "readStateSection(stateFile, &" << paramName << groupName << ", sizeof(" << precision << "));" << std::endl;
+        };
+
+    // Loop through dynamic parameters
+    bool anyDynamic = false;
+    const auto paramNames = model->getParamNames();
+    for(size_t i = 0; i < paramNames.size(); i++) {
+        if(isParamDynamic(i)) {
+            const auto dependentDerivedParams = getDependentDerivedParams(i);
+            if(!dependentDerivedParams.empty()) {
+                LOGW_CODE_GEN << "Derived parameters of '" << groupName << "' depending on dynamic parameter '" << paramNames[i]
+                              << "' are not recalculated by set" << groupName << paramNames[i] << " and must be set manually";
+            }
+            genDynamicParam(paramNames[i], params[i], dependentDerivedParams);
+            anyDynamic = true;
+        }
+    }
+
+    // If any parameters are dynamic, derived parameters calculated from them are too
+    if(anyDynamic) {
+        for(size_t i = 0; i < derivedParamDefs.size(); i++) {
+            genDynamicParam(derivedParamDefs[i].name, derivedParams[i], {});
+        }
+    }
+}
+//-------------------------------------------------------------------------
+MemAlloc genGlobalHostRNG(CodeStream &definitionsVar, CodeStream &runnerVarDecl, CodeStream &runnerVarAlloc,
+                          CodeStream &runnerSaveState, CodeStream &runnerLoadState, unsigned int seed)
 {
     definitionsVar << "EXPORT_VAR " << "std::mt19937 rng;" << std::endl;
     runnerVarDecl << "std::mt19937 rng;" << std::endl;
 
+    // Save and load RNG state using its portable textual representation
+    {
+        CodeStream::Scope b(runnerSaveState);
+        runnerSaveState << "std::ostringstream rngStream;" << std::endl;
+        runnerSaveState << "rngStream << rng;" << std::endl;
+        runnerSaveState << "const std::string rngState = rngStream.str();" << std::endl;
+        runnerSaveState << "writeStateSection(stateFile, rngState.data(), rngState.size());" << std::endl;
+    }
+    {
+        CodeStream::Scope b(runnerLoadState);
+        runnerLoadState << "std::string rngState(readStateSectionSize(stateFile), '\\0');" << std::endl;
+        runnerLoadState << "readStateSectionData(stateFile, &rngState[0], rngState.size());" << std::endl;
+        runnerLoadState << "std::istringstream rngStream(rngState);" << std::endl;
+        runnerLoadState << "rngStream >> rng;" << std::endl;
+    }
+
     // If no seed is specified, use system randomness to generate seed sequence
     CodeStream::Scope b(runnerVarAlloc);
     if(seed == 0) {
@@ -339,6 +594,335 @@ MemAlloc genGlobalHostRNG(CodeStream &definitionsVar, CodeStream &runnerVarDecl,
     return MemAlloc::host(sizeof(std::mt19937));
 }
 //-------------------------------------------------------------------------
+void genStateCheckpoint(CodeStream &runner, const std::string &saveState, const std::string &loadState,
+                        const std::string &timePrecision)
+{
+    // Hash code used to save state so checkpoints from models with a different layout are rejected
+    const uint64_t layoutHash = hashFNV1a(saveState);
+
+    // Write helpers to write and read size-prefixed sections, padded to 8 bytes so file can be memory-mapped
+    runner << "static void writeStateSection(FILE *stateFile, const void *data, uint64_t bytes)";
+    {
+        CodeStream::Scope b(runner);
+        runner << "const char padding[8] = {0};" << std::endl;
+        runner << "const uint64_t paddingBytes = (8 - (bytes % 8)) % 8;" << std::endl;
+        runner << "if(std::fwrite(&bytes, sizeof(uint64_t), 1, stateFile) != 1 || std::fwrite(data, 1, bytes, stateFile) != bytes";
+        runner << " || std::fwrite(padding, 1, paddingBytes, stateFile) != paddingBytes)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"Error writing state file\");" << std::endl;
+        }
+    }
+    runner << std::endl;
+    runner << "static uint64_t readStateSectionSize(FILE *stateFile)";
+    {
+        CodeStream::Scope b(runner);
+        runner << "uint64_t bytes;" << std::endl;
+        runner << "if(std::fread(&bytes, sizeof(uint64_t), 1, stateFile) != 1)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"State file is truncated\");" << std::endl;
+        }
+        runner << "return bytes;" << std::endl;
+    }
+    runner << std::endl;
+    runner << "static void readStateSectionData(FILE *stateFile, void *data, uint64_t bytes)";
+    {
+        CodeStream::Scope b(runner);
+        runner << "char padding[8];" << std::endl;
+        runner << "const uint64_t paddingBytes = (8 - (bytes % 8)) % 8;" << std::endl;
+        runner << "if(std::fread(data, 1, bytes, stateFile) != bytes || std::fread(padding, 1, paddingBytes, stateFile) != paddingBytes)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"State file is truncated\");" << std::endl;
+        }
+    }
+    runner << std::endl;
+    runner << "static void readStateSection(FILE *stateFile, void *data, uint64_t bytes)";
+    {
+        CodeStream::Scope b(runner);
+        runner << "if(readStateSectionSize(stateFile) != bytes)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"State file section has unexpected size\");" << std::endl;
+        }
+        runner << "readStateSectionData(stateFile, data, bytes);" << std::endl;
+    }
+    runner << std::endl;
+
+    // Write function to save state
+    // **NOTE** header consists of magic, version, reserved word, layout hash, iT and t - all 8-byte aligned
+    runner << "void saveState(const char *path)";
+    {
+        CodeStream::Scope b(runner);
+        runner << "FILE *stateFile = std::fopen(path, \"wb\");" << std::endl;
+        runner << "if(stateFile == nullptr)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(std::string(\"Cannot open state file '\") + path + \"' for writing\");" << std::endl;
+        }
+        runner << "try";
+        {
+            CodeStream::Scope b(runner);
+            runner << "const uint32_t version[2] = {" << stateVersion << ", 0};" << std::endl;
+            runner << "const uint64_t layoutHash = " << layoutHash << "ull;" << std::endl;
+            runner << "const double time = t;" << std::endl;
+            runner << "if(std::fwrite(\"GENNSTAT\", 1, 8, stateFile) != 8 || std::fwrite(version, sizeof(uint32_t), 2, stateFile) != 2";
+            runner << " || std::fwrite(&layoutHash, sizeof(uint64_t), 1, stateFile) != 1 || std::fwrite(&iT, sizeof(uint64_t), 1, stateFile) != 1";
+            runner << " || std::fwrite(&time, sizeof(double), 1, stateFile) != 1)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "throw std::runtime_error(\"Error writing state file\");" << std::endl;
+            }
+            runner << saveState;
+        }
+        runner << "catch(...)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "std::fclose(stateFile);" << std::endl;
+            runner << "throw;" << std::endl;
+        }
+        runner << "if(std::fclose(stateFile) != 0)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(\"Error writing state file\");" << std::endl;
+        }
+    }
+    runner << std::endl;
+
+    // Write function to load state
+    runner << "void loadState(const char *path)";
+    {
+        CodeStream::Scope b(runner);
+        runner << "FILE *stateFile = std::fopen(path, \"rb\");" << std::endl;
+        runner << "if(stateFile == nullptr)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "throw std::runtime_error(std::string(\"Cannot open state file '\") + path + \"' for reading\");" << std::endl;
+        }
+        runner << "try";
+        {
+            CodeStream::Scope b(runner);
+            runner << "char magic[8];" << std::endl;
+            runner << "uint32_t version[2];" << std::endl;
+            runner << "uint64_t layoutHash;" << std::endl;
+            runner << "double time;" << std::endl;
+            runner << "if(std::fread(magic, 1, 8, stateFile) != 8 || std::fread(version, sizeof(uint32_t), 2, stateFile) != 2";
+            runner << " || std::fread(&layoutHash, sizeof(uint64_t), 1, stateFile) != 1 || std::fread(&iT, sizeof(uint64_t), 1, stateFile) != 1";
+            runner << " || std::fread(&time, sizeof(double), 1, stateFile) != 1)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "throw std::runtime_error(\"State file is truncated\");" << std::endl;
+            }
+            runner << "if(std::string(magic, 8) != \"GENNSTAT\" || version[0] != " << stateVersion << ")";
+            {
+                CodeStream::Scope b(runner);
+                runner << "throw std::runtime_error(\"State file is not a version " << stateVersion << " GeNN state file\");" << std::endl;
+            }
+            runner << "if(layoutHash != " << layoutHash << "ull)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "throw std::runtime_error(\"State file was saved from a different model\");" << std::endl;
+            }
+            runner << "t = (" << timePrecision << ")time;" << std::endl;
+            runner << loadState;
+        }
+        runner << "catch(...)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "std::fclose(stateFile);" << std::endl;
+            runner << "throw;" << std::endl;
+        }
+        runner << "std::fclose(stateFile);" << std::endl;
+    }
+    runner << std::endl;
+}
+//-------------------------------------------------------------------------
+void genConnectivityCache(const BackendBase &backend, CodeStream &definitionsInternalFunc, CodeStream &runner,
+                          const ModelSpecMerged &modelMerged)
+{
+    const ModelSpecInternal &model = modelMerged.getModel();
+    if(!model.getConnectivityCacheDirectory().empty() && model.getSeed() == 0) {
+        LOGW_CODE_GEN << "Connectivity caching is only performed when the model has a fixed seed";
+    }
+
+    for(const auto &s : model.getSynapseGroups()) {
+        if(!model.isConnectivityCacheRequired(s.second)) {
+            continue;
+        }
+
+        // Build key from everything which determines the generated connectivity
+        const auto &connectInit = s.second.getConnectivityInitialiser();
+        const size_t rowStride = backend.getSynapticMatrixRowStride(s.second);
+        std::ostringstream keyStream;
+        keyStream << connectInit.getSnippet()->getRowBuildCode() << std::endl;
+        for(const auto &v : connectInit.getSnippet()->getRowBuildStateVars()) {
+            keyStream << v.type << " " << v.name << " = " << v.value << std::endl;
+        }
+        for(double p : connectInit.getParams()) {
+            keyStream << Utils::writePreciseString(p) << std::endl;
+        }
+        for(double d : connectInit.getDerivedParams()) {
+            keyStream << Utils::writePreciseString(d) << std::endl;
+        }
+        keyStream << s.second.getSrcNeuronGroup()->getNumNeurons() << " " << s.second.getTrgNeuronGroup()->getNumNeurons() << std::endl;
+        keyStream << static_cast<unsigned int>(s.second.getMatrixType()) << " " << rowStride << " " << s.second.getSparseIndType() << std::endl;
+        keyStream << model.getPrecision() << " " << model.getSeed() << std::endl;
+        const uint64_t key = hashFNV1a(keyStream.str());
+
+        // Build filename from synapse group name and key so caches of different configurations can co-exist
+        std::ostringstream filenameStream;
+        filenameStream << model.getConnectivityCacheDirectory() << "/" << s.first << "_" << std::hex << key << ".bin";
+        std::string filename;
+        for(const char c : filenameStream.str()) {
+            if(c == '\\' || c == '"') {
+                filename += '\\';
+            }
+            filename += c;
+        }
+
+        // If connectivity is built using the host RNG, cache its state before building so cached connectivity is only used
+        // if the RNG is in the same state e.g. neuron variables were initialised with the same random numbers beforehand
+        // and its state after building so random numbers drawn subsequently are the same as if connectivity had been built
+        const bool hostRNG = (backend.isGlobalHostRNGRequired(modelMerged)
+                              && Utils::isRNGRequired(connectInit.getSnippet()->getRowBuildCode()));
+        if(hostRNG) {
+            runner << "namespace";
+            {
+                CodeStream::Scope b(runner);
+                runner << "std::string connectivityCachePreBuildRNGState" << s.first << ";" << std::endl;
+            }
+            runner << std::endl;
+        }
+
+        // Get arrays to cache
+        std::vector<std::tuple<std::string, std::string, size_t>> arrays;
+        if(s.second.getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+            arrays.emplace_back("uint32_t", "gp" + s.first, ceilDivide((size_t)s.second.getSrcNeuronGroup()->getNumNeurons() * rowStride, 32));
+        }
+        else {
+            arrays.emplace_back("unsigned int", "rowLength" + s.first, s.second.getSrcNeuronGroup()->getNumNeurons());
+            arrays.emplace_back(s.second.getSparseIndType(), "ind" + s.first, s.second.getSrcNeuronGroup()->getNumNeurons() * rowStride);
+        }
+
+        definitionsInternalFunc << "EXPORT_FUNC bool loadCachedConnectivity" << s.first << "();" << std::endl;
+        definitionsInternalFunc << "EXPORT_FUNC void saveCachedConnectivity" << s.first << "();" << std::endl;
+
+        // Write function to load connectivity from cache, returning false if cache is missing or invalid
+        runner << "bool loadCachedConnectivity" << s.first << "()";
+        {
+            CodeStream::Scope b(runner);
+            if(hostRNG) {
+                // **NOTE** this is always called before connectivity is built so saveCachedConnectivity can use this state
+                runner << "std::ostringstream preBuildRNGStream;" << std::endl;
+                runner << "preBuildRNGStream << rng;" << std::endl;
+                runner << "connectivityCachePreBuildRNGState" << s.first << " = preBuildRNGStream.str();" << std::endl;
+            }
+            runner << "FILE *stateFile = std::fopen(\"" << filename << "\", \"rb\");" << std::endl;
+            runner << "if(stateFile == nullptr)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "return false;" << std::endl;
+            }
+            runner << "try";
+            {
+                CodeStream::Scope b(runner);
+                runner << "char magic[8];" << std::endl;
+                runner << "uint32_t version[2];" << std::endl;
+                runner << "uint64_t key;" << std::endl;
+                runner << "if(std::fread(magic, 1, 8, stateFile) != 8 || std::fread(version, sizeof(uint32_t), 2, stateFile) != 2";
+                runner << " || std::fread(&key, sizeof(uint64_t), 1, stateFile) != 1 || std::string(magic, 8) != \"GENNCONN\"";
+                runner << " || version[0] != " << connectivityCacheVersion << " || key != " << key << "ull)";
+                {
+                    CodeStream::Scope b(runner);
+                    runner << "throw std::runtime_error(\"Invalid connectivity cache\");" << std::endl;
+                }
+                if(hostRNG) {
+                    runner << "std::string preBuildRNGState(readStateSectionSize(stateFile), '\\0');" << std::endl;
+                    runner << "readStateSectionData(stateFile, &preBuildRNGState[0], preBuildRNGState.size());" << std::endl;
+                    runner << "if(preBuildRNGState != connectivityCachePreBuildRNGState" << s.first << ")";
+                    {
+                        CodeStream::Scope b(runner);
+                        runner << "throw std::runtime_error(\"Connectivity cache built from different RNG state\");" << std::endl;
+                    }
+                    runner << "std::string rngState(readStateSectionSize(stateFile), '\\0');" << std::endl;
+                    runner << "readStateSectionData(stateFile, &rngState[0], rngState.size());" << std::endl;
+                }
+                for(const auto &a : arrays) {
+                    backend.genArrayStateLoad(runner, std::get<0>(a), std::get<1>(a), s.second.getSparseConnectivityLocation(), std::to_string(std::get<2>(a)));
+                }
+                if(hostRNG) {
+                    runner << "std::istringstream rngStream(rngState);" << std::endl;
+                    runner << "rngStream >> rng;" << std::endl;
+                }
+            }
+            runner << "catch(const std::runtime_error&)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "std::fclose(stateFile);" << std::endl;
+                runner << "return false;" << std::endl;
+            }
+            runner << "std::fclose(stateFile);" << std::endl;
+            runner << "return true;" << std::endl;
+        }
+        runner << std::endl;
+
+        // Write function to save connectivity to cache
+        // **NOTE** file is written under a temporary name and renamed so partially-written caches are never loaded
+        runner << "void saveCachedConnectivity" << s.first << "()";
+        {
+            CodeStream::Scope b(runner);
+            runner << "FILE *stateFile = std::fopen(\"" << filename << ".tmp\", \"wb\");" << std::endl;
+            runner << "if(stateFile == nullptr)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "throw std::runtime_error(\"Cannot write connectivity cache file '" << filename << "' - does the directory exist?\");" << std::endl;
+            }
+            runner << "try";
+            {
+                CodeStream::Scope b(runner);
+                runner << "const uint32_t version[2] = {" << connectivityCacheVersion << ", 0};" << std::endl;
+                runner << "const uint64_t key = " << key << "ull;" << std::endl;
+                runner << "if(std::fwrite(\"GENNCONN\", 1, 8, stateFile) != 8 || std::fwrite(version, sizeof(uint32_t), 2, stateFile) != 2";
+                runner << " || std::fwrite(&key, sizeof(uint64_t), 1, stateFile) != 1)";
+                {
+                    CodeStream::Scope b(runner);
+                    runner << "throw std::runtime_error(\"Error writing connectivity cache\");" << std::endl;
+                }
+                if(hostRNG) {
+                    runner << "writeStateSection(stateFile, connectivityCachePreBuildRNGState" << s.first << ".data(), connectivityCachePreBuildRNGState" << s.first << ".size());" << std::endl;
+                    runner << "std::ostringstream rngStream;" << std::endl;
+                    runner << "rngStream << rng;" << std::endl;
+                    runner << "const std::string rngState = rngStream.str();" << std::endl;
+                    runner << "writeStateSection(stateFile, rngState.data(), rngState.size());" << std::endl;
+                }
+                for(const auto &a : arrays) {
+                    backend.genArrayStateSave(runner, std::get<0>(a), std::get<1>(a), s.second.getSparseConnectivityLocation(), std::to_string(std::get<2>(a)));
+                }
+            }
+            runner << "catch(...)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "std::fclose(stateFile);" << std::endl;
+                runner << "std::remove(\"" << filename << ".tmp\");" << std::endl;
+                runner << "throw;" << std::endl;
+            }
+            runner << "if(std::fclose(stateFile) != 0)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "throw std::runtime_error(\"Error writing connectivity cache\");" << std::endl;
+            }
+            runner << "std::remove(\"" << filename << "\");" << std::endl;
+            runner << "if(std::rename(\"" << filename << ".tmp\", \"" << filename << "\") != 0)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "throw std::runtime_error(\"Error writing connectivity cache\");" << std::endl;
+            }
+        }
+        runner << std::endl;
+    }
+}
+//-------------------------------------------------------------------------
 void genSynapseConnectivityHostInit(const BackendBase &backend, CodeStream &os, 
                                     const SynapseConnectivityHostInitGroupMerged &sg, const std::string &precision)
 {
@@ -406,6 +990,227 @@ void genSynapseConnectivityHostInit(const BackendBase &backend, CodeStream &os,
 
     }
 }
+//-------------------------------------------------------------------------
+MergedStructData::BatchedArrayMap getBatchedArrays(const BackendBase &backend, const ModelSpecInternal &model)
+{
+    // Get number of elements in each instance's copy of all arrays holding neuron, 
+    // postsynaptic model, current source and synapse state
+    // **NOTE** connectivity is not included as it is shared between instances
+    MergedStructData::BatchedArrayMap batchedArrays;
+    for(const auto &n : model.getNeuronGroups()) {
+        const size_t numNeuronDelaySlots = n.second.getNumNeurons() * n.second.getNumDelaySlots();
+        batchedArrays.emplace("glbSpkCnt" + n.first, n.second.isTrueSpikeRequired() ? n.second.getNumDelaySlots() : 1);
+        batchedArrays.emplace("glbSpk" + n.first, n.second.isTrueSpikeRequired() ? numNeuronDelaySlots : n.second.getNumNeurons());
+        if(n.second.isSpikeEventRequired()) {
+            batchedArrays.emplace("glbSpkCntEvnt" + n.first, n.second.getNumDelaySlots());
+            batchedArrays.emplace("glbSpkEvnt" + n.first, numNeuronDelaySlots);
+            if(n.second.isSpikeEventConditionMaskRequired()) {
+                batchedArrays.emplace("spkEvntCond" + n.first, numNeuronDelaySlots);
+            }
+        }
+        if(n.second.isSpikeTimeRequired()) {
+            batchedArrays.emplace("sT" + n.first, numNeuronDelaySlots);
+        }
+
+        const auto vars = n.second.getNeuronModel()->getVars();
+        for(size_t i = 0; i < vars.size(); i++) {
+            batchedArrays.emplace(vars[i].name + n.first, n.second.isVarQueueRequired(i) ? numNeuronDelaySlots : n.second.getNumNeurons());
+        }
+
+        for(const auto *cs : n.second.getCurrentSources()) {
+            for(const auto &v : cs->getCurrentSourceModel()->getVars()) {
+                batchedArrays.emplace(v.name + cs->getName(), n.second.getNumNeurons());
+            }
+        }
+
+        for(const auto &m : n.second.getMergedInSyn()) {
+            const auto *sg = m.first;
+            batchedArrays.emplace("inSyn" + sg->getPSModelTargetName(), n.second.getNumNeurons());
+            if(sg->isDendriticDelayRequired()) {
+                batchedArrays.emplace("denDelay" + sg->getPSModelTargetName(), sg->getMaxDendriticDelayTimesteps() * n.second.getNumNeurons());
+                if(sg->isSparseDendriticDelayEnabled()) {
+                    batchedArrays.emplace("denDelayInd" + sg->getPSModelTargetName(), sg->getMaxDendriticDelayTimesteps() * n.second.getNumNeurons());
+                    batchedArrays.emplace("denDelayCnt" + sg->getPSModelTargetName(), sg->getMaxDendriticDelayTimesteps());
+                }
+            }
+            if(sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
+                for(const auto &v : sg->getPSModel()->getVars()) {
+                    batchedArrays.emplace(v.name + sg->getPSModelTargetName(), n.second.getNumNeurons());
+                }
+            }
+        }
+    }
+
+    for(const auto &s : model.getSynapseGroups()) {
+        const auto *wu = s.second.getWUModel();
+        if(!s.second.isWeightSharingSlave() && (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)) {
+            for(const auto &v : wu->getVars()) {
+                batchedArrays.emplace(v.name + s.first, s.second.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(s.second));
+            }
+        }
+        else if(!s.second.isWeightSharingSlave() && (s.second.getMatrixType() & SynapseMatrixWeight::KERNEL)) {
+            for(const auto &v : wu->getVars()) {
+                batchedArrays.emplace(v.name + s.first, s.second.getKernelSizeFlattened());
+            }
+        }
+
+        const unsigned int numPreDelaySlots = (s.second.getDelaySteps() == NO_DELAY) ? 1 : s.second.getSrcNeuronGroup()->getNumDelaySlots();
+        for(const auto &v : wu->getPreVars()) {
+            batchedArrays.emplace(v.name + s.first, s.second.getSrcNeuronGroup()->getNumNeurons() * numPreDelaySlots);
+        }
+
+        const unsigned int numPostDelaySlots = (s.second.getBackPropDelaySteps() == NO_DELAY) ? 1 : s.second.getTrgNeuronGroup()->getNumDelaySlots();
+        for(const auto &v : wu->getPostVars()) {
+            batchedArrays.emplace(v.name + s.first, s.second.getTrgNeuronGroup()->getNumNeurons() * numPostDelaySlots);
+        }
+    }
+    return batchedArrays;
+}
+#ifdef MPI_ENABLE
+void genMPISpikeExchange(const BackendBase &backend, CodeStream &runner, const ModelSpecInternal &model)
+{
+    // Build lists of neuron groups whose spikes are sent to and received from each other host
+    // **NOTE** as both lists are built in the (name) order of the model's neuron groups, they match on each host
+    std::map<int, std::vector<const NeuronGroupInternal*>> sendNeuronGroups;
+    std::map<int, std::vector<const NeuronGroupInternal*>> recvNeuronGroups;
+    for(const auto &n : model.getNeuronGroups()) {
+        if(n.second.isRemote()) {
+            recvNeuronGroups[n.second.getHostID()].push_back(&n.second);
+        }
+        else {
+            for(int h : n.second.getSpikeDestinationHosts()) {
+                sendNeuronGroups[h].push_back(&n.second);
+            }
+        }
+    }
+
+    // Helpers to get maximum size of message containing spike counts and spikes of every batch instance of a list
+    // of neuron groups and the indices of the spike count and first spike of a batch instance's current spikes
+    const unsigned int batchSize = model.getBatchSize();
+    auto getMessageSize = 
+        [batchSize](const std::vector<const NeuronGroupInternal*> &neuronGroups)
+        {
+            size_t size = 0;
+            for(const auto *n : neuronGroups) {
+                size += batchSize * (1 + n->getNumNeurons());
+            }
+            return size;
+        };
+    auto getSpikeCntIndex =
+        [batchSize](const NeuronGroupInternal *n)
+        {
+            const bool delayRequired = (n->isDelayRequired() && n->isTrueSpikeRequired());
+            const std::string slot = delayRequired ? ("spkQuePtr" + n->getName()) : "0";
+            return (batchSize == 1) ? slot : ("(batch * " + std::to_string(delayRequired ? n->getNumDelaySlots() : 1) + ") + " + slot);
+        };
+    auto getSpikeIndex =
+        [batchSize](const NeuronGroupInternal *n)
+        {
+            const bool delayRequired = (n->isDelayRequired() && n->isTrueSpikeRequired());
+            const std::string slot = delayRequired ? ("spkQuePtr" + n->getName()) : "0";
+            const std::string index = slot + " * " + std::to_string(n->getNumNeurons());
+            return (batchSize == 1) ? index : ("(batch * " + std::to_string(n->getNumNeurons() * (delayRequired ? n->getNumDelaySlots() : 1)) + ") + " + index);
+        };
+    auto genBatchLoop =
+        [batchSize](CodeStream &os, std::function<void(CodeStream&)> handler)
+        {
+            if(batchSize == 1) {
+                handler(os);
+            }
+            else {
+                os << "for(unsigned int batch = 0; batch < " << batchSize << "; batch++)";
+                {
+                    CodeStream::Scope b(os);
+                    handler(os);
+                }
+            }
+        };
+
+    runner << "// ------------------------------------------------------------------------" << std::endl;
+    runner << "// MPI spike exchange" << std::endl;
+    runner << "// ------------------------------------------------------------------------" << std::endl;
+    runner << "namespace";
+    {
+        CodeStream::Scope b(runner);
+        for(const auto &h : sendNeuronGroups) {
+            runner << "unsigned int mpiSendBuffer" << h.first << "[" << getMessageSize(h.second) << "];" << std::endl;
+        }
+        for(const auto &h : recvNeuronGroups) {
+            runner << "unsigned int mpiRecvBuffer" << h.first << "[" << getMessageSize(h.second) << "];" << std::endl;
+        }
+        runner << "MPI_Request mpiRequests[" << std::max<size_t>(1, sendNeuronGroups.size() + recvNeuronGroups.size()) << "];" << std::endl;
+        runner << "bool mpiSpikeExchangePending = false;" << std::endl;
+    }
+    runner << std::endl;
+
+    runner << "void mpiStartSpikeExchange()";
+    {
+        CodeStream::Scope b(runner);
+
+        // Post receives for spikes from each other host
+        size_t request = 0;
+        for(const auto &h : recvNeuronGroups) {
+            runner << "MPI_Irecv(mpiRecvBuffer" << h.first << ", " << getMessageSize(h.second) << ", MPI_UNSIGNED, " << h.first;
+            runner << ", 0, MPI_COMM_WORLD, &mpiRequests[" << request++ << "]);" << std::endl;
+        }
+
+        // Pack spikes into buffer for each other host and send
+        for(const auto &h : sendNeuronGroups) {
+            CodeStream::Scope b(runner);
+            runner << "unsigned int *buffer = mpiSendBuffer" << h.first << ";" << std::endl;
+            for(const auto *n : h.second) {
+                CodeStream::Scope b(runner);
+                backend.genCurrentTrueSpikePull(runner, *n);
+                genBatchLoop(runner,
+                    [&getSpikeCntIndex, &getSpikeIndex, n](CodeStream &os)
+                    {
+                        os << "const unsigned int spikeCount = glbSpkCnt" << n->getName() << "[" << getSpikeCntIndex(n) << "];" << std::endl;
+                        os << "*buffer++ = spikeCount;" << std::endl;
+                        os << "std::copy_n(&glbSpk" << n->getName() << "[" << getSpikeIndex(n) << "], spikeCount, buffer);" << std::endl;
+                        os << "buffer += spikeCount;" << std::endl;
+                    });
+            }
+            runner << "MPI_Isend(mpiSendBuffer" << h.first << ", (int)(buffer - mpiSendBuffer" << h.first << "), MPI_UNSIGNED, " << h.first;
+            runner << ", 0, MPI_COMM_WORLD, &mpiRequests[" << request++ << "]);" << std::endl;
+        }
+        runner << "mpiSpikeExchangePending = true;" << std::endl;
+    }
+    runner << std::endl;
+
+    runner << "void mpiCompleteSpikeExchange()";
+    {
+        CodeStream::Scope b(runner);
+        runner << "if(!mpiSpikeExchangePending)";
+        {
+            CodeStream::Scope b(runner);
+            runner << "return;" << std::endl;
+        }
+
+        // Wait for all sends and receives to complete
+        runner << "MPI_Waitall(" << (sendNeuronGroups.size() + recvNeuronGroups.size()) << ", mpiRequests, MPI_STATUSES_IGNORE);" << std::endl;
+
+        // Unpack spikes received from each other host
+        for(const auto &h : recvNeuronGroups) {
+            CodeStream::Scope b(runner);
+            runner << "const unsigned int *buffer = mpiRecvBuffer" << h.first << ";" << std::endl;
+            for(const auto *n : h.second) {
+                CodeStream::Scope b(runner);
+                genBatchLoop(runner,
+                    [&getSpikeCntIndex, &getSpikeIndex, n](CodeStream &os)
+                    {
+                        os << "const unsigned int spikeCount = *buffer++;" << std::endl;
+                        os << "glbSpkCnt" << n->getName() << "[" << getSpikeCntIndex(n) << "] = spikeCount;" << std::endl;
+                        os << "std::copy_n(buffer, spikeCount, &glbSpk" << n->getName() << "[" << getSpikeIndex(n) << "]);" << std::endl;
+                        os << "buffer += spikeCount;" << std::endl;
+                    });
+                backend.genCurrentTrueSpikePush(runner, *n);
+            }
+        }
+        runner << "mpiSpikeExchangePending = false;" << std::endl;
+    }
+    runner << std::endl;
+}
+#endif  // MPI_ENABLE
 }   // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -418,6 +1223,12 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     // Track memory allocations, initially starting from zero
     auto mem = MemAlloc::zero();
 
+    // Determine which arrays are allocated separately for each instance of batched model
+    // **NOTE** this is required before merged structures are generated so pointers to each instance's state can be offset
+    const ModelSpecInternal &model = modelMerged.getModel();
+    const size_t batchSize = model.getBatchSize();
+    mergedStructData.setBatch(model.getBatchSize(), getBatchedArrays(backend, model));
+
     // Write definitions preamble
     definitions << "#pragma once" << std::endl;
 
@@ -441,7 +1252,6 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     backend.genDefinitionsInternalPreamble(definitionsInternal, modelMerged);
     
     // write DT macro
-    const ModelSpecInternal &model = modelMerged.getModel();
     if (model.getTimePrecision() == "float") {
         definitions << "#define DT " << std::to_string(model.getDT()) << "f" << std::endl;
     } else {
@@ -462,8 +1272,23 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     definitions << "#define delB(x,i) x= ((x) & (~(0x80000000 >> (i)))) //!< Set the bit at the specified position i in x to 0" << std::endl;
     definitions << std::endl;
 
+    // If any synapse groups store weight update model variables in reduced precision, write conversion functions
+    if(std::any_of(model.getSynapseGroups().cbegin(), model.getSynapseGroups().cend(),
+                   [](const ModelSpec::SynapseGroupValueType &s){ return s.second.isWUVarStorageReduced(); }))
+    {
+        genVarStorageConversions(definitions);
+    }
+
     // Write runner preamble
     runner << "#include \"definitionsInternal.h\"" << std::endl << std::endl;
+    runner << "#include <cstdio>" << std::endl;
+    runner << "#include <sstream>" << std::endl;
+    runner << "#include <stdexcept>" << std::endl;
+    runner << "#include <vector>" << std::endl << std::endl;
+#ifdef MPI_ENABLE
+    runner << "#include <algorithm>" << std::endl;
+    runner << "#include <mpi.h>" << std::endl << std::endl;
+#endif
     backend.genRunnerPreamble(runner, modelMerged);
 
     // Create codestreams to generate different sections of runner and definitions
@@ -476,6 +1301,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     std::stringstream runnerPullFuncStream;
     std::stringstream runnerGetterFuncStream;
     std::stringstream runnerStepTimeFinaliseStream;
+    std::stringstream runnerSaveStateStream;
+    std::stringstream runnerLoadStateStream;
     std::stringstream definitionsVarStream;
     std::stringstream definitionsFuncStream;
     std::stringstream definitionsInternalVarStream;
@@ -489,6 +1316,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     CodeStream runnerPullFunc(runnerPullFuncStream);
     CodeStream runnerGetterFunc(runnerGetterFuncStream);
     CodeStream runnerStepTimeFinalise(runnerStepTimeFinaliseStream);
+    CodeStream runnerSaveState(runnerSaveStateStream);
+    CodeStream runnerLoadState(runnerLoadStateStream);
     CodeStream definitionsVar(definitionsVarStream);
     CodeStream definitionsFunc(definitionsFuncStream);
     CodeStream definitionsInternalVar(definitionsInternalVarStream);
@@ -514,11 +1343,12 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
 
     // If backend requires a global device RNG to simulate (or initialize) this model
     if(backend.isGlobalDeviceRNGRequired(modelMerged)) {
-        mem += backend.genGlobalDeviceRNG(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree);
+        mem += backend.genGlobalDeviceRNG(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                          runnerSaveState, runnerLoadState);
     }
     // If backend required a global host RNG to simulate (or initialize) this model, generate a standard Mersenne Twister
     if(backend.isGlobalHostRNGRequired(modelMerged)) {
-        mem += genGlobalHostRNG(definitionsVar, runnerVarDecl, runnerVarAlloc, model.getSeed());
+        mem += genGlobalHostRNG(definitionsVar, runnerVarDecl, runnerVarAlloc, runnerSaveState, runnerLoadState, model.getSeed());
     }
     allVarStreams << std::endl;
 
@@ -539,6 +1369,13 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     backend.genScalar(definitionsVar, definitionsInternalVar, runnerVarDecl, "double", "synapseDynamicsTime", VarLocation::HOST);
     backend.genScalar(definitionsVar, definitionsInternalVar, runnerVarDecl, "double", "initSparseTime", VarLocation::HOST);
 
+    // Generate arrays to store hardware performance counters accumulated in each phase
+    // **NOTE** like the timing scalars, these are ALWAYS generated and contain cycles, instructions, LLC misses and branch misses
+    for(const std::string phase : {"neuronUpdate", "init", "presynapticUpdate", "postsynapticUpdate", "synapseDynamics", "initSparse"}) {
+        definitionsVar << "EXPORT_VAR unsigned long long " << phase << "PerfCounters[4];" << std::endl;
+        runnerVarDecl << "unsigned long long " << phase << "PerfCounters[4];" << std::endl;
+    }
+
     // If timing is actually enabled
     if(model.isTimingEnabled()) {
         // Create neuron timer
@@ -684,13 +1521,17 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         genSpikeMacros(definitionsVar, n.second, true);
 
         // True spike variables
-        const size_t numNeuronDelaySlots = n.second.getNumNeurons() * n.second.getNumDelaySlots();
-        const size_t numSpikeCounts = n.second.isTrueSpikeRequired() ? n.second.getNumDelaySlots() : 1;
-        const size_t numSpikes = n.second.isTrueSpikeRequired() ? numNeuronDelaySlots : n.second.getNumNeurons();
+        const size_t numNeuronDelaySlots = n.second.getNumNeurons() * n.second.getNumDelaySlots() * batchSize;
+        const size_t numSpikeCounts = n.second.isTrueSpikeRequired() ? (n.second.getNumDelaySlots() * batchSize) : batchSize;
+        const size_t numSpikes = n.second.isTrueSpikeRequired() ? numNeuronDelaySlots : (n.second.getNumNeurons() * batchSize);
         mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                 "unsigned int", "glbSpkCnt" + n.first, n.second.getSpikeLocation(), numSpikeCounts);
         mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                 "unsigned int", "glbSpk" + n.first, n.second.getSpikeLocation(), numSpikes);
+        backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "glbSpkCnt" + n.first,
+                                      n.second.getSpikeLocation(), numSpikeCounts);
+        backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "glbSpk" + n.first,
+                                      n.second.getSpikeLocation(), numSpikes);
 
         // True spike push and pull functions
         genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getSpikeLocation(),
@@ -723,10 +1564,22 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
             // Spike-like event variables
             mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                     "unsigned int", "glbSpkCntEvnt" + n.first, n.second.getSpikeEventLocation(),
-                                    n.second.getNumDelaySlots());
+                                    n.second.getNumDelaySlots() * batchSize);
             mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                     "unsigned int", "glbSpkEvnt" + n.first, n.second.getSpikeEventLocation(),
                                     numNeuronDelaySlots);
+            backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "glbSpkCntEvnt" + n.first,
+                                          n.second.getSpikeEventLocation(), n.second.getNumDelaySlots() * batchSize);
+            backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "glbSpkEvnt" + n.first,
+                                          n.second.getSpikeEventLocation(), numNeuronDelaySlots);
+
+            // If spike-like events can be emitted by several conditions, allocate mask of conditions each neuron's event was emitted by
+            if(n.second.isSpikeEventConditionMaskRequired()) {
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        "uint32_t", "spkEvntCond" + n.first, VarLocation::DEVICE, numNeuronDelaySlots);
+                backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "uint32_t", "spkEvntCond" + n.first,
+                                              VarLocation::DEVICE, numNeuronDelaySlots);
+            }
 
             // Spike-like event push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getSpikeEventLocation(),
@@ -734,7 +1587,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 [&]()
                 {
                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
-                                                "unsigned int", "glbSpkCntEvnt" + n.first, n.second.getSpikeLocation(), true, n.second.getNumDelaySlots());
+                                                "unsigned int", "glbSpkCntEvnt" + n.first, n.second.getSpikeLocation(), true, n.second.getNumDelaySlots() * batchSize);
                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc,
                                                 "unsigned int", "glbSpkEvnt" + n.first, n.second.getSpikeLocation(), true, numNeuronDelaySlots);
                 });
@@ -755,6 +1608,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         // If neuron group has axonal delays
         if (n.second.isDelayRequired()) {
             backend.genScalar(definitionsVar, definitionsInternalVar, runnerVarDecl, "unsigned int", "spkQuePtr" + n.first, VarLocation::HOST_DEVICE);
+            backend.genScalarStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "spkQuePtr" + n.first, VarLocation::HOST_DEVICE);
         }
 
         // If neuron group needs to record its spike times
@@ -762,6 +1616,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
             mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                     model.getTimePrecision(), "sT" + n.first, n.second.getSpikeTimeLocation(),
                                     numNeuronDelaySlots);
+            backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, model.getTimePrecision(), "sT" + n.first,
+                                          n.second.getSpikeTimeLocation(), numNeuronDelaySlots);
 
             // Generate push and pull functions
             genVarPushPullScope(definitionsFunc, runnerPushFunc, runnerPullFunc, n.second.getSpikeTimeLocation(),
@@ -776,7 +1632,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
 
         // If neuron group needs per-neuron RNGs
         if(n.second.isSimRNGRequired()) {
-            mem += backend.genPopulationRNG(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree, "rng" + n.first, n.second.getNumNeurons());
+            mem += backend.genPopulationRNG(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            runnerSaveState, runnerLoadState, "rng" + n.first, n.second.getNumNeurons());
         }
 
         // Neuron state variables
@@ -785,10 +1642,10 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         std::vector<std::string> neuronStatePushPullFunctions;
         for(size_t i = 0; i < vars.size(); i++) {
             const auto *varInitSnippet = n.second.getVarInitialisers()[i].getSnippet();
-            const size_t count = n.second.isVarQueueRequired(i) ? n.second.getNumNeurons() * n.second.getNumDelaySlots() : n.second.getNumNeurons();
+            const size_t count = (n.second.isVarQueueRequired(i) ? n.second.getNumNeurons() * n.second.getNumDelaySlots() : n.second.getNumNeurons()) * batchSize;
             const bool autoInitialized = !varInitSnippet->getCode().empty();
             mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                               runnerPushFunc, runnerPullFunc, vars[i].type, vars[i].name + n.first,
+                               runnerPushFunc, runnerPullFunc, runnerSaveState, runnerLoadState, vars[i].type, vars[i].name + n.first,
                                n.second.getVarLocation(i), autoInitialized, count, neuronStatePushPullFunctions);
 
             // Current variable push and pull functions
@@ -837,6 +1694,10 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                 true, n.second.getExtraGlobalParamLocation(i));
         }
 
+        genDynamicParams(definitionsVar, definitionsFunc, runnerVarDecl, runnerExtraGlobalParamFunc,
+                         runnerSaveState, runnerLoadState, model.getPrecision(), model.getDT(), n.first, neuronModel, n.second.getParams(), n.second.getDerivedParams(),
+                         [&n](size_t i) { return n.second.isParamDynamic(i); });
+
         if(!n.second.getCurrentSources().empty()) {
             allVarStreams << "// current source variables" << std::endl;
         }
@@ -849,8 +1710,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 const auto *varInitSnippet = cs->getVarInitialisers()[i].getSnippet();
                 const bool autoInitialized = !varInitSnippet->getCode().empty();
                 mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                   runnerPushFunc, runnerPullFunc, csVars[i].type, csVars[i].name + cs->getName(),
-                                   cs->getVarLocation(i), autoInitialized, n.second.getNumNeurons(), currentSourceStatePushPullFunctions);
+                                   runnerPushFunc, runnerPullFunc, runnerSaveState, runnerLoadState, csVars[i].type, csVars[i].name + cs->getName(),
+                                   cs->getVarLocation(i), autoInitialized, n.second.getNumNeurons() * batchSize, currentSourceStatePushPullFunctions);
 
                 // Loop through EGPs required to initialize current source variable
                 const auto extraGlobalParams = varInitSnippet->getExtraGlobalParams();
@@ -886,16 +1747,36 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         // **NOTE** because of merging we need to loop through postsynaptic models in this
         for(const auto &m : n.second.getMergedInSyn()) {
             const auto *sg = m.first;
+            const size_t numTrgNeurons = sg->getTrgNeuronGroup()->getNumNeurons() * batchSize;
 
             mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                     model.getPrecision(), "inSyn" + sg->getPSModelTargetName(), sg->getInSynLocation(),
-                                    sg->getTrgNeuronGroup()->getNumNeurons());
+                                    numTrgNeurons);
+            backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, model.getPrecision(), "inSyn" + sg->getPSModelTargetName(),
+                                          sg->getInSynLocation(), numTrgNeurons);
 
             if (sg->isDendriticDelayRequired()) {
                 mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                         model.getPrecision(), "denDelay" + sg->getPSModelTargetName(), sg->getDendriticDelayLocation(),
-                                        sg->getMaxDendriticDelayTimesteps() * sg->getTrgNeuronGroup()->getNumNeurons());
+                                        sg->getMaxDendriticDelayTimesteps() * numTrgNeurons);
                 backend.genScalar(definitionsVar, definitionsInternalVar, runnerVarDecl, "unsigned int", "denDelayPtr" + sg->getPSModelTargetName(), VarLocation::HOST_DEVICE);
+                backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, model.getPrecision(), "denDelay" + sg->getPSModelTargetName(),
+                                              sg->getDendriticDelayLocation(), sg->getMaxDendriticDelayTimesteps() * numTrgNeurons);
+                backend.genScalarStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "denDelayPtr" + sg->getPSModelTargetName(), VarLocation::HOST_DEVICE);
+
+                // If dendritic delay buffer is sparse, allocate per-slot lists of occupied entries and their lengths
+                if(sg->isSparseDendriticDelayEnabled()) {
+                    mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            "unsigned int", "denDelayInd" + sg->getPSModelTargetName(), sg->getDendriticDelayLocation(),
+                                            sg->getMaxDendriticDelayTimesteps() * numTrgNeurons);
+                    mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            "unsigned int", "denDelayCnt" + sg->getPSModelTargetName(), sg->getDendriticDelayLocation(),
+                                            sg->getMaxDendriticDelayTimesteps() * batchSize);
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "denDelayInd" + sg->getPSModelTargetName(),
+                                                  sg->getDendriticDelayLocation(), sg->getMaxDendriticDelayTimesteps() * numTrgNeurons);
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "denDelayCnt" + sg->getPSModelTargetName(),
+                                                  sg->getDendriticDelayLocation(), sg->getMaxDendriticDelayTimesteps() * batchSize);
+                }
             }
 
             if (sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM) {
@@ -903,7 +1784,9 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 for(size_t v = 0; v < psmVars.size(); v++) {
                     mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                             psmVars[v].type, psmVars[v].name + sg->getPSModelTargetName(), sg->getPSVarLocation(v),
-                                            sg->getTrgNeuronGroup()->getNumNeurons());
+                                            numTrgNeurons);
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, psmVars[v].type, psmVars[v].name + sg->getPSModelTargetName(),
+                                                  sg->getPSVarLocation(v), numTrgNeurons);
 
                     // Loop through EGPs required to initialize PSM variable
                     const auto extraGlobalParams = sg->getPSVarInitialisers()[v].getSnippet()->getExtraGlobalParams();
@@ -930,8 +1813,17 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
             if(s.second.getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
                 const size_t gpSize = ceilDivide((size_t)s.second.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(s.second), 32);
                 mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                   runnerPushFunc, runnerPullFunc, "uint32_t", "gp" + s.second.getName(),
+                                   runnerPushFunc, runnerPullFunc, runnerSaveState, runnerLoadState, "uint32_t", "gp" + s.second.getName(),
                                    s.second.getSparseConnectivityLocation(), autoInitialized, gpSize, connectivityPushPullFunctions);
+
+                // If enabled, allocate array to hold range of non-empty words in each row
+                if(s.second.isBitmaskRowWordRangeEnabled()) {
+                    mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            "unsigned int", "rowWordRange" + s.second.getName(), s.second.getSparseConnectivityLocation(),
+                                            s.second.getSrcNeuronGroup()->getNumNeurons() * 2);
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "rowWordRange" + s.second.getName(),
+                                                  s.second.getSparseConnectivityLocation(), s.second.getSrcNeuronGroup()->getNumNeurons() * 2);
+                }
             }
             else if(s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
                 const VarLocation varLoc = s.second.getSparseConnectivityLocation();
@@ -944,10 +1836,60 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 // Row lengths
                 mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                         "unsigned int", "rowLength" + s.second.getName(), varLoc, s.second.getSrcNeuronGroup()->getNumNeurons());
-
-                // Target indices
-                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                        s.second.getSparseIndType(), "ind" + s.second.getName(), varLoc, size);
+                backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "rowLength" + s.second.getName(),
+                                              varLoc, s.second.getSrcNeuronGroup()->getNumNeurons());
+
+                // If target indices are compressed, allocate padded target indices only to stage connectivity during initialisation
+                // **NOTE** these are freed once encoded so aren't included in memory estimate or checkpoints
+                if(s.second.isCompressedSparseIndEnabled()) {
+                    const unsigned int numSrcNeurons = s.second.getSrcNeuronGroup()->getNumNeurons();
+                    const std::string compressedSize = "rowOffset" + s.second.getName() + "[" + std::to_string(numSrcNeurons) + "]";
+                    backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                     s.second.getSparseIndType(), "ind" + s.second.getName(), varLoc, size);
+
+                    // Byte offset of each row in stream of encoded rows
+                    mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            "uint64_t", "rowOffset" + s.second.getName(), varLoc, numSrcNeurons + 1);
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "uint64_t", "rowOffset" + s.second.getName(),
+                                                  varLoc, numSrcNeurons + 1);
+
+                    // Stream of encoded rows is only allocated once its size is known
+                    // **NOTE** pointer is reset when freed so re-allocating after freeMem doesn't free it again
+                    backend.genVariableDefinition(definitionsVar, definitionsInternalVar, "uint8_t*", "indCompressed" + s.second.getName(), varLoc);
+                    backend.genVariableImplementation(runnerVarDecl, "uint8_t*", "indCompressed" + s.second.getName(), varLoc);
+                    backend.genVariableFree(runnerVarFree, "indCompressed" + s.second.getName(), varLoc);
+                    runnerVarFree << "indCompressed" << s.second.getName() << " = nullptr;" << std::endl;
+
+                    // Before loading stream, allocate it using row offsets loaded from the same file
+                    runnerLoadState << "allocateIndCompressed" << s.second.getName() << "(" << compressedSize << ");" << std::endl;
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "uint8_t", "indCompressed" + s.second.getName(),
+                                                  varLoc, compressedSize);
+
+                    // Write function to (re)allocate stream and point merged structures at it
+                    definitionsInternalFunc << "EXPORT_FUNC void allocateIndCompressed" << s.second.getName() << "(uint64_t count);" << std::endl;
+                    runnerExtraGlobalParamFunc << "void allocateIndCompressed" << s.second.getName() << "(uint64_t count)";
+                    {
+                        CodeStream::Scope a(runnerExtraGlobalParamFunc);
+                        backend.genVariableFree(runnerExtraGlobalParamFunc, "indCompressed" + s.second.getName(), varLoc);
+                        backend.genExtraGlobalParamAllocation(runnerExtraGlobalParamFunc, "uint8_t*", "indCompressed" + s.second.getName(), varLoc);
+
+                        const auto mergedDestinations = mergedStructData.getMergedEGPs().find(backend.getArrayPrefix() + "indCompressed" + s.second.getName());
+                        if(mergedDestinations != mergedStructData.getMergedEGPs().cend()) {
+                            for(const auto &v : mergedDestinations->second) {
+                                runnerExtraGlobalParamFunc << "pushMerged" << v.first << v.second.mergedGroupIndex << v.second.fieldName << "ToDevice(";
+                                runnerExtraGlobalParamFunc << v.second.groupIndex << ", " << backend.getArrayPrefix() << "indCompressed" << s.second.getName() << ");" << std::endl;
+                            }
+                        }
+                    }
+                    runnerExtraGlobalParamFunc << std::endl;
+                }
+                // Otherwise, allocate padded target indices
+                else {
+                    mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            s.second.getSparseIndType(), "ind" + s.second.getName(), varLoc, size);
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, s.second.getSparseIndType(), "ind" + s.second.getName(),
+                                                  varLoc, size);
+                }
 
                 // **TODO** remap is not always required
                 if(backend.isSynRemapRequired() && !s.second.getWUModel()->getSynapseDynamicsCode().empty()) {
@@ -955,6 +1897,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                     // **THINK** this is over-allocating
                     mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                             "unsigned int", "synRemap" + s.second.getName(), VarLocation::DEVICE, size + 1);
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "synRemap" + s.second.getName(),
+                                                  VarLocation::DEVICE, size + 1);
                 }
 
                 // **TODO** remap is not always required
@@ -964,10 +1908,29 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                     // Allocate column lengths
                     mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                             "unsigned int", "colLength" + s.second.getName(), VarLocation::DEVICE, s.second.getTrgNeuronGroup()->getNumNeurons());
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "colLength" + s.second.getName(),
+                                                  VarLocation::DEVICE, s.second.getTrgNeuronGroup()->getNumNeurons());
 
                     // Allocate remap
                     mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
                                             "unsigned int", "remap" + s.second.getName(), VarLocation::DEVICE, postSize);
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "remap" + s.second.getName(),
+                                                  VarLocation::DEVICE, postSize);
+                }
+
+                // If postsynaptic reordering is enabled, allocate position of each target neuron's
+                // input in the reordered inSyn buffer and target indices translated into these positions
+                if(s.second.isPostsynapticReorderingEnabled()) {
+                    const unsigned int numTrgNeurons = s.second.getTrgNeuronGroup()->getNumNeurons();
+                    mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            "unsigned int", "inSynOrder" + s.second.getName(), varLoc, numTrgNeurons);
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "inSynOrder" + s.second.getName(),
+                                                  varLoc, numTrgNeurons);
+
+                    mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            s.second.getSparseIndType(), "indInSyn" + s.second.getName(), varLoc, size);
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, s.second.getSparseIndType(), "indInSyn" + s.second.getName(),
+                                                  varLoc, size);
                 }
 
                 // Generate push and pull functions for sparse connectivity
@@ -979,11 +1942,88 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                         backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, "unsigned int", "rowLength" + s.second.getName(), 
                                                                     s.second.getSparseConnectivityLocation(), autoInitialized, s.second.getSrcNeuronGroup()->getNumNeurons());
 
-                                        // Target indices
-                                        backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, "unsigned int", "ind" + s.second.getName(), 
-                                                                    s.second.getSparseConnectivityLocation(), autoInitialized, size);
+                                        // If target indices are compressed, row offsets
+                                        // **NOTE** compressed indices are only supported by backends without a separate device
+                                        if(s.second.isCompressedSparseIndEnabled()) {
+                                            backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, "uint64_t", "rowOffset" + s.second.getName(),
+                                                                        s.second.getSparseConnectivityLocation(), autoInitialized, s.second.getSrcNeuronGroup()->getNumNeurons() + 1);
+                                        }
+                                        // Otherwise, target indices
+                                        else {
+                                            backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, "unsigned int", "ind" + s.second.getName(), 
+                                                                        s.second.getSparseConnectivityLocation(), autoInitialized, size);
+                                        }
                                     });
             }
+            else if(s.second.getMatrixType() & SynapseMatrixConnectivity::CSR) {
+                const VarLocation varLoc = s.second.getSparseConnectivityLocation();
+                const unsigned int numSrcNeurons = s.second.getSrcNeuronGroup()->getNumNeurons();
+                const std::string numSynapses = "rowPtr" + s.second.getName() + "[" + std::to_string(numSrcNeurons) + "]";
+
+                // Row pointers
+                mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                        "unsigned int", "rowPtr" + s.second.getName(), varLoc, numSrcNeurons + 1);
+                backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "rowPtr" + s.second.getName(),
+                                              varLoc, numSrcNeurons + 1);
+
+                // Target indices are only allocated once the number of synapses is known
+                // **NOTE** pointer is reset when freed so re-allocating after freeMem doesn't free it again
+                backend.genVariableDefinition(definitionsVar, definitionsInternalVar, s.second.getSparseIndType() + "*", "ind" + s.second.getName(), varLoc);
+                backend.genVariableImplementation(runnerVarDecl, s.second.getSparseIndType() + "*", "ind" + s.second.getName(), varLoc);
+                backend.genVariableFree(runnerVarFree, "ind" + s.second.getName(), varLoc);
+                runnerVarFree << "ind" << s.second.getName() << " = nullptr;" << std::endl;
+
+                // Before loading target indices, allocate synapses using row pointers loaded from the same file
+                runnerLoadState << "allocateSynapses" << s.second.getName() << "(" << numSynapses << ");" << std::endl;
+                backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, s.second.getSparseIndType(), "ind" + s.second.getName(),
+                                              varLoc, numSynapses);
+
+                // Column-major structures used for postsynaptic learning remain padded to the maximum column length
+                if(backend.isPostsynapticRemapRequired() && !s.second.getWUModel()->getLearnPostCode().empty()) {
+                    const size_t postSize = (size_t)s.second.getTrgNeuronGroup()->getNumNeurons() * (size_t)s.second.getMaxSourceConnections();
+                    mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            "unsigned int", "colLength" + s.second.getName(), VarLocation::DEVICE, s.second.getTrgNeuronGroup()->getNumNeurons());
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "colLength" + s.second.getName(),
+                                                  VarLocation::DEVICE, s.second.getTrgNeuronGroup()->getNumNeurons());
+
+                    mem += backend.genArray(definitionsVar, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
+                                            "unsigned int", "remap" + s.second.getName(), VarLocation::DEVICE, postSize);
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, "unsigned int", "remap" + s.second.getName(),
+                                                  VarLocation::DEVICE, postSize);
+                }
+
+                // Build list of arrays which are sized by the number of synapses
+                std::vector<std::tuple<std::string, std::string, VarLocation>> synapseArrays{
+                    std::make_tuple(s.second.getSparseIndType(), "ind" + s.second.getName(), varLoc)};
+                if(s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
+                    const auto wuVars = s.second.getWUModel()->getVars();
+                    for(size_t i = 0; i < wuVars.size(); i++) {
+                        synapseArrays.emplace_back(getVarStorageType(wuVars[i].type, s.second.getWUVarStorage(i)),
+                                                   wuVars[i].name + s.second.getName(), s.second.getWUVarLocation(i));
+                    }
+                }
+
+                // Write function to (re)allocate these arrays and point merged structures at them
+                definitionsInternalFunc << "EXPORT_FUNC void allocateSynapses" << s.second.getName() << "(unsigned int count);" << std::endl;
+                runnerExtraGlobalParamFunc << "void allocateSynapses" << s.second.getName() << "(unsigned int count)";
+                {
+                    CodeStream::Scope a(runnerExtraGlobalParamFunc);
+                    for(const auto &arr : synapseArrays) {
+                        backend.genVariableFree(runnerExtraGlobalParamFunc, std::get<1>(arr), std::get<2>(arr));
+                        backend.genExtraGlobalParamAllocation(runnerExtraGlobalParamFunc, std::get<0>(arr) + "*", std::get<1>(arr), std::get<2>(arr));
+
+                        // **NOTE** arrays only used by some kernels may not be referenced by any merged structure
+                        const auto mergedDestinations = mergedStructData.getMergedEGPs().find(backend.getArrayPrefix() + std::get<1>(arr));
+                        if(mergedDestinations != mergedStructData.getMergedEGPs().cend()) {
+                            for(const auto &v : mergedDestinations->second) {
+                                runnerExtraGlobalParamFunc << "pushMerged" << v.first << v.second.mergedGroupIndex << v.second.fieldName << "ToDevice(";
+                                runnerExtraGlobalParamFunc << v.second.groupIndex << ", " << backend.getArrayPrefix() << std::get<1>(arr) << ");" << std::endl;
+                            }
+                        }
+                    }
+                }
+                runnerExtraGlobalParamFunc << std::endl;
+            }
         }
     }
     allVarStreams << std::endl;
@@ -998,18 +2038,32 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         // If group isn't a weight sharing slave and per-synapse variables should be individual
         const bool individualWeights = (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL);
         const bool proceduralWeights = (s.second.getMatrixType() & SynapseMatrixWeight::PROCEDURAL);
+        const bool kernelWeights = (s.second.getMatrixType() & SynapseMatrixWeight::KERNEL);
         std::vector<std::string> synapseGroupStatePushPullFunctions;
-        if (!s.second.isWeightSharingSlave() && (individualWeights || proceduralWeights)) {
-            const size_t size = s.second.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(s.second);
+        if (!s.second.isWeightSharingSlave() && (individualWeights || proceduralWeights || kernelWeights)) {
+            // **NOTE** kernel weights only store one value per kernel element
+            const size_t size = (kernelWeights ? s.second.getKernelSizeFlattened() : (s.second.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(s.second))) * batchSize;
 
             const auto wuVars = wu->getVars();
             for(size_t i = 0; i < wuVars.size(); i++) {
                 const auto *varInitSnippet = s.second.getWUVarInitialisers()[i].getSnippet();
-                if(individualWeights) {
+
+                // If connectivity is CSR, variables are allocated alongside the target indices in allocateSynapsesXXX
+                if(individualWeights && (s.second.getMatrixType() & SynapseMatrixConnectivity::CSR)) {
+                    const std::string varName = wuVars[i].name + s.second.getName();
+                    const std::string varType = getVarStorageType(wuVars[i].type, s.second.getWUVarStorage(i));
+                    backend.genVariableDefinition(definitionsVar, definitionsInternalVar, varType + "*", varName, s.second.getWUVarLocation(i));
+                    backend.genVariableImplementation(runnerVarDecl, varType + "*", varName, s.second.getWUVarLocation(i));
+                    backend.genVariableFree(runnerVarFree, varName, s.second.getWUVarLocation(i));
+                    runnerVarFree << varName << " = nullptr;" << std::endl;
+                    backend.genArrayStateSaveLoad(runnerSaveState, runnerLoadState, varType, varName, s.second.getWUVarLocation(i),
+                                                  "rowPtr" + s.second.getName() + "[" + std::to_string(s.second.getSrcNeuronGroup()->getNumNeurons()) + "]");
+                }
+                else if(individualWeights || kernelWeights) {
                     const bool autoInitialized = !varInitSnippet->getCode().empty();
                     mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                                       runnerPushFunc, runnerPullFunc, wuVars[i].type, wuVars[i].name + s.second.getName(),
-                                       s.second.getWUVarLocation(i), autoInitialized, size, synapseGroupStatePushPullFunctions);
+                                       runnerPushFunc, runnerPullFunc, runnerSaveState, runnerLoadState, getVarStorageType(wuVars[i].type, s.second.getWUVarStorage(i)),
+                                       wuVars[i].name + s.second.getName(), s.second.getWUVarLocation(i), autoInitialized, size, synapseGroupStatePushPullFunctions);
                 }
 
                 // Loop through EGPs required to initialize WUM variable
@@ -1024,14 +2078,14 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
 
         // Presynaptic W.U.M. variables
         const size_t preSize = (s.second.getDelaySteps() == NO_DELAY)
-                ? s.second.getSrcNeuronGroup()->getNumNeurons()
-                : s.second.getSrcNeuronGroup()->getNumNeurons() * s.second.getSrcNeuronGroup()->getNumDelaySlots();
+                ? s.second.getSrcNeuronGroup()->getNumNeurons() * batchSize
+                : s.second.getSrcNeuronGroup()->getNumNeurons() * s.second.getSrcNeuronGroup()->getNumDelaySlots() * batchSize;
         const auto wuPreVars = wu->getPreVars();
         for(size_t i = 0; i < wuPreVars.size(); i++) {
             const auto *varInitSnippet = s.second.getWUPreVarInitialisers()[i].getSnippet();
             const bool autoInitialized = !varInitSnippet->getCode().empty();
             mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                            runnerPushFunc, runnerPullFunc, wuPreVars[i].type, wuPreVars[i].name + s.second.getName(),
+                            runnerPushFunc, runnerPullFunc, runnerSaveState, runnerLoadState, wuPreVars[i].type, wuPreVars[i].name + s.second.getName(),
                             s.second.getWUPreVarLocation(i), autoInitialized, preSize, synapseGroupStatePushPullFunctions);
 
             // Loop through EGPs required to initialize WUM variable
@@ -1045,14 +2099,14 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
 
         // Postsynaptic W.U.M. variables
         const size_t postSize = (s.second.getBackPropDelaySteps() == NO_DELAY)
-                ? s.second.getTrgNeuronGroup()->getNumNeurons()
-                : s.second.getTrgNeuronGroup()->getNumNeurons() * s.second.getTrgNeuronGroup()->getNumDelaySlots();
+                ? s.second.getTrgNeuronGroup()->getNumNeurons() * batchSize
+                : s.second.getTrgNeuronGroup()->getNumNeurons() * s.second.getTrgNeuronGroup()->getNumDelaySlots() * batchSize;
         const auto wuPostVars = wu->getPostVars();
         for(size_t i = 0; i < wuPostVars.size(); i++) {
             const auto *varInitSnippet = s.second.getWUPostVarInitialisers()[i].getSnippet();
             const bool autoInitialized = !varInitSnippet->getCode().empty();
             mem += genVariable(backend, definitionsVar, definitionsFunc, definitionsInternalVar, runnerVarDecl, runnerVarAlloc, runnerVarFree,
-                               runnerPushFunc, runnerPullFunc, wuPostVars[i].type, wuPostVars[i].name + s.second.getName(),
+                               runnerPushFunc, runnerPullFunc, runnerSaveState, runnerLoadState, wuPostVars[i].type, wuPostVars[i].name + s.second.getName(),
                                s.second.getWUPostVarLocation(i), autoInitialized, postSize, synapseGroupStatePushPullFunctions);
 
             // Loop through EGPs required to initialize WUM variable
@@ -1073,7 +2127,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                 [&]()
                 {
                     backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, model.getPrecision(), "inSyn" + s.second.getName(), s.second.getInSynLocation(),
-                                                true, s.second.getTrgNeuronGroup()->getNumNeurons());
+                                                true, s.second.getTrgNeuronGroup()->getNumNeurons() * batchSize);
                 });
 
             // If this synapse group has individual postsynaptic model variables
@@ -1086,7 +2140,7 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                         [&]()
                         {
                             backend.genVariablePushPull(runnerPushFunc, runnerPullFunc, psmVars[i].type, psmVars[i].name + s.second.getName(), s.second.getPSVarLocation(i),
-                                                        autoInitialized, s.second.getTrgNeuronGroup()->getNumNeurons());
+                                                        autoInitialized, s.second.getTrgNeuronGroup()->getNumNeurons() * batchSize);
                         });
                 }
             }
@@ -1113,6 +2167,13 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
                                 true, s.second.getWUExtraGlobalParamLocation(i));
         }
 
+        genDynamicParams(definitionsVar, definitionsFunc, runnerVarDecl, runnerExtraGlobalParamFunc,
+                         runnerSaveState, runnerLoadState, model.getPrecision(), model.getDT(), s.second.getName(), psm, s.second.getPSParams(), s.second.getPSDerivedParams(),
+                         [&s](size_t i) { return s.second.isPSParamDynamic(i); });
+        genDynamicParams(definitionsVar, definitionsFunc, runnerVarDecl, runnerExtraGlobalParamFunc,
+                         runnerSaveState, runnerLoadState, model.getPrecision(), model.getDT(), s.second.getName(), wu, s.second.getWUParams(), s.second.getWUDerivedParams(),
+                         [&s](size_t i) { return s.second.isWUParamDynamic(i); });
+
         // If group isn't a weight sharing slave 
         if(!s.second.isWeightSharingSlave()) {
             const auto sparseConnExtraGlobalParams = s.second.getConnectivityInitialiser().getSnippet()->getExtraGlobalParams();
@@ -1216,6 +2277,11 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         runner << std::endl;
     }
 
+#ifdef MPI_ENABLE
+    // Generate functions to exchange spikes with other hosts
+    genMPISpikeExchange(backend, runner, model);
+#endif
+
     // ---------------------------------------------------------------------
     // Function for setting the CUDA device and the host's global variables.
     // Also estimates memory usage on device ...
@@ -1241,11 +2307,27 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     {
         CodeStream::Scope b(runner);
 
+#ifdef MPI_ENABLE
+        // Complete any outstanding spike exchange before buffers go out of use
+        runner << "mpiCompleteSpikeExchange();" << std::endl;
+#endif
+
+        // Generate preamble - this releases any global resources acquired in allocateMem
+        backend.genFreeMemPreamble(runner, modelMerged);
+
         // Write variable frees to runner
         runner << runnerVarFreeStream.str();
     }
     runner << std::endl;
 
+    // ------------------------------------------------------------------------
+    // Functions to save and load checkpoints of model state
+    genStateCheckpoint(runner, runnerSaveStateStream.str(), runnerLoadStateStream.str(), model.getTimePrecision());
+
+    // ------------------------------------------------------------------------
+    // Functions to load and save connectivity from cache
+    genConnectivityCache(backend, definitionsInternalFunc, runner, modelMerged);
+
     // ------------------------------------------------------------------------
     // Function to return amount of free device memory in bytes
     runner << "size_t getFreeDeviceMemBytes()";
@@ -1277,6 +2359,12 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
         // Update neuronal state
         runner << "updateNeurons(t);" << std::endl;
 
+#ifdef MPI_ENABLE
+        // Start sending spikes emitted by local neurons to other hosts
+        // **NOTE** this is completed by updateSynapses, once it has processed spikes from local neurons
+        runner << "mpiStartSpikeExchange();" << std::endl;
+#endif
+
         // Generate code to advance host side dendritic delay buffers
         for(const auto &n : model.getNeuronGroups()) {
             // Loop through incoming synaptic populations
@@ -1315,6 +2403,8 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     definitions << "EXPORT_FUNC void allocateMem();" << std::endl;
     definitions << "EXPORT_FUNC void freeMem();" << std::endl;
     definitions << "EXPORT_FUNC size_t getFreeDeviceMemBytes();" << std::endl;
+    definitions << "EXPORT_FUNC void saveState(const char *path);" << std::endl;
+    definitions << "EXPORT_FUNC void loadState(const char *path);" << std::endl;
     definitions << "EXPORT_FUNC void stepTime();" << std::endl;
     definitions << std::endl;
     definitions << "// Functions generated by backend" << std::endl;
@@ -1324,8 +2414,9 @@ MemAlloc CodeGenerator::generateRunner(CodeStream &definitions, CodeStream &defi
     definitions << "EXPORT_FUNC void initializeSparse();" << std::endl;
 
 #ifdef MPI_ENABLE
-    definitions << "// MPI functions" << std::endl;
-    definitions << "EXPORT_FUNC void generateMPI();" << std::endl;
+    definitionsInternal << "// MPI spike exchange functions" << std::endl;
+    definitionsInternal << "EXPORT_FUNC void mpiStartSpikeExchange();" << std::endl;
+    definitionsInternal << "EXPORT_FUNC void mpiCompleteSpikeExchange();" << std::endl;
 #endif
 
     // End extern C block around definitions
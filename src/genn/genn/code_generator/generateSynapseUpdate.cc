@@ -1,6 +1,8 @@
 #include "code_generator/generateSynapseUpdate.h"
 
 // Standard C++ includes
+#include <cassert>
+#include <sstream>
 #include <string>
 
 // GeNN code generator includes
@@ -42,10 +44,34 @@ void applySynapseSubstitutions(CodeGenerator::CodeStream &os, std::string code,
     synapseSubs.addVarNameSubstitution(wu->getPostVars(), "", "group.",
                                        "[" + delayedPostIdx + "]");
 
-    // If weights are individual, substitute variables for values stored in global memory
-    if (sg.getArchetype().getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
-        synapseSubs.addVarNameSubstitution(wu->getVars(), "", "group.",
-                                           "[" + synapseSubs["id_syn"] + "]");
+    // If weights are individual or stored in a kernel, substitute variables for values stored in global memory
+    std::stringstream storeCode;
+    const bool individualWeights = (sg.getArchetype().getMatrixType() & SynapseMatrixWeight::INDIVIDUAL);
+    const bool kernelWeights = (sg.getArchetype().getMatrixType() & SynapseMatrixWeight::KERNEL);
+    if (individualWeights || kernelWeights) {
+        const std::string idx = "[" + (individualWeights ? synapseSubs["id_syn"] : synapseSubs["id_kernel"]) + "]";
+        const auto vars = wu->getVars();
+        for(size_t k = 0; k < vars.size(); k++) {
+            const VarStorage storage = sg.getArchetype().getWUVarStorage(k);
+
+            // If variable is stored in its own type, access it directly
+            if(storage == VarStorage::NATIVE) {
+                synapseSubs.addVarSubstitution(vars[k].name, "group." + vars[k].name + idx);
+            }
+            // Otherwise, if variable is stored in reduced precision and referenced by code,
+            // widen it into a local variable and, if model can write it, narrow it back afterwards
+            else if(code.find("$(" + vars[k].name + ")") != std::string::npos) {
+                const double scale = sg.getArchetype().getWUVarStorageScale(k);
+                os << model.getPrecision() << " l" << vars[k].name << " = ";
+                os << CodeGenerator::getVarStorageLoad("group." + vars[k].name + idx, storage, scale, model.getPrecision()) << ";" << std::endl;
+                synapseSubs.addVarSubstitution(vars[k].name, "l" + vars[k].name);
+
+                if(vars[k].access == VarAccess::READ_WRITE) {
+                    storeCode << "group." << vars[k].name << idx << " = ";
+                    storeCode << CodeGenerator::getVarStorageStore("l" + vars[k].name, storage, scale, model.getPrecision()) << ";" << std::endl;
+                }
+            }
+        }
     }
     // Otherwise, if weights are procedual
     else if (sg.getArchetype().getMatrixType() & SynapseMatrixWeight::PROCEDURAL) {
@@ -114,6 +140,11 @@ void applySynapseSubstitutions(CodeGenerator::CodeStream &os, std::string code,
     //synapseSubs.applyCheckUnreplaced(code, errorContext + " : " + sg.getName());
     code = CodeGenerator::ensureFtype(code, model.getPrecision());
     os << code;
+
+    // Narrow any reduced-precision variables back into global memory
+    if(!storeCode.str().empty()) {
+        os << std::endl << storeCode.str();
+    }
 }
 }   // Anonymous namespace
 
@@ -141,30 +172,19 @@ void CodeGenerator::generateSynapseUpdate(CodeStream &os, const MergedStructData
     // Synaptic update kernels
     backend.genSynapseUpdate(os, modelMerged,
         // Presynaptic weight update threshold
-        [&backend, &model](CodeStream &os, const PresynapticUpdateGroupMerged &sg, Substitutions &baseSubs)
+        // **NOTE** rather than re-evaluating the event threshold condition, test the bit
+        // the presynaptic neuron set in its condition mask when this group's condition fired
+        [](CodeStream &os, const PresynapticUpdateGroupMerged &sg, Substitutions &baseSubs)
         {
-            Substitutions synapseSubs(&baseSubs);
-
-            // Make weight update model substitutions
-            synapseSubs.addParamValueSubstitution(sg.getArchetype().getWUModel()->getParamNames(), sg.getArchetype().getWUParams(),
-                                                  [&sg](size_t i) { return sg.isWUParamHeterogeneous(i);  },
-                                                  "", "group.");
-            synapseSubs.addVarValueSubstitution(sg.getArchetype().getWUModel()->getDerivedParams(), sg.getArchetype().getWUDerivedParams(),
-                                                [&sg](size_t i) { return sg.isWUDerivedParamHeterogeneous(i);  },
-                                                "", "group.");
-            synapseSubs.addVarNameSubstitution(sg.getArchetype().getWUModel()->getExtraGlobalParams(), "", "group.");
-
-            // Get read offset if required and substitute in presynaptic neuron properties
+            assert(sg.getArchetype().isEventThresholdConditionMaskRequired());
             const std::string offset = sg.getArchetype().getSrcNeuronGroup()->isDelayRequired() ? "preReadDelayOffset + " : "";
-            neuronSubstitutionsInSynapticCode(synapseSubs, sg.getArchetype().getSrcNeuronGroup(), offset, "", baseSubs["id_pre"], "_pre", "Pre", "", "",
-                                              [&sg](size_t paramIndex) { return sg.isSrcNeuronParamHeterogeneous(paramIndex); },
-                                              [&sg](size_t derivedParamIndex) { return sg.isSrcNeuronDerivedParamHeterogeneous(derivedParamIndex); });
-            
-            // Get event threshold condition code
-            std::string code = sg.getArchetype().getWUModel()->getEventThresholdConditionCode();
-            synapseSubs.applyCheckUnreplaced(code, "eventThresholdConditionCode");
-            code = ensureFtype(code, model.getPrecision());
-            os << code;
+            os << "(group.srcSpkEvntCond[" << offset << baseSubs["id_pre"] << "] & ";
+            if(sg.isEventThresholdConditionBitHeterogeneous()) {
+                os << "group.eventThresholdConditionMask)";
+            }
+            else {
+                os << "(1u << " << sg.getArchetype().getEventThresholdConditionBit() << "))";
+            }
         },
         // Presynaptic spike
         [&backend, &model](CodeStream &os, const PresynapticUpdateGroupMerged &sg, Substitutions &baseSubs)
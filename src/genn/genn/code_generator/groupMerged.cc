@@ -12,6 +12,66 @@
 #include "code_generator/codeStream.h"
 #include "code_generator/mergedStructGenerator.h"
 
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+void genSpikeCountReset(CodeGenerator::CodeStream &os, const NeuronGroupInternal &ng)
+{
+    if(ng.isDelayRequired()) { // with delay
+        if(ng.isSpikeEventRequired()) {
+            os << "group.spkCntEvnt[*group.spkQuePtr] = 0;" << std::endl;
+        }
+        if(ng.isTrueSpikeRequired()) {
+            os << "group.spkCnt[*group.spkQuePtr] = 0;" << std::endl;
+        }
+        else {
+            os << "group.spkCnt[0] = 0;" << std::endl;
+        }
+    }
+    else { // no delay
+        if(ng.isSpikeEventRequired()) {
+            os << "group.spkCntEvnt[0] = 0;" << std::endl;
+        }
+        os << "group.spkCnt[0] = 0;" << std::endl;
+    }
+}
+//----------------------------------------------------------------------------
+// Helpers to get the names of the runner variables dynamic parameters are
+// set through or an empty string if parameters aren't dynamic
+//----------------------------------------------------------------------------
+std::string getDynamicParamName(const NeuronGroup &ng, size_t paramIndex)
+{
+    return ng.isParamDynamic(paramIndex) ? (ng.getNeuronModel()->getParamNames().at(paramIndex) + ng.getName()) : "";
+}
+//----------------------------------------------------------------------------
+std::string getDynamicDerivedParamName(const NeuronGroup &ng, size_t paramIndex)
+{
+    return ng.isAnyParamDynamic() ? (ng.getNeuronModel()->getDerivedParams().at(paramIndex).name + ng.getName()) : "";
+}
+//----------------------------------------------------------------------------
+std::string getWUDynamicParamName(const SynapseGroup &sg, size_t paramIndex)
+{
+    return sg.isWUParamDynamic(paramIndex) ? (sg.getWUModel()->getParamNames().at(paramIndex) + sg.getName()) : "";
+}
+//----------------------------------------------------------------------------
+std::string getWUDynamicDerivedParamName(const SynapseGroup &sg, size_t paramIndex)
+{
+    return sg.isAnyWUParamDynamic() ? (sg.getWUModel()->getDerivedParams().at(paramIndex).name + sg.getName()) : "";
+}
+//----------------------------------------------------------------------------
+std::string getPSDynamicParamName(const SynapseGroup &sg, size_t paramIndex)
+{
+    return sg.isPSParamDynamic(paramIndex) ? (sg.getPSModel()->getParamNames().at(paramIndex) + sg.getName()) : "";
+}
+//----------------------------------------------------------------------------
+std::string getPSDynamicDerivedParamName(const SynapseGroup &sg, size_t paramIndex)
+{
+    return sg.isAnyPSParamDynamic() ? (sg.getPSModel()->getDerivedParams().at(paramIndex).name + sg.getName()) : "";
+}
+}   // Anonymous namespace
+
 //----------------------------------------------------------------------------
 // CodeGenerator::NeuronSpikeQueueUpdateGroupMerged
 //----------------------------------------------------------------------------
@@ -47,23 +107,7 @@ void CodeGenerator::NeuronSpikeQueueUpdateGroupMerged::generate(const BackendBas
 //----------------------------------------------------------------------------
 void CodeGenerator::NeuronSpikeQueueUpdateGroupMerged::genMergedGroupSpikeCountReset(CodeStream &os) const
 {
-    if(getArchetype().isDelayRequired()) { // with delay
-        if(getArchetype().isSpikeEventRequired()) {
-            os << "group.spkCntEvnt[*group.spkQuePtr] = 0;" << std::endl;
-        }
-        if(getArchetype().isTrueSpikeRequired()) {
-            os << "group.spkCnt[*group.spkQuePtr] = 0;" << std::endl;
-        }
-        else {
-            os << "group.spkCnt[0] = 0;" << std::endl;
-        }
-    }
-    else { // no delay
-        if(getArchetype().isSpikeEventRequired()) {
-            os << "group.spkCntEvnt[0] = 0;" << std::endl;
-        }
-        os << "group.spkCnt[0] = 0;" << std::endl;
-    }
+    genSpikeCountReset(os, getArchetype());
 }
 
 //----------------------------------------------------------------------------
@@ -71,12 +115,13 @@ void CodeGenerator::NeuronSpikeQueueUpdateGroupMerged::genMergedGroupSpikeCountR
 //----------------------------------------------------------------------------
 bool CodeGenerator::NeuronGroupMergedBase::isParamHeterogeneous(size_t index) const
 {
-    return isParamValueHeterogeneous(index, [](const NeuronGroupInternal &ng) { return ng.getParams(); });
+    // Dynamic parameters are always stored in the merged structure so they can be changed at runtime
+    return getArchetype().isParamDynamic(index) || isParamValueHeterogeneous(index, [](const NeuronGroupInternal &ng) { return ng.getParams(); });
 }
 //----------------------------------------------------------------------------
 bool CodeGenerator::NeuronGroupMergedBase::isDerivedParamHeterogeneous(size_t index) const
 {
-    return isParamValueHeterogeneous(index, [](const NeuronGroupInternal &ng) { return ng.getDerivedParams(); });
+    return getArchetype().isAnyParamDynamic() || isParamValueHeterogeneous(index, [](const NeuronGroupInternal &ng) { return ng.getDerivedParams(); });
 }
 //----------------------------------------------------------------------------
 bool CodeGenerator::NeuronGroupMergedBase::isVarInitParamHeterogeneous(size_t varIndex, size_t paramIndex) const
@@ -141,8 +186,12 @@ bool CodeGenerator::NeuronGroupMergedBase::isCurrentSourceVarInitDerivedParamHet
 bool CodeGenerator::NeuronGroupMergedBase::isPSMParamHeterogeneous(size_t childIndex, size_t paramIndex) const
 {  
     // If parameter isn't referenced in code, there's no point implementing it hetereogeneously!
-    const auto *psm = getArchetype().getMergedInSyn().at(childIndex).first->getPSModel();
+    const auto *sg = getArchetype().getMergedInSyn().at(childIndex).first;
+    const auto *psm = sg->getPSModel();
     const std::string paramName = psm->getParamNames().at(paramIndex);
+    if(sg->isPSParamDynamic(paramIndex)) {
+        return isParamReferenced({psm->getApplyInputCode(), psm->getDecayCode()}, paramName);
+    }
     return isChildParamValueHeterogeneous({psm->getApplyInputCode(), psm->getDecayCode()}, paramName, childIndex, paramIndex, m_SortedMergedInSyns,
                                           [](const std::pair<SynapseGroupInternal *, std::vector<SynapseGroupInternal *>> &inSyn)
                                           {
@@ -153,8 +202,12 @@ bool CodeGenerator::NeuronGroupMergedBase::isPSMParamHeterogeneous(size_t childI
 bool CodeGenerator::NeuronGroupMergedBase::isPSMDerivedParamHeterogeneous(size_t childIndex, size_t paramIndex) const
 {
     // If parameter isn't referenced in code, there's no point implementing it hetereogeneously!
-    const auto *psm = getArchetype().getMergedInSyn().at(childIndex).first->getPSModel();
+    const auto *sg = getArchetype().getMergedInSyn().at(childIndex).first;
+    const auto *psm = sg->getPSModel();
     const std::string derivedParamName = psm->getDerivedParams().at(paramIndex).name;
+    if(sg->isAnyPSParamDynamic()) {
+        return isParamReferenced({psm->getApplyInputCode(), psm->getDecayCode()}, derivedParamName);
+    }
     return isChildParamValueHeterogeneous({psm->getApplyInputCode(), psm->getDecayCode()}, derivedParamName, childIndex, paramIndex, m_SortedMergedInSyns,
                                           [](const std::pair<SynapseGroupInternal *, std::vector<SynapseGroupInternal *>> &inSyn)
                                           {
@@ -233,6 +286,10 @@ void CodeGenerator::NeuronGroupMergedBase::generate(MergedStructGenerator<Neuron
     if(getArchetype().isSpikeEventRequired()) {
         gen.addPointerField("unsigned int", "spkCntEvnt", backend.getArrayPrefix() + "glbSpkCntEvnt");
         gen.addPointerField("unsigned int", "spkEvnt", backend.getArrayPrefix() + "glbSpkEvnt");
+
+        if(!init && getArchetype().isSpikeEventConditionMaskRequired()) {
+            gen.addPointerField("uint32_t", "spkEvntCond", backend.getArrayPrefix() + "spkEvntCond");
+        }
     }
 
     if(getArchetype().isDelayRequired()) {
@@ -285,12 +342,12 @@ void CodeGenerator::NeuronGroupMergedBase::generate(MergedStructGenerator<Neuron
         // Add heterogeneous neuron model parameters
         gen.addHeterogeneousParams(getArchetype().getNeuronModel()->getParamNames(), "",
                                    [](const NeuronGroupInternal &ng) { return ng.getParams(); },
-                                   &NeuronGroupMergedBase::isParamHeterogeneous);
+                                   &NeuronGroupMergedBase::isParamHeterogeneous, &getDynamicParamName);
 
         // Add heterogeneous neuron model derived parameters
         gen.addHeterogeneousDerivedParams(getArchetype().getNeuronModel()->getDerivedParams(), "",
                                           [](const NeuronGroupInternal &ng) { return ng.getDerivedParams(); },
-                                          &NeuronGroupMergedBase::isDerivedParamHeterogeneous);
+                                          &NeuronGroupMergedBase::isDerivedParamHeterogeneous, &getDynamicDerivedParamName);
     }
 
     // Loop through merged synaptic inputs in archetypical neuron group
@@ -300,8 +357,21 @@ void CodeGenerator::NeuronGroupMergedBase::generate(MergedStructGenerator<Neuron
         // Add pointer to insyn
         addMergedInSynPointerField(gen, precision, "inSynInSyn", i, backend.getArrayPrefix() + "inSyn");
 
+        // If postsynaptic input is reordered, add pointer to position of each neuron's input in inSyn
+        // **NOTE** this belongs to the weight sharing master as it is calculated from its connectivity
+        if(!init && sg->isPostsynapticReorderingEnabled()) {
+            gen.addField("unsigned int*", "inSynOrderInSyn" + std::to_string(i),
+                         [&backend, i, this](const NeuronGroupInternal &, size_t groupIndex)
+                         {
+                             const SynapseGroupInternal *mergedSG = m_SortedMergedInSyns.at(groupIndex).at(i).first;
+                             const SynapseGroupInternal *connectivitySG = mergedSG->isWeightSharingSlave() ? mergedSG->getWeightSharingMaster() : mergedSG;
+                             return backend.getArrayPrefix() + "inSynOrder" + connectivitySG->getName();
+                         });
+        }
+
         // Add pointer to dendritic delay buffer if required
-        if(sg->isDendriticDelayRequired()) {
+        // **NOTE** sparse dendritic delay buffers are accumulated into inSyn by the synapse update so are only required here for initialisation
+        if(sg->isDendriticDelayRequired() && (init || !sg->isSparseDendriticDelayEnabled())) {
             addMergedInSynPointerField(gen, precision, "denDelayInSyn", i, backend.getArrayPrefix() + "denDelay");
 
             gen.addField("volatile unsigned int*", "denDelayPtrInSyn" + std::to_string(i),
@@ -310,6 +380,11 @@ void CodeGenerator::NeuronGroupMergedBase::generate(MergedStructGenerator<Neuron
                              const std::string &targetName = m_SortedMergedInSyns.at(groupIndex).at(i).first->getPSModelTargetName();
                              return "getSymbolAddress(" + backend.getScalarPrefix() + "denDelayPtr" + targetName + ")";
                          });
+
+            // If dendritic delay buffer is sparse, add pointer to per-slot counts so they can be zeroed
+            if(init && sg->isSparseDendriticDelayEnabled()) {
+                addMergedInSynPointerField(gen, "unsigned int", "denDelayCntInSyn", i, backend.getArrayPrefix() + "denDelayCnt");
+            }
         }
 
         // Loop through variables
@@ -364,6 +439,10 @@ void CodeGenerator::NeuronGroupMergedBase::generate(MergedStructGenerator<Neuron
                                         [this](size_t groupIndex, size_t childIndex, size_t paramIndex)
                                         {
                                             return m_SortedMergedInSyns.at(groupIndex).at(childIndex).first->getPSParams().at(paramIndex);
+                                        },
+                                        [this](size_t groupIndex, size_t childIndex, size_t paramIndex)
+                                        {
+                                            return getPSDynamicParamName(*m_SortedMergedInSyns.at(groupIndex).at(childIndex).first, paramIndex);
                                         });
 
             // Add any heterogeneous postsynaptic mode derived parameters
@@ -372,6 +451,10 @@ void CodeGenerator::NeuronGroupMergedBase::generate(MergedStructGenerator<Neuron
                                                [this](size_t groupIndex, size_t childIndex, size_t paramIndex)
                                                {
                                                    return m_SortedMergedInSyns.at(groupIndex).at(childIndex).first->getPSDerivedParams().at(paramIndex);
+                                               },
+                                               [this](size_t groupIndex, size_t childIndex, size_t paramIndex)
+                                               {
+                                                   return getPSDynamicDerivedParamName(*m_SortedMergedInSyns.at(groupIndex).at(childIndex).first, paramIndex);
                                                });
             // Add EGPs
             addChildEGPs(gen, sg->getPSModel()->getExtraGlobalParams(), i, backend.getArrayPrefix(), "InSyn",
@@ -528,11 +611,20 @@ std::string CodeGenerator::NeuronUpdateGroupMerged::getPrevQueueOffset() const
     return "(((*group.spkQuePtr + " + std::to_string(getArchetype().getNumDelaySlots() - 1) + ") % " + std::to_string(getArchetype().getNumDelaySlots()) + ") * group.numNeurons)";
 }
 //----------------------------------------------------------------------------
+void CodeGenerator::NeuronUpdateGroupMerged::genMergedGroupSpikeCountReset(CodeStream &os) const
+{
+    genSpikeCountReset(os, getArchetype());
+}
+//----------------------------------------------------------------------------
 bool CodeGenerator::NeuronUpdateGroupMerged::isInSynWUMParamHeterogeneous(size_t childIndex, size_t paramIndex) const
 {
     // If parameter isn't referenced in code, there's no point implementing it hetereogeneously!
-    const auto *wum = getArchetype().getInSynWithPostCode().at(childIndex)->getWUModel();
+    const auto *sg = getArchetype().getInSynWithPostCode().at(childIndex);
+    const auto *wum = sg->getWUModel();
     const std::string paramName = wum->getParamNames().at(paramIndex);
+    if(sg->isWUParamDynamic(paramIndex)) {
+        return isParamReferenced({wum->getPostSpikeCode()}, paramName);
+    }
     return isChildParamValueHeterogeneous({wum->getPostSpikeCode()}, paramName, childIndex, paramIndex, m_SortedInSynWithPostCode,
                                           [](const SynapseGroupInternal *s) { return s->getWUParams(); });
 }
@@ -540,8 +632,12 @@ bool CodeGenerator::NeuronUpdateGroupMerged::isInSynWUMParamHeterogeneous(size_t
 bool CodeGenerator::NeuronUpdateGroupMerged::isInSynWUMDerivedParamHeterogeneous(size_t childIndex, size_t paramIndex) const
 {
     // If derived parameter isn't referenced in code, there's no point implementing it hetereogeneously!
-    const auto *wum = getArchetype().getInSynWithPostCode().at(childIndex)->getWUModel();
+    const auto *sg = getArchetype().getInSynWithPostCode().at(childIndex);
+    const auto *wum = sg->getWUModel();
     const std::string derivedParamName = wum->getDerivedParams().at(paramIndex).name;
+    if(sg->isAnyWUParamDynamic()) {
+        return isParamReferenced({wum->getPostSpikeCode()}, derivedParamName);
+    }
     return isChildParamValueHeterogeneous({wum->getPostSpikeCode()}, derivedParamName, childIndex, paramIndex, m_SortedInSynWithPostCode,
                                           [](const SynapseGroupInternal *s) { return s->getWUDerivedParams(); });
 }
@@ -549,8 +645,12 @@ bool CodeGenerator::NeuronUpdateGroupMerged::isInSynWUMDerivedParamHeterogeneous
 bool CodeGenerator::NeuronUpdateGroupMerged::isOutSynWUMParamHeterogeneous(size_t childIndex, size_t paramIndex) const
 {
     // If parameter isn't referenced in code, there's no point implementing it hetereogeneously!
-    const auto *wum = getArchetype().getOutSynWithPreCode().at(childIndex)->getWUModel();
+    const auto *sg = getArchetype().getOutSynWithPreCode().at(childIndex);
+    const auto *wum = sg->getWUModel();
     const std::string paramName = wum->getParamNames().at(paramIndex);
+    if(sg->isWUParamDynamic(paramIndex)) {
+        return isParamReferenced({wum->getPreSpikeCode()}, paramName);
+    }
     return isChildParamValueHeterogeneous({wum->getPreSpikeCode()}, paramName, childIndex, paramIndex, m_SortedOutSynWithPreCode,
                                           [](const SynapseGroupInternal *s) { return s->getWUParams(); });
 }
@@ -558,8 +658,12 @@ bool CodeGenerator::NeuronUpdateGroupMerged::isOutSynWUMParamHeterogeneous(size_
 bool CodeGenerator::NeuronUpdateGroupMerged::isOutSynWUMDerivedParamHeterogeneous(size_t childIndex, size_t paramIndex) const
 {
     // If derived parameter isn't referenced in code, there's no point implementing it hetereogeneously!
-    const auto *wum = getArchetype().getOutSynWithPreCode().at(childIndex)->getWUModel();
+    const auto *sg = getArchetype().getOutSynWithPreCode().at(childIndex);
+    const auto *wum = sg->getWUModel();
     const std::string derivedParamName = wum->getDerivedParams().at(paramIndex).name;
+    if(sg->isAnyWUParamDynamic()) {
+        return isParamReferenced({wum->getPreSpikeCode()}, derivedParamName);
+    }
     return isChildParamValueHeterogeneous({wum->getPreSpikeCode()}, derivedParamName, childIndex, paramIndex, m_SortedOutSynWithPreCode,
                                           [](const SynapseGroupInternal *s) { return s->getWUDerivedParams(); });
 }
@@ -590,7 +694,7 @@ void CodeGenerator::NeuronUpdateGroupMerged::generate(const BackendBase &backend
 
     // Generate structure definitions and instantiation
     gen.generate(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar, runnerVarDecl, runnerMergedStructAlloc,
-                 mergedStructData, "NeuronUpdate");
+                 mergedStructData, "NeuronUpdate", false, true);
 }
 //----------------------------------------------------------------------------
 void CodeGenerator::NeuronUpdateGroupMerged::generateWUVar(MergedStructGenerator<NeuronGroupMergedBase> &gen, const BackendBase &backend, 
@@ -622,6 +726,10 @@ void CodeGenerator::NeuronUpdateGroupMerged::generateWUVar(MergedStructGenerator
                                                              [&sortedSyn](size_t groupIndex, size_t childIndex, size_t paramIndex)
                                                              {
                                                                  return sortedSyn.at(groupIndex).at(childIndex)->getWUParams().at(paramIndex);
+                                                             },
+                                                             [&sortedSyn](size_t groupIndex, size_t childIndex, size_t paramIndex)
+                                                             {
+                                                                 return getWUDynamicParamName(*sortedSyn.at(groupIndex).at(childIndex), paramIndex);
                                                              });
 
         // Add any heterogeneous derived parameters
@@ -629,6 +737,10 @@ void CodeGenerator::NeuronUpdateGroupMerged::generateWUVar(MergedStructGenerator
                                                                     [&sortedSyn](size_t groupIndex, size_t childIndex, size_t paramIndex)
                                                                     {
                                                                         return sortedSyn.at(groupIndex).at(childIndex)->getWUDerivedParams().at(paramIndex);
+                                                                    },
+                                                                    [&sortedSyn](size_t groupIndex, size_t childIndex, size_t paramIndex)
+                                                                    {
+                                                                        return getWUDynamicDerivedParamName(*sortedSyn.at(groupIndex).at(childIndex), paramIndex);
                                                                     });
 
         // Add EGPs
@@ -718,7 +830,7 @@ void CodeGenerator::NeuronInitGroupMerged::generate(const BackendBase &backend,
 
     // Generate structure definitions and instantiation
     gen.generate(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar, runnerVarDecl, runnerMergedStructAlloc,
-                 mergedStructData, "NeuronInit");
+                 mergedStructData, "NeuronInit", false, true);
 }
 //----------------------------------------------------------------------------
 void CodeGenerator::NeuronInitGroupMerged::generateWUVar(MergedStructGenerator<NeuronGroupMergedBase> &gen, const BackendBase &backend,
@@ -784,9 +896,25 @@ void CodeGenerator::SynapseDendriticDelayUpdateGroupMerged::generate(const Backe
                      return "getSymbolAddress(" + backend.getScalarPrefix() + "denDelayPtr" + sg.getPSModelTargetName() + ")";
                  });
 
+    // If dendritic delay buffer is sparse, add fields required to accumulate occupied entries into inSyn
+    if(getArchetype().isSparseDendriticDelayEnabled()) {
+        gen.addField("unsigned int", "numTrgNeurons",
+                     [](const SynapseGroupInternal &sg, size_t) { return std::to_string(sg.getTrgNeuronGroup()->getNumNeurons()); });
+
+        const std::string prefix = backend.getArrayPrefix();
+        gen.addField(precision + "*", "inSyn",
+                     [prefix](const SynapseGroupInternal &sg, size_t) { return prefix + "inSyn" + sg.getPSModelTargetName(); });
+        gen.addField(precision + "*", "denDelay",
+                     [prefix](const SynapseGroupInternal &sg, size_t) { return prefix + "denDelay" + sg.getPSModelTargetName(); });
+        gen.addField("unsigned int*", "denDelayInd",
+                     [prefix](const SynapseGroupInternal &sg, size_t) { return prefix + "denDelayInd" + sg.getPSModelTargetName(); });
+        gen.addField("unsigned int*", "denDelayCnt",
+                     [prefix](const SynapseGroupInternal &sg, size_t) { return prefix + "denDelayCnt" + sg.getPSModelTargetName(); });
+    }
+
     // Generate structure definitions and instantiation
     gen.generate(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar, runnerVarDecl, runnerMergedStructAlloc,
-                 mergedStructData, "SynapseDendriticDelayUpdate");
+                 mergedStructData, "SynapseDendriticDelayUpdate", false, true);
 }
 
 // ----------------------------------------------------------------------------
@@ -824,11 +952,14 @@ void CodeGenerator::SynapseConnectivityHostInitGroupMerged::generate(const Backe
         gen.addField(e.type + "*", e.name,
                      [e](const SynapseGroupInternal &g, size_t) { return "&" + e.name + g.getName(); });
 
-        gen.addField(e.type + "*", backend.getArrayPrefix() + e.name,
-                     [e, &backend](const SynapseGroupInternal &g, size_t) 
-                     { 
-                         return "&" + backend.getArrayPrefix() + e.name + g.getName();
-                     });
+        // **NOTE** if backend has no array prefix, host and device EGPs are the same
+        if(!backend.getArrayPrefix().empty()) {
+            gen.addField(e.type + "*", backend.getArrayPrefix() + e.name,
+                         [e, &backend](const SynapseGroupInternal &g, size_t) 
+                         { 
+                             return "&" + backend.getArrayPrefix() + e.name + g.getName();
+                         });
+        }
     }
 
     // Generate structure definitions and instantiation
@@ -909,6 +1040,13 @@ void CodeGenerator::SynapseConnectivityInitGroupMerged::generate(const BackendBa
         gen.addPointerField("unsigned int", "rowLength", backend.getArrayPrefix() + "rowLength");
         gen.addPointerField(getArchetype().getSparseIndType(), "ind", backend.getArrayPrefix() + "ind");
     }
+    // **NOTE** CSR indices are allocated once rows have been counted so, like pointer EGPs, are pushed to the structure when allocated
+    else if(getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+        gen.addPointerField("unsigned int", "rowPtr", backend.getArrayPrefix() + "rowPtr");
+        gen.addField(getArchetype().getSparseIndType() + "*", "ind",
+                     [&backend](const SynapseGroupInternal &sg, size_t){ return backend.getArrayPrefix() + "ind" + sg.getName(); },
+                     decltype(gen)::FieldType::PointerEGP);
+    }
     else if(getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
         gen.addPointerField("uint32_t", "gp", backend.getArrayPrefix() + "gp");
     }
@@ -953,22 +1091,50 @@ std::string CodeGenerator::SynapseGroupMergedBase::getPostsynapticBackPropDelayS
     }
 }
 //----------------------------------------------------------------------------
-std::string CodeGenerator::SynapseGroupMergedBase::getDendriticDelayOffset(const std::string &offset) const
+std::string CodeGenerator::SynapseGroupMergedBase::getDendriticDelaySlot(const std::string &offset) const
 {
     assert(getArchetype().isDendriticDelayRequired());
 
     if(offset.empty()) {
-        return "(*group.denDelayPtr * group.numTrgNeurons) + ";
+        return "(*group.denDelayPtr)";
     }
     else {
-        return "(((*group.denDelayPtr + " + offset + ") % " + std::to_string(getArchetype().getMaxDendriticDelayTimesteps()) + ") * group.numTrgNeurons) + ";
+        return "((*group.denDelayPtr + " + offset + ") % " + std::to_string(getArchetype().getMaxDendriticDelayTimesteps()) + ")";
     }
 }
 //----------------------------------------------------------------------------
+std::string CodeGenerator::SynapseGroupMergedBase::getDendriticDelayOffset(const std::string &offset) const
+{
+    return "(" + getDendriticDelaySlot(offset) + " * group.numTrgNeurons) + ";
+}
+//----------------------------------------------------------------------------
+std::string CodeGenerator::SynapseGroupMergedBase::getKernelIndex() const
+{
+    // **NOTE** merged groups all have the same kernel size so strides can be hard-coded
+    const auto &kernelSize = getArchetype().getKernelSize();
+    assert(!kernelSize.empty());
+    std::string kernelIndex;
+    size_t stride = 1;
+    for(size_t i = kernelSize.size(); i > 0; i--) {
+        const std::string coord = "($(" + std::to_string(i) + "))";
+        if(i == kernelSize.size()) {
+            kernelIndex = coord;
+        }
+        else {
+            kernelIndex = "(" + coord + " * " + std::to_string(stride) + ") + " + kernelIndex;
+        }
+        stride *= kernelSize[i - 1];
+    }
+    return "(" + kernelIndex + ")";
+}
+//----------------------------------------------------------------------------
 bool CodeGenerator::SynapseGroupMergedBase::isWUParamHeterogeneous(size_t paramIndex) const
 {
     const auto *wum = getArchetype().getWUModel();
     const std::string paramName = wum->getParamNames().at(paramIndex);
+    if(getArchetype().isWUParamDynamic(paramIndex)) {
+        return isParamReferenced({getArchetypeCode()}, paramName);
+    }
     return isParamValueHeterogeneous({getArchetypeCode()}, paramName, paramIndex,
                                      [](const SynapseGroupInternal &sg) { return sg.getWUParams(); });
 }
@@ -977,6 +1143,9 @@ bool CodeGenerator::SynapseGroupMergedBase::isWUDerivedParamHeterogeneous(size_t
 {
     const auto *wum = getArchetype().getWUModel();
     const std::string derivedParamName = wum->getDerivedParams().at(paramIndex).name;
+    if(getArchetype().isAnyWUParamDynamic()) {
+        return isParamReferenced({getArchetypeCode()}, derivedParamName);
+    }
     return isParamValueHeterogeneous({getArchetypeCode()}, derivedParamName, paramIndex,
                                      [](const SynapseGroupInternal &sg) { return sg.getWUDerivedParams(); });
 }
@@ -1040,6 +1209,9 @@ bool CodeGenerator::SynapseGroupMergedBase::isSrcNeuronParamHeterogeneous(size_t
 {
     const auto *neuronModel = getArchetype().getSrcNeuronGroup()->getNeuronModel();
     const std::string paramName = neuronModel->getParamNames().at(paramIndex) + "_pre";
+    if(getArchetype().getSrcNeuronGroup()->isParamDynamic(paramIndex)) {
+        return isParamReferenced({getArchetypeCode()}, paramName);
+    }
     return isParamValueHeterogeneous({getArchetypeCode()}, paramName, paramIndex,
                                      [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getParams(); });
 }
@@ -1048,6 +1220,9 @@ bool CodeGenerator::SynapseGroupMergedBase::isSrcNeuronDerivedParamHeterogeneous
 {
     const auto *neuronModel = getArchetype().getSrcNeuronGroup()->getNeuronModel();
     const std::string derivedParamName = neuronModel->getDerivedParams().at(paramIndex).name + "_pre";
+    if(getArchetype().getSrcNeuronGroup()->isAnyParamDynamic()) {
+        return isParamReferenced({getArchetypeCode()}, derivedParamName);
+    }
     return isParamValueHeterogeneous({getArchetypeCode()}, derivedParamName, paramIndex,
                                      [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getDerivedParams(); });
 }
@@ -1056,6 +1231,9 @@ bool CodeGenerator::SynapseGroupMergedBase::isTrgNeuronParamHeterogeneous(size_t
 {
     const auto *neuronModel = getArchetype().getTrgNeuronGroup()->getNeuronModel();
     const std::string paramName = neuronModel->getParamNames().at(paramIndex) + "_post";
+    if(getArchetype().getTrgNeuronGroup()->isParamDynamic(paramIndex)) {
+        return isParamReferenced({getArchetypeCode()}, paramName);
+    }
     return isParamValueHeterogeneous({getArchetypeCode()}, paramName, paramIndex,
                                      [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getParams(); });
 }
@@ -1064,10 +1242,23 @@ bool CodeGenerator::SynapseGroupMergedBase::isTrgNeuronDerivedParamHeterogeneous
 {
     const auto *neuronModel = getArchetype().getTrgNeuronGroup()->getNeuronModel();
     const std::string derivedParamName = neuronModel->getDerivedParams().at(paramIndex).name + "_post";
+    if(getArchetype().getTrgNeuronGroup()->isAnyParamDynamic()) {
+        return isParamReferenced({getArchetypeCode()}, derivedParamName);
+    }
     return isParamValueHeterogeneous({getArchetypeCode()}, derivedParamName, paramIndex,
                                      [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getDerivedParams(); });
 }
 //----------------------------------------------------------------------------
+bool CodeGenerator::SynapseGroupMergedBase::isEventThresholdConditionBitHeterogeneous() const
+{
+    const unsigned int archetypeBit = getArchetype().getEventThresholdConditionBit();
+    return std::any_of(getGroups().cbegin(), getGroups().cend(),
+                       [archetypeBit](const GroupInternal &sg)
+                       {
+                           return (sg.getEventThresholdConditionBit() != archetypeBit);
+                       });
+}
+//----------------------------------------------------------------------------
 void CodeGenerator::SynapseGroupMergedBase::generate(const BackendBase &backend, CodeStream &definitionsInternal,
                                                      CodeStream &definitionsInternalFunc, CodeStream &definitionsInternalVar,
                                                      CodeStream &runnerVarDecl, CodeStream &runnerMergedStructAlloc,
@@ -1102,6 +1293,12 @@ void CodeGenerator::SynapseGroupMergedBase::generate(const BackendBase &backend,
                          {
                              return "getSymbolAddress(" + backend.getScalarPrefix() + "denDelayPtr" + sg.getPSModelTargetName() + ")";
                          });
+
+            // If dendritic delay buffer is sparse, also add pointers to per-slot lists of occupied entries
+            if(getArchetype().isSparseDendriticDelayEnabled()) {
+                addPSPointerField(gen, "unsigned int", "denDelayInd", backend.getArrayPrefix() + "denDelayInd");
+                addPSPointerField(gen, "unsigned int", "denDelayCnt", backend.getArrayPrefix() + "denDelayCnt");
+            }
         }
         else {
             addPSPointerField(gen, precision, "inSyn", backend.getArrayPrefix() + "inSyn");
@@ -1117,6 +1314,18 @@ void CodeGenerator::SynapseGroupMergedBase::generate(const BackendBase &backend,
         if(getArchetype().isSpikeEventRequired()) {
             addSrcPointerField(gen, "unsigned int", "srcSpkCntEvnt", backend.getArrayPrefix() + "glbSpkCntEvnt");
             addSrcPointerField(gen, "unsigned int", "srcSpkEvnt", backend.getArrayPrefix() + "glbSpkEvnt");
+
+            if(getArchetype().isEventThresholdConditionMaskRequired()) {
+                addSrcPointerField(gen, "uint32_t", "srcSpkEvntCond", backend.getArrayPrefix() + "spkEvntCond");
+
+                if(isEventThresholdConditionBitHeterogeneous()) {
+                    gen.addField("uint32_t", "eventThresholdConditionMask",
+                                 [](const SynapseGroupInternal &sg, size_t)
+                                 {
+                                     return std::to_string(1u << sg.getEventThresholdConditionBit()) + "u";
+                                 });
+                }
+            }
         }
     }
     else if(role == Role::PostsynapticUpdate) {
@@ -1147,22 +1356,26 @@ void CodeGenerator::SynapseGroupMergedBase::generate(const BackendBase &backend,
         // Add heterogeneous presynaptic neuron model parameters
         gen.addHeterogeneousParams(getArchetype().getSrcNeuronGroup()->getNeuronModel()->getParamNames(), "Pre",
                                    [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getParams(); },
-                                   &SynapseGroupMergedBase::isSrcNeuronParamHeterogeneous);
+                                   &SynapseGroupMergedBase::isSrcNeuronParamHeterogeneous,
+                                   [](const SynapseGroupInternal &sg, size_t p) { return getDynamicParamName(*sg.getSrcNeuronGroup(), p); });
 
         // Add heterogeneous presynaptic neuron model derived parameters
         gen.addHeterogeneousDerivedParams(getArchetype().getSrcNeuronGroup()->getNeuronModel()->getDerivedParams(), "Pre",
                                           [](const SynapseGroupInternal &sg) { return sg.getSrcNeuronGroup()->getDerivedParams(); },
-                                          &SynapseGroupMergedBase::isSrcNeuronDerivedParamHeterogeneous);
+                                          &SynapseGroupMergedBase::isSrcNeuronDerivedParamHeterogeneous,
+                                          [](const SynapseGroupInternal &sg, size_t p) { return getDynamicDerivedParamName(*sg.getSrcNeuronGroup(), p); });
 
         // Add heterogeneous postsynaptic neuron model parameters
         gen.addHeterogeneousParams(getArchetype().getTrgNeuronGroup()->getNeuronModel()->getParamNames(), "Post",
                                    [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getParams(); },
-                                   &SynapseGroupMergedBase::isTrgNeuronParamHeterogeneous);
+                                   &SynapseGroupMergedBase::isTrgNeuronParamHeterogeneous,
+                                   [](const SynapseGroupInternal &sg, size_t p) { return getDynamicParamName(*sg.getTrgNeuronGroup(), p); });
 
         // Add heterogeneous postsynaptic neuron model derived parameters
         gen.addHeterogeneousDerivedParams(getArchetype().getTrgNeuronGroup()->getNeuronModel()->getDerivedParams(), "Post",
                                           [](const SynapseGroupInternal &sg) { return sg.getTrgNeuronGroup()->getDerivedParams(); },
-                                          &SynapseGroupMergedBase::isTrgNeuronDerivedParamHeterogeneous);
+                                          &SynapseGroupMergedBase::isTrgNeuronDerivedParamHeterogeneous,
+                                          [](const SynapseGroupInternal &sg, size_t p) { return getDynamicDerivedParamName(*sg.getTrgNeuronGroup(), p); });
 
         // Get correct code string
         const std::string code = getArchetypeCode();
@@ -1220,12 +1433,12 @@ void CodeGenerator::SynapseGroupMergedBase::generate(const BackendBase &backend,
         // Add heterogeneous weight update model parameters
         gen.addHeterogeneousParams(wum->getParamNames(), "",
                                    [](const SynapseGroupInternal &sg) { return sg.getWUParams(); },
-                                   &SynapseGroupMergedBase::isWUParamHeterogeneous);
+                                   &SynapseGroupMergedBase::isWUParamHeterogeneous, &getWUDynamicParamName);
 
         // Add heterogeneous weight update model derived parameters
         gen.addHeterogeneousDerivedParams(wum->getDerivedParams(), "",
                                           [](const SynapseGroupInternal &sg) { return sg.getWUDerivedParams(); },
-                                          &SynapseGroupMergedBase::isWUDerivedParamHeterogeneous);
+                                          &SynapseGroupMergedBase::isWUDerivedParamHeterogeneous, &getWUDynamicDerivedParamName);
 
         // Add pre and postsynaptic variables to struct
         gen.addVars(wum->getPreVars(), backend.getArrayPrefix());
@@ -1252,7 +1465,21 @@ void CodeGenerator::SynapseGroupMergedBase::generate(const BackendBase &backend,
     // Add pointers to connectivity data
     if(getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
         addWeightSharingPointerField(gen, "unsigned int", "rowLength", backend.getArrayPrefix() + "rowLength");
-        addWeightSharingPointerField(gen, getArchetype().getSparseIndType(), "ind", backend.getArrayPrefix() + "ind");
+        // Add compressed target indices in place of padded ones for presynaptic update
+        // **NOTE** like CSR indices, the stream is allocated once it has been sized so is pushed to the structure when allocated
+        if(getArchetype().isCompressedSparseIndEnabled() && role == Role::PresynapticUpdate) {
+            addWeightSharingPointerField(gen, "uint64_t", "rowOffset", backend.getArrayPrefix() + "rowOffset");
+            addWeightSharingPointerField(gen, "uint8_t", "indCompressed", backend.getArrayPrefix() + "indCompressed",
+                                         decltype(gen)::FieldType::PointerEGP);
+        }
+        else {
+            addWeightSharingPointerField(gen, getArchetype().getSparseIndType(), "ind", backend.getArrayPrefix() + "ind");
+        }
+
+        // Add target indices translated into reordered inSyn positions
+        if(getArchetype().isPostsynapticReorderingEnabled() && role == Role::PresynapticUpdate) {
+            addWeightSharingPointerField(gen, getArchetype().getSparseIndType(), "indInSyn", backend.getArrayPrefix() + "indInSyn");
+        }
 
         // Add additional structure for postsynaptic access
         if(backend.isPostsynapticRemapRequired() && !wum->getLearnPostCode().empty()
@@ -1269,19 +1496,37 @@ void CodeGenerator::SynapseGroupMergedBase::generate(const BackendBase &backend,
             addWeightSharingPointerField(gen, "unsigned int", "synRemap", backend.getArrayPrefix() + "synRemap");
         }
     }
+    else if(getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR) {
+        addWeightSharingPointerField(gen, "unsigned int", "rowPtr", backend.getArrayPrefix() + "rowPtr");
+        addWeightSharingPointerField(gen, getArchetype().getSparseIndType(), "ind", backend.getArrayPrefix() + "ind",
+                                     decltype(gen)::FieldType::PointerEGP);
+
+        // Add additional structure for postsynaptic access
+        if(backend.isPostsynapticRemapRequired() && !wum->getLearnPostCode().empty()
+           && (role == Role::PostsynapticUpdate || role == Role::SparseInit))
+        {
+            addWeightSharingPointerField(gen, "unsigned int", "colLength", backend.getArrayPrefix() + "colLength");
+            addWeightSharingPointerField(gen, "unsigned int", "remap", backend.getArrayPrefix() + "remap");
+        }
+    }
     else if(getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
         addWeightSharingPointerField(gen, "uint32_t", "gp", backend.getArrayPrefix() + "gp");
+
+        if(getArchetype().isBitmaskRowWordRangeEnabled() && role == Role::PresynapticUpdate) {
+            addWeightSharingPointerField(gen, "unsigned int", "rowWordRange", backend.getArrayPrefix() + "rowWordRange");
+        }
     }
     else if(getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) {
         gen.addEGPs(getArchetype().getConnectivityInitialiser().getSnippet()->getExtraGlobalParams(),
                     backend.getArrayPrefix());
     }
 
-    // If WU variables are procedural and this is an update or WU variables are individual
+    // If WU variables are procedural and this is an update or WU variables are individual or stored in a kernel
     const auto vars = wum->getVars();
     const auto &varInit = getArchetype().getWUVarInitialisers();
     const bool proceduralWeights = (getArchetype().getMatrixType() & SynapseMatrixWeight::PROCEDURAL);
-    const bool individualWeights = (getArchetype().getMatrixType() & SynapseMatrixWeight::INDIVIDUAL);
+    const bool individualWeights = ((getArchetype().getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)
+                                    || (getArchetype().getMatrixType() & SynapseMatrixWeight::KERNEL));
     if((proceduralWeights && updateRole) || individualWeights) {
         // If we're performing a procedural update or we're initializing individual variables
         if((proceduralWeights && updateRole) || !updateRole) {
@@ -1299,7 +1544,10 @@ void CodeGenerator::SynapseGroupMergedBase::generate(const BackendBase &backend,
             // (otherwise, it's not needed during initialization)
             const auto var = vars[v];
             if(individualWeights && (updateRole || !varInit.at(v).getSnippet()->getCode().empty())) {
-                addWeightSharingPointerField(gen, var.type, var.name, backend.getArrayPrefix() + var.name);
+                // **NOTE** with CSR connectivity, variables are allocated alongside the postsynaptic indices
+                const bool csr = (getArchetype().getMatrixType() & SynapseMatrixConnectivity::CSR);
+                addWeightSharingPointerField(gen, getVarStorageType(var.type, getArchetype().getWUVarStorage(v)), var.name, backend.getArrayPrefix() + var.name,
+                                             csr ? decltype(gen)::FieldType::PointerEGP : decltype(gen)::FieldType::Standard);
             }
 
             // If we're performing a procedural update or we're initializing, add any var init EGPs to structure
@@ -1341,7 +1589,7 @@ void CodeGenerator::SynapseGroupMergedBase::generate(const BackendBase &backend,
 
     // Generate structure definitions and instantiation
     gen.generate(backend, definitionsInternal, definitionsInternalFunc, definitionsInternalVar, runnerVarDecl, runnerMergedStructAlloc,
-                 mergedStructData, name);
+                 mergedStructData, name, false, true);
 }
 //----------------------------------------------------------------------------
 void CodeGenerator::SynapseGroupMergedBase::addPSPointerField(MergedStructGenerator<SynapseGroupMergedBase> &gen,
@@ -1366,7 +1614,8 @@ void CodeGenerator::SynapseGroupMergedBase::addTrgPointerField(MergedStructGener
 }
 //----------------------------------------------------------------------------
 void CodeGenerator::SynapseGroupMergedBase::addWeightSharingPointerField(MergedStructGenerator<SynapseGroupMergedBase> &gen,
-                                                                         const std::string &type, const std::string &name, const std::string &prefix) const
+                                                                         const std::string &type, const std::string &name, const std::string &prefix,
+                                                                         MergedStructGenerator<SynapseGroupMergedBase>::FieldType fieldType) const
 {
     assert(!Utils::isTypePointer(type));
     gen.addField(type + "*", name, 
@@ -1378,5 +1627,6 @@ void CodeGenerator::SynapseGroupMergedBase::addWeightSharingPointerField(MergedS
                      else {
                          return prefix + sg.getName();
                      }
-                 });
+                 },
+                 fieldType);
 }
\ No newline at end of file
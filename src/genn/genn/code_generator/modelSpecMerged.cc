@@ -110,7 +110,8 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
     createMergedGroups(model.getSynapseGroups(), m_MergedSynapseDenseInitGroups,
                        [](const SynapseGroupInternal &sg)
                        {
-                           return ((sg.getMatrixType() & SynapseMatrixConnectivity::DENSE) && sg.isWUVarInitRequired());
+                           return (((sg.getMatrixType() & SynapseMatrixConnectivity::DENSE) || (sg.getMatrixType() & SynapseMatrixWeight::KERNEL))
+                                   && sg.isWUVarInitRequired());
                        },
                        [](const SynapseGroupInternal &a, const SynapseGroupInternal &b){ return a.canWUInitBeMerged(b); });
 
@@ -123,7 +124,7 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
     createMergedGroups(model.getSynapseGroups(), m_MergedSynapseSparseInitGroups,
                        [&backend](const SynapseGroupInternal &sg)
                        {
-                           return ((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) && 
+                           return (((sg.getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (sg.getMatrixType() & SynapseMatrixConnectivity::CSR)) && 
                                    (sg.isWUVarInitRequired()
                                     || (backend.isSynRemapRequired() && !sg.getWUModel()->getSynapseDynamicsCode().empty())
                                     || (backend.isPostsynapticRemapRequired() && !sg.getWUModel()->getLearnPostCode().empty())));
@@ -132,7 +133,7 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
 
     LOGD_CODE_GEN << "Merging neuron groups which require their spike queues updating:";
     createMergedGroups(model.getNeuronGroups(), m_MergedNeuronSpikeQueueUpdateGroups,
-                       [](const NeuronGroupInternal &){ return true; },
+                       [&backend](const NeuronGroupInternal &){ return backend.isNeuronSpikeQueueUpdateRequired(); },
                        [](const NeuronGroupInternal &a, const NeuronGroupInternal &b)
                        {
                            return ((a.getNumDelaySlots() == b.getNumDelaySlots())
@@ -153,7 +154,8 @@ CodeGenerator::ModelSpecMerged::ModelSpecMerged(const ModelSpecInternal &model,
     createMergedGroups(synapseGroupsWithDendriticDelay, m_MergedSynapseDendriticDelayUpdateGroups,
                        [](const SynapseGroupInternal &a, const SynapseGroupInternal &b)
                        {
-                           return (a.getMaxDendriticDelayTimesteps() == b.getMaxDendriticDelayTimesteps());
+                           return ((a.getMaxDendriticDelayTimesteps() == b.getMaxDendriticDelayTimesteps())
+                                   && (a.isSparseDendriticDelayEnabled() == b.isSparseDendriticDelayEnabled()));
                        });
 
     LOGD_CODE_GEN << "Merging synapse groups which require host code to initialise their synaptic connectivity:";
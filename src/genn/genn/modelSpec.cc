@@ -15,6 +15,8 @@
 // Standard C++ includes
 #include <algorithm>
 #include <numeric>
+#include <regex>
+#include <set>
 #include <typeinfo>
 
 // Standard C includes
@@ -34,7 +36,7 @@
 // ------------------------------------------------------------------------
 // class ModelSpec for specifying a neuronal network model
 ModelSpec::ModelSpec()
-:   m_TimePrecision(TimePrecision::DEFAULT), m_DT(0.5), m_TimingEnabled(false), m_Seed(0),
+:   m_TimePrecision(TimePrecision::DEFAULT), m_DT(0.5), m_TimingEnabled(false), m_ProfilingEnabled(false), m_PerfCountersEnabled(false), m_BatchSize(1), m_Seed(0),
     m_DefaultVarLocation(VarLocation::HOST_DEVICE), m_DefaultExtraGlobalParamLocation(VarLocation::HOST_DEVICE),
     m_DefaultSparseConnectivityLocation(VarLocation::HOST_DEVICE), m_DefaultNarrowSparseIndEnabled(false),
     m_ShouldMergePostsynapticModels(false)
@@ -122,6 +124,13 @@ void ModelSpec::setPrecision(FloatType floattype /**<  */)
     }
 }
 
+void ModelSpec::setBatchSize(unsigned int batchSize)
+{
+    if(batchSize == 0) {
+        throw std::runtime_error("Batch size must be at least 1.");
+    }
+    m_BatchSize = batchSize;
+}
 
 void ModelSpec::finalize()
 {
@@ -138,6 +147,13 @@ void ModelSpec::finalize()
         // Initialize derived parameters
         s.second.initDerivedParams(m_DT);
 
+        // CSR variables are sized once connectivity is built so there is no stride between batches
+        if((s.second.getMatrixType() & SynapseMatrixConnectivity::CSR) && (s.second.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)
+           && m_BatchSize > 1)
+        {
+            throw std::runtime_error("Synapse group '" + s.first + "' cannot use CSR connectivity with individual weights in batched models");
+        }
+
         // Mark any pre or postsyaptic neuron variables referenced in sim code as requiring queues
         if (!wu->getSimCode().empty()) {
             s.second.getSrcNeuronGroup()->updatePreVarQueues(wu->getSimCode());
@@ -178,6 +194,7 @@ void ModelSpec::finalize()
 
     // Loop through neuron populations and their outgoing synapse populations
     for(auto &n : m_LocalNeuronGroups) {
+        std::vector<std::pair<SynapseGroupInternal*, std::string>> eventThresholdCodes;
         for(auto *sg : n.second.getOutSyn()) {
             const auto *wu = sg->getWUModel();
 
@@ -185,6 +202,22 @@ void ModelSpec::finalize()
                 using namespace CodeGenerator;
                 assert(!wu->getEventThresholdConditionCode().empty());
 
+                // Because parameters are substituted into the event threshold condition below, they cannot be dynamic
+                if(sg->isAnyWUParamDynamic()) {
+                    const std::string &eventThresholdCode = wu->getEventThresholdConditionCode();
+                    const auto paramNames = wu->getParamNames();
+                    for(size_t i = 0; i < paramNames.size(); i++) {
+                        if(sg->isWUParamDynamic(i) && eventThresholdCode.find("$(" + paramNames[i] + ")") != std::string::npos) {
+                            throw std::runtime_error("Dynamic parameter '" + paramNames[i] + "' of synapse group '" + sg->getName() + "' cannot be used in event threshold condition");
+                        }
+                    }
+                    for(const auto &d : wu->getDerivedParams()) {
+                        if(eventThresholdCode.find("$(" + d.name + ")") != std::string::npos) {
+                            throw std::runtime_error("Dynamic derived parameter '" + d.name + "' of synapse group '" + sg->getName() + "' cannot be used in event threshold condition");
+                        }
+                    }
+                }
+
                 // do an early replacement of weight update model parameters and derived parameters
                 // **NOTE** this is really gross but I can't really see an alternative - merging decisions are based on the spike event conditions set
                 // **NOTE** we do not substitute EGP names here as they aren't known and don't effect merging
@@ -198,16 +231,109 @@ void ModelSpec::finalize()
 
                 // Add code and name of support code namespace to set	
                 n.second.addSpkEventCondition(eCode, sg);
+                eventThresholdCodes.emplace_back(sg, eCode);
+            }
+        }
+
+        // If there are several conditions, each spike-like event records which conditions fired in a
+        // bitmask so synapse groups can test their bit rather than re-evaluating their condition
+        if (n.second.isSpikeEventConditionMaskRequired()) {
+            if(n.second.getSpikeEventCondition().size() > 32) {
+                throw std::runtime_error("Neuron group '" + n.first + "' has more than 32 distinct spike event conditions");
             }
+            for(const auto &e : eventThresholdCodes) {
+                e.first->setEventThresholdConditionBit((unsigned int)n.second.getSpikeEventConditionIndex(e.second, e.first));
+            }
+        }
+    }
+}
+
+void ModelSpec::partition(int hostID)
+{
+    // Check synapse groups which receive spikes from another host can be simulated using only those spikes
+    const std::regex preReference(R"(\$\((\w+)_pre\))");
+    for(const auto &s : m_LocalSynapseGroups) {
+        const auto *srcNeuronGroup = s.second.getSrcNeuronGroup();
+        const auto *trgNeuronGroup = s.second.getTrgNeuronGroup();
+        if(trgNeuronGroup->getHostID() != hostID) {
+            continue;
+        }
+
+        // Check weight sharing master is also simulated on this host
+        if(s.second.isWeightSharingSlave()
+           && s.second.getWeightSharingMaster()->getTrgNeuronGroup()->getHostID() != hostID)
+        {
+            throw std::runtime_error("Synapse group '" + s.first + "' shares weights with synapse group '"
+                                     + s.second.getWeightSharingMaster()->getName() + "' which is simulated on another host");
+        }
+
+        if(srcNeuronGroup->getHostID() == hostID) {
+            continue;
         }
-        if (n.second.getSpikeEventCondition().size() > 1) {
-            for(auto *sg : n.second.getOutSyn()) {
-                if (!sg->getWUModel()->getEventCode().empty()) {
-                    sg->setEventThresholdReTestRequired(true);
+
+        // Only true spikes are exchanged between hosts so presynaptic state and spike-like events are unavailable
+        const auto *wu = s.second.getWUModel();
+        if(!wu->getEventCode().empty() || !wu->getPreSpikeCode().empty() || !wu->getPreVars().empty()) {
+            throw std::runtime_error("Synapse group '" + s.first + "' with presynaptic neuron group simulated on another host "
+                                     "cannot use spike-like events or presynaptic weight update model variables");
+        }
+        for(const auto &code : {wu->getSimCode(), wu->getLearnPostCode(), wu->getSynapseDynamicsCode()}) {
+            for(std::sregex_iterator m(code.cbegin(), code.cend(), preReference); m != std::sregex_iterator(); m++) {
+                if((*m)[1] != "id") {
+                    throw std::runtime_error("Synapse group '" + s.first + "' with presynaptic neuron group simulated on another host "
+                                             "cannot reference presynaptic neuron state '" + (*m)[0].str() + "'");
                 }
             }
         }
     }
+
+    // Loop through synapse groups
+    std::set<const NeuronGroupInternal*> remoteSrcNeuronGroups;
+    for(auto s = m_LocalSynapseGroups.begin(); s != m_LocalSynapseGroups.end();) {
+        auto *srcNeuronGroup = s->second.getSrcNeuronGroup();
+        const int trgHostID = s->second.getTrgNeuronGroup()->getHostID();
+
+        // If target neuron group is simulated on this host, keep synapse group
+        // and, if the source neuron group isn't, mark it as requiring a placeholder
+        if(trgHostID == hostID) {
+            if(srcNeuronGroup->getHostID() != hostID) {
+                remoteSrcNeuronGroups.insert(srcNeuronGroup);
+            }
+            ++s;
+        }
+        // Otherwise, if source neuron group is simulated on this host, 
+        // its spikes need sending to target's host before synapse group is removed
+        else {
+            if(srcNeuronGroup->getHostID() == hostID) {
+                srcNeuronGroup->addSpikeDestinationHost(trgHostID);
+            }
+            srcNeuronGroup->removeOutSyn(&s->second);
+            s = m_LocalSynapseGroups.erase(s);
+        }
+    }
+
+    // Loop through neuron groups
+    for(auto n = m_LocalNeuronGroups.begin(); n != m_LocalNeuronGroups.end();) {
+        if(n->second.getHostID() == hostID) {
+            ++n;
+            continue;
+        }
+
+        // Remove any current sources injecting into neuron group
+        for(const auto *cs : n->second.getCurrentSources()) {
+            const std::string csName = cs->getName();
+            m_LocalCurrentSources.erase(csName);
+        }
+
+        // If neuron group provides spikes to local synapse groups, replace it with placeholder, otherwise remove it
+        if(remoteSrcNeuronGroups.find(&n->second) != remoteSrcNeuronGroups.cend()) {
+            n->second.makeRemote();
+            ++n;
+        }
+        else {
+            n = m_LocalNeuronGroups.erase(n);
+        }
+    }
 }
 
 std::string ModelSpec::scalarExpr(double val) const
@@ -243,6 +369,17 @@ bool ModelSpec::zeroCopyInUse() const
     return false;
 }
 
+bool ModelSpec::isConnectivityCacheRequired(const SynapseGroupInternal &sg) const
+{
+    // Connectivity can only be cached if caching is enabled and it will be identical in every run
+    // i.e. it is built from a fixed seed without reference to extra global parameters or host initialisation code
+    // **NOTE** CSR connectivity is allocated while it is built so can't be loaded into existing arrays
+    const auto *snippet = sg.getConnectivityInitialiser().getSnippet();
+    return (!m_ConnectivityCacheDirectory.empty() && m_Seed != 0 && sg.isSparseConnectivityInitRequired()
+            && !(sg.getMatrixType() & SynapseMatrixConnectivity::CSR)
+            && snippet->getExtraGlobalParams().empty() && snippet->getHostInitCode().empty());
+}
+
 NeuronGroupInternal *ModelSpec::findNeuronGroupInternal(const std::string &name)
 {
     // If a matching local neuron group is found, return it
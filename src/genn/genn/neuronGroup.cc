@@ -2,6 +2,7 @@
 
 // Standard includes
 #include <algorithm>
+#include <cassert>
 #include <cmath>
 
 // GeNN includes
@@ -44,6 +45,27 @@ bool checkCompatibleUnordered(const std::vector<T> &ours, std::vector<T> &others
         return false;
     }
 }
+//----------------------------------------------------------------------------
+bool isEGPInThresholdCode(const std::string &code, const SynapseGroupInternal *synapseGroup)
+{
+    // Determine if any EGPs are required by threshold code
+    const auto wuEGPs = synapseGroup->getWUModel()->getExtraGlobalParams();
+    return std::any_of(wuEGPs.cbegin(), wuEGPs.cend(),
+                       [&code](const Snippet::Base::EGP &egp)
+                       {
+                           return (code.find("$(" + egp.name + ")") != std::string::npos);
+                       });
+}
+//----------------------------------------------------------------------------
+// RemoteNeuron
+//----------------------------------------------------------------------------
+//! Placeholder neuron model used for neuron groups simulated on another host
+class RemoteNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(RemoteNeuron, 0, 0);
+};
+IMPLEMENT_MODEL(RemoteNeuron);
 }   // Anonymous namespace
 
 // ------------------------------------------------------------------------
@@ -63,6 +85,11 @@ void NeuronGroup::setExtraGlobalParamLocation(const std::string &paramName, VarL
     m_ExtraGlobalParamLocation[extraGlobalParamIndex] = loc;
 }
 //----------------------------------------------------------------------------
+void NeuronGroup::setParamDynamic(const std::string &paramName, bool dynamic)
+{
+    m_ParamDynamic[getNeuronModel()->getParamIndex(paramName)] = dynamic;
+}
+//----------------------------------------------------------------------------
 VarLocation NeuronGroup::getVarLocation(const std::string &varName) const
 {
     return m_VarLocation[getNeuronModel()->getVarIndex(varName)];
@@ -73,6 +100,11 @@ VarLocation NeuronGroup::getExtraGlobalParamLocation(const std::string &paramNam
     return m_ExtraGlobalParamLocation[getNeuronModel()->getExtraGlobalParamIndex(paramName)];
 }
 //----------------------------------------------------------------------------
+bool NeuronGroup::isAnyParamDynamic() const
+{
+    return std::any_of(m_ParamDynamic.cbegin(), m_ParamDynamic.cend(), [](bool d) { return d; });
+}
+//----------------------------------------------------------------------------
 bool NeuronGroup::isSpikeTimeRequired() const
 {
     // If any INCOMING synapse groups require POSTSYNAPTIC spike times, return true
@@ -108,7 +140,8 @@ bool NeuronGroup::isTrueSpikeRequired() const
         return true;
     }
 
-    return false;
+    // If spikes are sent to synapse groups simulated on other hosts, return true
+    return !getSpikeDestinationHosts().empty();
 }
 //----------------------------------------------------------------------------
 bool NeuronGroup::isSpikeEventRequired() const
@@ -139,6 +172,7 @@ bool NeuronGroup::isSimRNGRequired() const
 {
     // Returns true if any parts of the neuron code require an RNG
     if(Utils::isRNGRequired(getNeuronModel()->getSimCode())
+        || Utils::isRNGRequired(getNeuronModel()->getODECode())
         || Utils::isRNGRequired(getNeuronModel()->getThresholdConditionCode())
         || Utils::isRNGRequired(getNeuronModel()->getResetCode()))
     {
@@ -201,6 +235,28 @@ void NeuronGroup::injectCurrent(CurrentSourceInternal *src)
     m_CurrentSources.push_back(src);
 }
 //----------------------------------------------------------------------------
+void NeuronGroup::removeOutSyn(SynapseGroupInternal *synapseGroup)
+{
+    m_OutSyn.erase(std::remove(m_OutSyn.begin(), m_OutSyn.end(), synapseGroup), m_OutSyn.end());
+}
+//----------------------------------------------------------------------------
+void NeuronGroup::makeRemote()
+{
+    // Replace neuron model with placeholder
+    m_NeuronModel = RemoteNeuron::getInstance();
+    m_Params.clear();
+    m_VarInitialisers.clear();
+    m_VarQueueRequired.clear();
+    m_VarLocation.clear();
+    m_ExtraGlobalParamLocation.clear();
+
+    // Any incoming synapse groups and current sources are simulated on the host this group belongs to
+    m_InSyn.clear();
+    m_CurrentSources.clear();
+
+    m_Remote = true;
+}
+//----------------------------------------------------------------------------
 void NeuronGroup::checkNumDelaySlots(unsigned int requiredDelay)
 {
     if (requiredDelay >= getNumDelaySlots())
@@ -329,17 +385,19 @@ std::vector<SynapseGroupInternal*> NeuronGroup::getOutSynWithPreVars() const
 //----------------------------------------------------------------------------
 void NeuronGroup::addSpkEventCondition(const std::string &code, SynapseGroupInternal *synapseGroup)
 {
-    const auto *wu = synapseGroup->getWUModel();
-
-    // Determine if any EGPs are required by threshold code
-    const auto wuEGPs = wu->getExtraGlobalParams();
-    const bool egpInThresholdCode = std::any_of(wuEGPs.cbegin(), wuEGPs.cend(),
-                                                [&code](const Snippet::Base::EGP &egp)
-                                                {
-                                                    return (code.find("$(" + egp.name + ")") != std::string::npos);
-                                                });
     // Add threshold, support code, synapse group and whether egps are required to set
-    m_SpikeEventCondition.emplace(code, wu->getSimSupportCode(), egpInThresholdCode, synapseGroup);
+    const auto *wu = synapseGroup->getWUModel();
+    m_SpikeEventCondition.emplace(code, wu->getSimSupportCode(), isEGPInThresholdCode(code, synapseGroup), synapseGroup);
+}
+//----------------------------------------------------------------------------
+size_t NeuronGroup::getSpikeEventConditionIndex(const std::string &code, SynapseGroupInternal *synapseGroup) const
+{
+    // Find condition using same comparison as was used when adding it to set
+    const auto *wu = synapseGroup->getWUModel();
+    const auto cond = m_SpikeEventCondition.find(SpikeEventThreshold(code, wu->getSimSupportCode(),
+                                                                     isEGPInThresholdCode(code, synapseGroup), synapseGroup));
+    assert(cond != m_SpikeEventCondition.cend());
+    return std::distance(m_SpikeEventCondition.cbegin(), cond);
 }
 //----------------------------------------------------------------------------
 bool NeuronGroup::isVarQueueRequired(const std::string &var) const
@@ -355,7 +413,8 @@ bool NeuronGroup::canBeMerged(const NeuronGroup &other) const
        && (getSpikeEventCondition() == other.getSpikeEventCondition())
        && (isSpikeEventRequired() == other.isSpikeEventRequired())
        && (getNumDelaySlots() == other.getNumDelaySlots())
-       && (m_VarQueueRequired == other.m_VarQueueRequired))
+       && (m_VarQueueRequired == other.m_VarQueueRequired)
+       && (m_ParamDynamic == other.m_ParamDynamic))
     {
 
         // Check if, by reshuffling, all current sources are compatible
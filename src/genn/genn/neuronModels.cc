@@ -1,5 +1,13 @@
 #include "neuronModels.h"
 
+// Standard C++ includes
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+// GeNN includes
+#include "gennUtils.h"
+
 // Implement models
 IMPLEMENT_MODEL(NeuronModels::RulkovMap);
 IMPLEMENT_MODEL(NeuronModels::Izhikevich);
@@ -7,13 +15,122 @@ IMPLEMENT_MODEL(NeuronModels::IzhikevichVariable);
 IMPLEMENT_MODEL(NeuronModels::LIF);
 IMPLEMENT_MODEL(NeuronModels::SpikeSource);
 IMPLEMENT_MODEL(NeuronModels::SpikeSourceArray);
+IMPLEMENT_MODEL(NeuronModels::SpikeSourceSchedule);
 IMPLEMENT_MODEL(NeuronModels::Poisson);
 IMPLEMENT_MODEL(NeuronModels::PoissonNew);
+IMPLEMENT_MODEL(NeuronModels::PoissonEventDriven);
 IMPLEMENT_MODEL(NeuronModels::TraubMiles);
 IMPLEMENT_MODEL(NeuronModels::TraubMilesFast);
 IMPLEMENT_MODEL(NeuronModels::TraubMilesAlt);
 IMPLEMENT_MODEL(NeuronModels::TraubMilesNStep);
 
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Butcher tableau of an explicit Runge-Kutta method
+struct ButcherTableau
+{
+    std::vector<double> c;
+    std::vector<std::vector<double>> a;
+};
+
+const ButcherTableau forwardEulerTableau{{0.0}, {{}}};
+const ButcherTableau rk4Tableau{{0.0, 0.5, 0.5, 1.0},
+                                {{}, {0.5}, {0.0, 0.5}, {0.0, 0.0, 1.0}}};
+
+// Cash-Karp embedded 5th/4th order method (Numerical Recipes in C p717)
+const ButcherTableau cashKarpTableau{{0.0, 1.0 / 5.0, 3.0 / 10.0, 3.0 / 5.0, 1.0, 7.0 / 8.0},
+                                     {{},
+                                      {1.0 / 5.0},
+                                      {3.0 / 40.0, 9.0 / 40.0},
+                                      {3.0 / 10.0, -9.0 / 10.0, 6.0 / 5.0},
+                                      {-11.0 / 54.0, 5.0 / 2.0, -70.0 / 27.0, 35.0 / 27.0},
+                                      {1631.0 / 55296.0, 175.0 / 512.0, 575.0 / 13824.0, 44275.0 / 110592.0, 253.0 / 4096.0}}};
+const std::vector<double> cashKarpWeights{37.0 / 378.0, 0.0, 250.0 / 621.0, 125.0 / 594.0, 0.0, 512.0 / 1771.0};
+const std::vector<double> cashKarpErrorWeights{(37.0 / 378.0) - (2825.0 / 27648.0), 0.0, (250.0 / 621.0) - (18575.0 / 48384.0),
+                                               (125.0 / 594.0) - (13525.0 / 55296.0), -277.0 / 14336.0, (512.0 / 1771.0) - 0.25};
+
+// Smallest RK45 step size, as a fraction of DT, which is accepted regardless of error so step size cannot underflow to zero
+const double rk45MinStepFraction = 1E-12;
+
+// Maximum number of RK45 steps per timestep after which the remainder of the timestep is integrated in one step
+// **NOTE** this guarantees termination even if the minimum step size is too small to advance time in single precision
+const unsigned int rk45MaxSteps = 10000;
+
+// Replace all occurences of trg in code with rep, without rescanning replacements
+void substituteAll(std::string &code, const std::string &trg, const std::string &rep)
+{
+    for(size_t found = code.find(trg); found != std::string::npos; found = code.find(trg, found + rep.size())) {
+        code.replace(found, trg.size(), rep);
+    }
+}
+
+// Get RHS of ODE with variables replaced by the values returned by getValue (where these aren't empty)
+// and, if time is specified, time replaced by an offset from the start of the timestep
+template<typename G>
+std::string getRHS(const NeuronModels::Base::ODE &ode, const NeuronModels::Base::ODEVec &odes,
+                   G getValue, const std::string &time = "")
+{
+    std::string rhs = ode.rhs;
+    for(const auto &o : odes) {
+        const std::string value = getValue(o.var);
+        if(!value.empty()) {
+            substituteAll(rhs, "$(" + o.var + ")", value);
+        }
+    }
+    if(!time.empty()) {
+        substituteAll(rhs, "$(t)", "($(t) + " + time + ")");
+    }
+    return rhs;
+}
+
+// Write weighted sum of stage derivatives of variable, skipping zero weights
+void genWeightedSum(std::ostream &os, const std::string &var, const std::vector<double> &weights)
+{
+    os << "(";
+    bool first = true;
+    for(size_t i = 0; i < weights.size(); i++) {
+        if(weights[i] != 0.0) {
+            if(!first) {
+                os << " + ";
+            }
+            os << "(" << Utils::writePreciseString(weights[i]) << " * odeK" << (i + 1) << "_" << var << ")";
+            first = false;
+        }
+    }
+    os << ")";
+}
+
+// Generate code to evaluate derivatives of every ODE at each stage of explicit Runge-Kutta method
+void genStages(std::ostream &os, const NeuronModels::Base::ODEVec &odes, const ButcherTableau &tableau, bool timeDependent)
+{
+    for(size_t s = 0; s < tableau.c.size(); s++) {
+        const std::string stage = std::to_string(s + 1);
+
+        // Calculate state at start of all but first stage
+        if(s > 0) {
+            for(const auto &o : odes) {
+                os << "const scalar ode" << stage << "_" << o.var << " = $(" << o.var << ") + (odeH * ";
+                genWeightedSum(os, o.var, tableau.a[s]);
+                os << ");" << std::endl;
+            }
+        }
+
+        // Evaluate derivatives
+        const std::string time = (timeDependent && tableau.c[s] != 0.0) ? ("odeTime + (" + Utils::writePreciseString(tableau.c[s]) + " * odeH)")
+            : (timeDependent ? "odeTime" : "");
+        for(const auto &o : odes) {
+            os << "const scalar odeK" << stage << "_" << o.var << " = ";
+            os << getRHS(o, odes, [&stage, s](const std::string &v){ return (s > 0) ? ("ode" + stage + "_" + v) : ""; }, time);
+            os << ";" << std::endl;
+        }
+    }
+}
+}   // Anonymous namespace
+
+
 //----------------------------------------------------------------------------
 // NeuronModels::Base
 //----------------------------------------------------------------------------
@@ -25,5 +142,128 @@ bool NeuronModels::Base::canBeMerged(const Base *other) const
             && (getResetCode() == other->getResetCode())
             && (getSupportCode() == other->getSupportCode())
             && (isAutoRefractoryRequired() == other->isAutoRefractoryRequired())
-            && (getAdditionalInputVars() == other->getAdditionalInputVars()));
+            && (getAdditionalInputVars() == other->getAdditionalInputVars())
+            && (getODECode() == other->getODECode()));
+}
+//----------------------------------------------------------------------------
+std::string NeuronModels::Base::getODECode() const
+{
+    const auto odes = getODEs();
+    if(odes.empty()) {
+        return "";
+    }
+
+    // Check ODEs each integrate a different model variable
+    const auto vars = getVars();
+    for(auto o = odes.cbegin(); o != odes.cend(); o++) {
+        if(std::none_of(vars.cbegin(), vars.cend(), [o](const Models::Base::Var &v){ return (v.name == o->var); })) {
+            throw std::runtime_error("ODE integrates '" + o->var + "' which is not a variable of the neuron model");
+        }
+        if(std::any_of(odes.cbegin(), o, [o](const ODE &other){ return (other.var == o->var); })) {
+            throw std::runtime_error("Multiple ODEs integrate variable '" + o->var + "'");
+        }
+    }
+
+    const unsigned int substeps = getODESubsteps();
+    if(substeps == 0) {
+        throw std::runtime_error("ODEs must be integrated with at least one substep");
+    }
+
+    // Offsets from the start of the timestep only need calculating if derivatives depend on time
+    const bool timeDependent = std::any_of(odes.cbegin(), odes.cend(),
+                                           [](const ODE &o){ return (o.rhs.find("$(t)") != std::string::npos); });
+
+    std::ostringstream os;
+    os << "// integrate ODEs" << std::endl;
+    os << "{" << std::endl;
+    const ODEIntegrator integrator = getODEIntegrator();
+    if(integrator == ODEIntegrator::RK45) {
+        os << "scalar odeTime = 0.0;" << std::endl;
+        os << "scalar odeH = DT / " << substeps << ".0;" << std::endl;
+        os << "const scalar odeMinH = DT * " << Utils::writePreciseString(rk45MinStepFraction) << ";" << std::endl;
+        os << "unsigned int odeNumSteps = 0;" << std::endl;
+        os << "while(true) {" << std::endl;
+        {
+            // If too many steps have been taken, force this to be the last step
+            os << "odeNumSteps++;" << std::endl;
+            os << "const bool odeForceLastStep = (odeNumSteps >= " << rk45MaxSteps << ");" << std::endl;
+
+            // Shorten final step so it ends exactly at the end of the timestep
+            os << "const bool odeLastStep = (odeForceLastStep || (odeH >= (DT - odeTime)));" << std::endl;
+            os << "if(odeLastStep) {" << std::endl;
+            os << "odeH = DT - odeTime;" << std::endl;
+            os << "}" << std::endl;
+
+            genStages(os, odes, cashKarpTableau, timeDependent);
+
+            // Calculate largest error relative to tolerance
+            const std::string tolerance = Utils::writePreciseString(getODETolerance());
+            os << "scalar odeErr = 0.0;" << std::endl;
+            for(const auto &o : odes) {
+                os << "odeErr = fmax(odeErr, fabs(odeH * ";
+                genWeightedSum(os, o.var, cashKarpErrorWeights);
+                os << ") / (" << tolerance << " * (1.0 + fabs($(" << o.var << ")))));" << std::endl;
+            }
+
+            // If error is within tolerance (or NaN), step size has reached its minimum or this is a forced last step,
+            // accept step and grow step size so integration always terminates
+            os << "if(!(odeErr > 1.0) || (odeH <= odeMinH) || odeForceLastStep) {" << std::endl;
+            for(const auto &o : odes) {
+                os << "$(" << o.var << ") += odeH * ";
+                genWeightedSum(os, o.var, cashKarpWeights);
+                os << ";" << std::endl;
+            }
+            os << "if(odeLastStep) {" << std::endl;
+            os << "break;" << std::endl;
+            os << "}" << std::endl;
+            os << "odeTime += odeH;" << std::endl;
+            os << "odeH *= fmax(0.2, fmin(5.0, 0.9 * pow(odeErr, -0.2)));" << std::endl;
+            os << "}" << std::endl;
+
+            // Otherwise, shrink step size, no further than the minimum, and retry
+            os << "else {" << std::endl;
+            os << "odeH = fmax(odeMinH, odeH * fmax(0.1, 0.9 * pow(odeErr, -0.25)));" << std::endl;
+            os << "}" << std::endl;
+        }
+        os << "}" << std::endl;
+    }
+    else {
+        os << "const scalar odeH = DT / " << substeps << ".0;" << std::endl;
+        os << "for(unsigned int odeStep = 0; odeStep < " << substeps << "; odeStep++) {" << std::endl;
+        if(timeDependent) {
+            os << "const scalar odeTime = odeStep * odeH;" << std::endl;
+        }
+
+        if(integrator == ODEIntegrator::ExponentialEuler) {
+            genStages(os, odes, forwardEulerTableau, timeDependent);
+
+            // Calculate each ODE's derivative with respect to its own variable
+            // **NOTE** this finite difference is exact if ODE is linear in its own variable
+            for(const auto &o : odes) {
+                os << "const scalar odeJ_" << o.var << " = ";
+                os << getRHS(o, odes, [&o](const std::string &v){ return (v == o.var) ? ("($(" + v + ") + 1.0)") : ""; },
+                             timeDependent ? "odeTime" : "");
+                os << " - odeK1_" << o.var << ";" << std::endl;
+            }
+
+            // Take exponential Euler step, falling back to forward Euler if derivative is constant
+            for(const auto &o : odes) {
+                os << "$(" << o.var << ") += (odeJ_" << o.var << " == 0.0) ? (odeH * odeK1_" << o.var << ")";
+                os << " : (odeK1_" << o.var << " * expm1(odeJ_" << o.var << " * odeH) / odeJ_" << o.var << ");" << std::endl;
+            }
+        }
+        else {
+            const bool rk4 = (integrator == ODEIntegrator::RK4);
+            genStages(os, odes, rk4 ? rk4Tableau : forwardEulerTableau, timeDependent);
+
+            for(const auto &o : odes) {
+                os << "$(" << o.var << ") += odeH * ";
+                genWeightedSum(os, o.var, rk4 ? std::vector<double>{1.0 / 6.0, 1.0 / 3.0, 1.0 / 3.0, 1.0 / 6.0} : std::vector<double>{1.0});
+                os << ";" << std::endl;
+            }
+        }
+        os << "}" << std::endl;
+    }
+    os << "}" << std::endl;
+    return os.str();
 }
@@ -3,7 +3,10 @@
 // Standard includes
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <iostream>
+#include <numeric>
+#include <set>
 
 // GeNN includes
 #include "gennUtils.h"
@@ -36,6 +39,59 @@ std::vector<double> getConstInitVals(const std::vector<Models::VarInit> &varInit
 
     return initVals;
 }
+//----------------------------------------------------------------------------
+std::set<std::string> getDynamicParamNames(const Snippet::Base *model, const std::vector<bool> &paramDynamic)
+{
+    // Add names of dynamic parameters to set
+    std::set<std::string> names;
+    const auto paramNames = model->getParamNames();
+    for(size_t i = 0; i < paramNames.size(); i++) {
+        if(paramDynamic[i]) {
+            names.insert(paramNames[i]);
+        }
+    }
+
+    // If there are any, all derived parameters are also dynamic
+    if(!names.empty()) {
+        for(const auto &d : model->getDerivedParams()) {
+            names.insert(d.name);
+        }
+    }
+    return names;
+}
+//----------------------------------------------------------------------------
+bool canDynamicParamsBeMerged(const NeuronGroup *a, const NeuronGroup *b)
+{
+    // If neither neuron group has dynamic parameters, they are compatible
+    if(!a->isAnyParamDynamic() && !b->isAnyParamDynamic()) {
+        return true;
+    }
+    // Otherwise, they are only compatible if exactly the same parameters are dynamic
+    else if(a->getParams().size() != b->getParams().size()) {
+        return false;
+    }
+    else {
+        for(size_t i = 0; i < a->getParams().size(); i++) {
+            if(a->isParamDynamic(i) != b->isParamDynamic(i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+//----------------------------------------------------------------------------
+bool canWUVarStorageBeMerged(const SynapseGroup &a, const SynapseGroup &b)
+{
+    // **NOTE** scales are built into generated code so must also match
+    for(size_t i = 0; i < a.getWUModel()->getVars().size(); i++) {
+        if((a.getWUVarStorage(i) != b.getWUVarStorage(i))
+           || (a.getWUVarStorageScale(i) != b.getWUVarStorageScale(i)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
 }   // Anonymous namespace
 
 // ------------------------------------------------------------------------
@@ -51,6 +107,28 @@ void SynapseGroup::setWUVarLocation(const std::string &varName, VarLocation loc)
     }
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setWUVarStorage(const std::string &varName, VarStorage storage, double scale)
+{
+    if(isWeightSharingSlave()) {
+        throw std::runtime_error("setWUVarStorage: Synapse group is a weight sharing slave. Weight update var storage can only be set on the master.");
+    }
+    if(!(getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) && !(getMatrixType() & SynapseMatrixWeight::KERNEL)) {
+        throw std::runtime_error("setWUVarStorage: Only synapse groups with individual or kernel weights have weight update var storage.");
+    }
+
+    const size_t varIndex = getWUModel()->getVarIndex(varName);
+    const std::string &type = getWUModel()->getVars()[varIndex].type;
+    if(storage != VarStorage::NATIVE && type != "scalar" && type != "float" && type != "double") {
+        throw std::runtime_error("setWUVarStorage: Only floating point weight update model variables can be stored in reduced precision.");
+    }
+    if(scale <= 0.0) {
+        throw std::runtime_error("setWUVarStorage: Scale must be positive.");
+    }
+
+    m_WUVarStorage[varIndex] = storage;
+    m_WUVarStorageScale[varIndex] = scale;
+}
+//----------------------------------------------------------------------------
 void SynapseGroup::setWUPreVarLocation(const std::string &varName, VarLocation loc)
 {
     m_WUPreVarLocation[getWUModel()->getPreVarIndex(varName)] = loc;
@@ -84,6 +162,18 @@ void SynapseGroup::setPSExtraGlobalParamLocation(const std::string &paramName, V
     m_PSExtraGlobalParamLocation[extraGlobalParamIndex] = loc;
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setWUParamDynamic(const std::string &paramName, bool dynamic)
+{
+    m_WUParamDynamic[getWUModel()->getParamIndex(paramName)] = dynamic;
+    checkDynamicParamNames();
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::setPSParamDynamic(const std::string &paramName, bool dynamic)
+{
+    m_PSParamDynamic[getPSModel()->getParamIndex(paramName)] = dynamic;
+    checkDynamicParamNames();
+}
+//----------------------------------------------------------------------------
 void SynapseGroup::setSparseConnectivityExtraGlobalParamLocation(const std::string &paramName, VarLocation loc)
 {
     if(isWeightSharingSlave()) {
@@ -114,7 +204,7 @@ void SynapseGroup::setMaxConnections(unsigned int maxConnections)
         throw std::runtime_error("setMaxConnections: Synapse group is a weight sharing slave. Max connections can only be set on the master.");
     }
     else {
-        if(getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+        if((getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (getMatrixType() & SynapseMatrixConnectivity::CSR)) {
             if(m_ConnectivityInitialiser.getSnippet()->getCalcMaxRowLengthFunc()) {
                 throw std::runtime_error("setMaxConnections: Synapse group already has max connections defined by connectivity initialisation snippet.");
             }
@@ -133,7 +223,7 @@ void SynapseGroup::setMaxSourceConnections(unsigned int maxConnections)
         throw std::runtime_error("setMaxSourceConnections: Synapse group is a weight sharing slave. Max source connections can only be set on the master.");
     }
     else {
-        if(getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+        if((getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (getMatrixType() & SynapseMatrixConnectivity::CSR)) {
             if(m_ConnectivityInitialiser.getSnippet()->getCalcMaxColLengthFunc()) {
                 throw std::runtime_error("setMaxSourceConnections: Synapse group already has max source connections defined by connectivity initialisation snippet.");
             }
@@ -185,7 +275,7 @@ void SynapseGroup::setNarrowSparseIndEnabled(bool enabled)
         throw std::runtime_error("setNarrowSparseIndEnabled: Synapse group is a weight sharing slave. Sparse index type can only be set on the master.");
     }
     else {
-        if(getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+        if((getMatrixType() & SynapseMatrixConnectivity::SPARSE) || (getMatrixType() & SynapseMatrixConnectivity::CSR)) {
             m_NarrowSparseIndEnabled = enabled;
         }
         else {
@@ -194,6 +284,61 @@ void SynapseGroup::setNarrowSparseIndEnabled(bool enabled)
     }
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setBitmaskRowWordRangeEnabled(bool enabled)
+{
+    if(isWeightSharingSlave()) {
+        throw std::runtime_error("setBitmaskRowWordRangeEnabled: Synapse group is a weight sharing slave. Bitmask row word ranges can only be enabled on the master.");
+    }
+    else {
+        if(getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+            m_BitmaskRowWordRangeEnabled = enabled;
+        }
+        else {
+            throw std::runtime_error("setBitmaskRowWordRangeEnabled: This function can only be used on synapse groups with bitmask connectivity.");
+        }
+    }
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::setPostsynapticReorderingEnabled(bool enabled)
+{
+    if(isWeightSharingSlave()) {
+        throw std::runtime_error("setPostsynapticReorderingEnabled: Synapse group is a weight sharing slave. Postsynaptic reordering can only be enabled on the master.");
+    }
+    else if(!(getMatrixType() & SynapseMatrixConnectivity::SPARSE)) {
+        throw std::runtime_error("setPostsynapticReorderingEnabled: This function can only be used on synapse groups with sparse connectivity.");
+    }
+    // **NOTE** synapse dynamics can add to inSyn for any synapse so would also require remapping
+    else if(!getWUModel()->getSynapseDynamicsCode().empty()) {
+        throw std::runtime_error("setPostsynapticReorderingEnabled: Postsynaptic reordering cannot be used with continuous synapse dynamics.");
+    }
+    else if(enabled && isCompressedSparseIndEnabled()) {
+        throw std::runtime_error("setPostsynapticReorderingEnabled: Postsynaptic reordering cannot be combined with compressed sparse indices.");
+    }
+    else {
+        m_PostsynapticReorderingEnabled = enabled;
+    }
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::setCompressedSparseIndEnabled(bool enabled)
+{
+    if(isWeightSharingSlave()) {
+        throw std::runtime_error("setCompressedSparseIndEnabled: Synapse group is a weight sharing slave. Compressed sparse indices can only be enabled on the master.");
+    }
+    else if(!(getMatrixType() & SynapseMatrixConnectivity::SPARSE)) {
+        throw std::runtime_error("setCompressedSparseIndEnabled: This function can only be used on synapse groups with sparse connectivity.");
+    }
+    // **NOTE** postsynaptic learning and synapse dynamics access synapses by index so require the padded target indices
+    else if(!getWUModel()->getLearnPostCode().empty() || !getWUModel()->getSynapseDynamicsCode().empty()) {
+        throw std::runtime_error("setCompressedSparseIndEnabled: Compressed sparse indices cannot be used with postsynaptic learning or continuous synapse dynamics.");
+    }
+    else if(enabled && isPostsynapticReorderingEnabled()) {
+        throw std::runtime_error("setCompressedSparseIndEnabled: Compressed sparse indices cannot be combined with postsynaptic reordering.");
+    }
+    else {
+        m_CompressedSparseIndEnabled = enabled;
+    }
+}
+//----------------------------------------------------------------------------
 unsigned int SynapseGroup::getMaxConnections() const
 { 
     // **NOTE** these get retrived from weight sharing master 
@@ -208,6 +353,26 @@ unsigned int SynapseGroup::getMaxSourceConnections() const
     return isWeightSharingSlave() ? getWeightSharingMaster()->getMaxSourceConnections() : m_MaxSourceConnections;
 }
 //----------------------------------------------------------------------------
+size_t SynapseGroup::getKernelSizeFlattened() const
+{
+    return std::accumulate(getKernelSize().cbegin(), getKernelSize().cend(), size_t{1}, std::multiplies<size_t>());
+}
+//----------------------------------------------------------------------------
+bool SynapseGroup::isBitmaskRowWordRangeEnabled() const
+{
+    return isWeightSharingSlave() ? getWeightSharingMaster()->isBitmaskRowWordRangeEnabled() : m_BitmaskRowWordRangeEnabled;
+}
+//----------------------------------------------------------------------------
+bool SynapseGroup::isPostsynapticReorderingEnabled() const
+{
+    return isWeightSharingSlave() ? getWeightSharingMaster()->isPostsynapticReorderingEnabled() : m_PostsynapticReorderingEnabled;
+}
+//----------------------------------------------------------------------------
+bool SynapseGroup::isCompressedSparseIndEnabled() const
+{
+    return isWeightSharingSlave() ? getWeightSharingMaster()->isCompressedSparseIndEnabled() : m_CompressedSparseIndEnabled;
+}
+//----------------------------------------------------------------------------
 VarLocation SynapseGroup::getSparseConnectivityLocation() const
 { 
     return isWeightSharingSlave() ? getWeightSharingMaster()->getSparseConnectivityLocation() : m_SparseConnectivityLocation;
@@ -233,6 +398,16 @@ const std::vector<double> SynapseGroup::getPSConstInitVals() const
     return getConstInitVals(m_PSVarInitialisers);
 }
 //----------------------------------------------------------------------------
+bool SynapseGroup::isAnyWUParamDynamic() const
+{
+    return std::any_of(m_WUParamDynamic.cbegin(), m_WUParamDynamic.cend(), [](bool d) { return d; });
+}
+//----------------------------------------------------------------------------
+bool SynapseGroup::isAnyPSParamDynamic() const
+{
+    return std::any_of(m_PSParamDynamic.cbegin(), m_PSParamDynamic.cend(), [](bool d) { return d; });
+}
+//----------------------------------------------------------------------------
 bool SynapseGroup::isZeroCopyEnabled() const
 {
     // If there are any postsynaptic variables implemented in zero-copy mode return true
@@ -290,6 +465,37 @@ VarLocation SynapseGroup::getWUVarLocation(size_t index) const
     }
 }
 //----------------------------------------------------------------------------
+VarStorage SynapseGroup::getWUVarStorage(size_t index) const
+{
+    // **NOTE** like locations, these get retrived from weight sharing master
+    if(isWeightSharingSlave()) {
+        return getWeightSharingMaster()->getWUVarStorage(index);
+    }
+    else {
+        return m_WUVarStorage.at(index);
+    }
+}
+//----------------------------------------------------------------------------
+double SynapseGroup::getWUVarStorageScale(size_t index) const
+{
+    if(isWeightSharingSlave()) {
+        return getWeightSharingMaster()->getWUVarStorageScale(index);
+    }
+    else {
+        return m_WUVarStorageScale.at(index);
+    }
+}
+//----------------------------------------------------------------------------
+bool SynapseGroup::isWUVarStorageReduced() const
+{
+    for(size_t i = 0; i < getWUModel()->getVars().size(); i++) {
+        if(getWUVarStorage(i) != VarStorage::NATIVE) {
+            return true;
+        }
+    }
+    return false;
+}
+//----------------------------------------------------------------------------
 VarLocation SynapseGroup::getWUPreVarLocation(const std::string &var) const
 {
     return m_WUPreVarLocation[getWUModel()->getPreVarIndex(var)];
@@ -373,8 +579,9 @@ bool SynapseGroup::isWUInitRNGRequired() const
         return true;
     }
 
-    // Return true if matrix has sparse or bitmask connectivity and an RNG is required to initialise connectivity
-    return (((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
+    // Return true if matrix has sparse, CSR or bitmask connectivity and an RNG is required to initialise connectivity
+    return (((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::CSR)
+             || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
             && Utils::isRNGRequired(m_ConnectivityInitialiser.getSnippet()->getRowBuildCode()));
 }
 //----------------------------------------------------------------------------
@@ -397,7 +604,7 @@ bool SynapseGroup::isWUVarInitRequired() const
 {
     // If this synapse group has per-synapse state variables and isn't a 
     // weight sharing slave, return true if any of them have initialisation code
-    if (!isWeightSharingSlave() && (getMatrixType() & SynapseMatrixWeight::INDIVIDUAL)) {
+    if (!isWeightSharingSlave() && ((getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) || (getMatrixType() & SynapseMatrixWeight::KERNEL))) {
         return std::any_of(m_WUVarInitialisers.cbegin(), m_WUVarInitialisers.cend(),
                            [](const Models::VarInit &init){ return !init.getSnippet()->getCode().empty(); });
     }
@@ -408,9 +615,10 @@ bool SynapseGroup::isWUVarInitRequired() const
 //----------------------------------------------------------------------------
 bool SynapseGroup::isSparseConnectivityInitRequired() const
 {
-    // Return true if the matrix type is sparse or bitmask, there is code to  
+    // Return true if the matrix type is sparse, CSR or bitmask, there is code to  
     // initialise sparse connectivity and synapse group isn't a weight sharing slave,
-    return (((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
+    return (((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::CSR)
+             || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
             && !getConnectivityInitialiser().getSnippet()->getRowBuildCode().empty() && !isWeightSharingSlave());
 }
 //----------------------------------------------------------------------------
@@ -423,11 +631,12 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
                            VarLocation defaultSparseConnectivityLocation, bool defaultNarrowSparseIndEnabled)
     :   m_Name(name), m_SpanType(SpanType::POSTSYNAPTIC), m_NumThreadsPerSpike(1), m_DelaySteps(delaySteps), m_BackPropDelaySteps(0),
         m_MaxDendriticDelayTimesteps(1), m_MatrixType(matrixType),  m_SrcNeuronGroup(srcNeuronGroup), m_TrgNeuronGroup(trgNeuronGroup), m_WeightSharingMaster(weightSharingMaster),
-        m_EventThresholdReTestRequired(false), m_NarrowSparseIndEnabled(defaultNarrowSparseIndEnabled),
+        m_EventThresholdConditionMaskRequired(false), m_EventThresholdConditionBit(0), m_NarrowSparseIndEnabled(defaultNarrowSparseIndEnabled), m_SparseDendriticDelayEnabled(false), m_BitmaskRowWordRangeEnabled(false), m_PostsynapticReorderingEnabled(false), m_CompressedSparseIndEnabled(false),
         m_InSynLocation(defaultVarLocation),  m_DendriticDelayLocation(defaultVarLocation),
-        m_WUModel(wu), m_WUParams(wuParams), m_WUVarInitialisers(wuVarInitialisers), m_WUPreVarInitialisers(wuPreVarInitialisers), m_WUPostVarInitialisers(wuPostVarInitialisers),
-        m_PSModel(ps), m_PSParams(psParams), m_PSVarInitialisers(psVarInitialisers),
-        m_WUVarLocation(wuVarInitialisers.size(), defaultVarLocation), m_WUPreVarLocation(wuPreVarInitialisers.size(), defaultVarLocation),
+        m_WUModel(wu), m_WUParams(wuParams), m_WUParamDynamic(wuParams.size(), false), m_WUVarInitialisers(wuVarInitialisers), m_WUPreVarInitialisers(wuPreVarInitialisers), m_WUPostVarInitialisers(wuPostVarInitialisers),
+        m_PSModel(ps), m_PSParams(psParams), m_PSParamDynamic(psParams.size(), false), m_PSVarInitialisers(psVarInitialisers),
+        m_WUVarLocation(wuVarInitialisers.size(), defaultVarLocation), m_WUVarStorage(wuVarInitialisers.size(), VarStorage::NATIVE),
+        m_WUVarStorageScale(wuVarInitialisers.size(), 1.0), m_WUPreVarLocation(wuPreVarInitialisers.size(), defaultVarLocation),
         m_WUPostVarLocation(wuPostVarInitialisers.size(), defaultVarLocation), m_WUExtraGlobalParamLocation(wu->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation),
         m_PSVarLocation(psVarInitialisers.size(), defaultVarLocation), m_PSExtraGlobalParamLocation(ps->getExtraGlobalParams().size(), defaultExtraGlobalParamLocation),
         m_ConnectivityInitialiser(connectivityInitialiser), m_SparseConnectivityLocation(defaultSparseConnectivityLocation),
@@ -451,6 +660,12 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
             throw std::runtime_error("Procedural connectivity cannot be used for synapse groups with continuous synapse dynamics");
         }
     }
+    // Otherwise, if connectivity is CSR, give an error if there's no row build code as arrays are sized by building it
+    else if(m_MatrixType & SynapseMatrixConnectivity::CSR) {
+        if(m_ConnectivityInitialiser.getSnippet()->getRowBuildCode().empty()) {
+            throw std::runtime_error("Cannot use CSR connectivity without specifying connectivity initialisation snippet");
+        }
+    }
     // Otherwise, if WEIGHTS are procedural e.g. in the case of DENSE_PROCEDURALG, give error if RNG is required for weights
     else if(m_MatrixType & SynapseMatrixWeight::PROCEDURAL) {
         if(::Utils::isRNGRequired(m_WUVarInitialisers)) {
@@ -458,10 +673,21 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
         }
     }
 
+    // If connectivity initialisation snippet defines a kernel, calculate its size
+    auto calcKernelSizeFunc = m_ConnectivityInitialiser.getSnippet()->getCalcKernelSizeFunc();
+    if(calcKernelSizeFunc) {
+        m_KernelSize = calcKernelSizeFunc(m_ConnectivityInitialiser.getParams());
+    }
+
+    // If weights are stored in a kernel, check connectivity initialisation snippet defines one
+    if((m_MatrixType & SynapseMatrixWeight::KERNEL) && m_KernelSize.empty()) {
+        throw std::runtime_error("Kernel weights can only be used with connectivity initialisation snippets which define a kernel size");
+    }
+
     // If connectivitity initialisation snippet provides a function to calculate row length, call it
-    // **NOTE** only do this for sparse connectivity as this should not be set for bitmasks
+    // **NOTE** only do this for sparse and CSR connectivity as this should not be set for bitmasks
     auto calcMaxRowLengthFunc = m_ConnectivityInitialiser.getSnippet()->getCalcMaxRowLengthFunc();
-    if(calcMaxRowLengthFunc && (m_MatrixType & SynapseMatrixConnectivity::SPARSE)) {
+    if(calcMaxRowLengthFunc && ((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::CSR))) {
         m_MaxConnections = calcMaxRowLengthFunc(srcNeuronGroup->getNumNeurons(), trgNeuronGroup->getNumNeurons(),
                                                 m_ConnectivityInitialiser.getParams());
     }
@@ -471,9 +697,9 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
     }
 
     // If connectivitity initialisation snippet provides a function to calculate row length, call it
-    // **NOTE** only do this for sparse connectivity as this should not be set for bitmasks
+    // **NOTE** only do this for sparse and CSR connectivity as this should not be set for bitmasks
     auto calcMaxColLengthFunc = m_ConnectivityInitialiser.getSnippet()->getCalcMaxColLengthFunc();
-    if(calcMaxColLengthFunc && (m_MatrixType & SynapseMatrixConnectivity::SPARSE)) {
+    if(calcMaxColLengthFunc && ((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::CSR))) {
         m_MaxSourceConnections = calcMaxColLengthFunc(srcNeuronGroup->getNumNeurons(), trgNeuronGroup->getNumNeurons(),
                                                       m_ConnectivityInitialiser.getParams());
     }
@@ -553,16 +779,26 @@ bool SynapseGroup::canWUBeMerged(const SynapseGroup &other) const
 {
     if(getWUModel()->canBeMerged(other.getWUModel())
        && (getDelaySteps() == other.getDelaySteps())
+       && (getKernelSize() == other.getKernelSize())
        && (getBackPropDelaySteps() == other.getBackPropDelaySteps())
        && (getMaxDendriticDelayTimesteps() == other.getMaxDendriticDelayTimesteps())
+       && (isSparseDendriticDelayEnabled() == other.isSparseDendriticDelayEnabled())
+       && (isBitmaskRowWordRangeEnabled() == other.isBitmaskRowWordRangeEnabled())
+       && (isPostsynapticReorderingEnabled() == other.isPostsynapticReorderingEnabled())
+       && (isCompressedSparseIndEnabled() == other.isCompressedSparseIndEnabled())
        && (getSparseIndType() == other.getSparseIndType())
        && (getNumThreadsPerSpike() == other.getNumThreadsPerSpike())
-       && (isEventThresholdReTestRequired() == other.isEventThresholdReTestRequired())
+       && (isEventThresholdConditionMaskRequired() == other.isEventThresholdConditionMaskRequired())
        && (getSpanType() == other.getSpanType())
        && (isPSModelMerged() == other.isPSModelMerged())
        && (getSrcNeuronGroup()->getNumDelaySlots() == other.getSrcNeuronGroup()->getNumDelaySlots())
+       && (getSrcNeuronGroup()->isRemote() == other.getSrcNeuronGroup()->isRemote())
        && (getTrgNeuronGroup()->getNumDelaySlots() == other.getTrgNeuronGroup()->getNumDelaySlots())
-       && (getMatrixType() == other.getMatrixType()))
+       && (getMatrixType() == other.getMatrixType())
+       && (m_WUParamDynamic == other.m_WUParamDynamic)
+       && canWUVarStorageBeMerged(*this, other)
+       && canDynamicParamsBeMerged(getSrcNeuronGroup(), other.getSrcNeuronGroup())
+       && canDynamicParamsBeMerged(getTrgNeuronGroup(), other.getTrgNeuronGroup()))
     {
         // If connectivity is either non-procedural or connectivity initialisers can be merged
         if(!(getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL)
@@ -580,7 +816,8 @@ bool SynapseGroup::canWUPreBeMerged(const SynapseGroup &other) const
     const bool delayed = (getDelaySteps() != 0);
     const bool otherDelayed = (other.getDelaySteps() != 0);
     return (getWUModel()->canBeMerged(other.getWUModel())
-            && (delayed == otherDelayed));
+            && (delayed == otherDelayed)
+            && (m_WUParamDynamic == other.m_WUParamDynamic));
 }
 //----------------------------------------------------------------------------
 bool SynapseGroup::canWUPostBeMerged(const SynapseGroup &other) const
@@ -588,7 +825,8 @@ bool SynapseGroup::canWUPostBeMerged(const SynapseGroup &other) const
     const bool delayed = (getDelaySteps() != 0);
     const bool otherDelayed = (other.getDelaySteps() != 0);
     return (getWUModel()->canBeMerged(other.getWUModel())
-            && (delayed == otherDelayed));
+            && (delayed == otherDelayed)
+            && (m_WUParamDynamic == other.m_WUParamDynamic));
 }
 //----------------------------------------------------------------------------
 bool SynapseGroup::canPSBeMerged(const SynapseGroup &other) const
@@ -597,7 +835,10 @@ bool SynapseGroup::canPSBeMerged(const SynapseGroup &other) const
     const bool otherIndividualPSM = (other.getMatrixType() & SynapseMatrixWeight::INDIVIDUAL_PSM);
     if(getPSModel()->canBeMerged(other.getPSModel())
        && (getMaxDendriticDelayTimesteps() == other.getMaxDendriticDelayTimesteps())
-       && (individualPSM == otherIndividualPSM))
+       && (isSparseDendriticDelayEnabled() == other.isSparseDendriticDelayEnabled())
+       && (individualPSM == otherIndividualPSM)
+       && (isPostsynapticReorderingEnabled() == other.isPostsynapticReorderingEnabled())
+       && (m_PSParamDynamic == other.m_PSParamDynamic))
     {
         return true;
     }
@@ -611,8 +852,11 @@ bool SynapseGroup::canPSBeLinearlyCombined(const SynapseGroup &other) const
     // they DON'T have individual postsynaptic model variables or they have no variable at all
     // **NOTE** many models with variables would work fine, but nothing stops
     // initialisers being used to configure PS models to behave totally different
-    // **NOTE** similarly with EGPs
+    // **NOTE** similarly with EGPs and dynamic parameters which can be changed independently
+    // **NOTE** reordered groups each accumulate input in their own order so can't share inSyn
     return (canPSBeMerged(other)
+            && !isPostsynapticReorderingEnabled() && !other.isPostsynapticReorderingEnabled()
+            && !isAnyPSParamDynamic() && !other.isAnyPSParamDynamic()
             && (getPSParams() == other.getPSParams())
             && (getPSDerivedParams() == other.getPSDerivedParams())
             && getPSModel()->getExtraGlobalParams().empty()
@@ -623,7 +867,9 @@ bool SynapseGroup::canWUInitBeMerged(const SynapseGroup &other) const
 {
     if((getMatrixType() == other.getMatrixType())
        && (getSparseIndType() == other.getSparseIndType())
-       && (getWUModel()->getVars() == other.getWUModel()->getVars()))
+       && (getKernelSize() == other.getKernelSize())
+       && (getWUModel()->getVars() == other.getWUModel()->getVars())
+       && canWUVarStorageBeMerged(*this, other))
     {
         // if any of the variable's initialisers can't be merged, return false
         for(size_t i = 0; i < getWUVarInitialisers().size(); i++) {
@@ -670,7 +916,8 @@ bool SynapseGroup::canWUPostInitBeMerged(const SynapseGroup &other) const
 bool SynapseGroup::canPSInitBeMerged(const SynapseGroup &other) const
 {
     if((getPSModel()->getVars() == other.getPSModel()->getVars())
-       && (getMaxDendriticDelayTimesteps() == other.getMaxDendriticDelayTimesteps()))
+       && (getMaxDendriticDelayTimesteps() == other.getMaxDendriticDelayTimesteps())
+       && (isSparseDendriticDelayEnabled() == other.isSparseDendriticDelayEnabled()))
     {
         // if any of the variable's initialisers can't be merged, return false
         for(size_t i = 0; i < getPSVarInitialisers().size(); i++) {
@@ -697,4 +944,17 @@ bool SynapseGroup::canConnectivityHostInitBeMerged(const SynapseGroup &other) co
 {
     // Connectivity host initialization can be merged if the initialisers 
     return getConnectivityInitialiser().canBeMerged(other.getConnectivityInitialiser());
-}
\ No newline at end of file
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::checkDynamicParamNames() const
+{
+    // Dynamic parameters are set using functions named after the synapse group and parameter
+    // so weight update and postsynaptic model parameters with the same name cannot both be dynamic
+    const auto wuDynamicParamNames = getDynamicParamNames(getWUModel(), m_WUParamDynamic);
+    const auto psDynamicParamNames = getDynamicParamNames(getPSModel(), m_PSParamDynamic);
+    for(const auto &p : wuDynamicParamNames) {
+        if(psDynamicParamNames.find(p) != psDynamicParamNames.cend()) {
+            throw std::runtime_error("Synapse group '" + getName() + "' has dynamic weight update and postsynaptic model parameters both named '" + p + "'");
+        }
+    }
+}
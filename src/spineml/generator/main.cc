@@ -232,12 +232,14 @@ int main(int argc, char *argv[])
         std::string experimentFilename;
         std::string outputDirectory;
         bool timing = false;
+        bool perfCounters = false;
         unsigned int logLevel = plog::info;
         unsigned int gennLogLevel = plog::warning;
 
         app.add_option("experiment,-e,--experiment", experimentFilename, "Experiment xml file")->required();
         app.add_option("output,-o,--output", outputDirectory, "Output directory for generated code");
         app.add_flag("-t,--timing", timing, "Generate GeNN timing code, allowing more fine-grained profiling");
+        app.add_flag("-c,--perf-counters", perfCounters, "Generate code to record hardware performance counters around each phase of the simulation");
         app.add_flag("--log-error{2},--log-warning{3},--log-info{4},--log-debug{5}", logLevel, "Verbosity of SpineML logging to show");
         app.add_flag("--genn-log-error{2},--genn-log-warning{3},--genn-log-info{4},--genn-log-debug{5}", gennLogLevel, "Verbosity of GeNN logging to show");
 
@@ -368,6 +370,7 @@ int main(int argc, char *argv[])
         model.setDT(dt);
         model.setName(networkName);
         model.setTiming(timing);
+        model.setPerfCounters(perfCounters);
 
         // Loop through populations once to build neuron populations
         for(auto population : spineML.children("LL:Population")) {
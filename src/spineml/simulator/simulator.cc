@@ -419,6 +419,36 @@ double Simulator::getInitSparseTime() const
     return *(double*)getLibrarySymbol("initSparseTime");
 }
 //----------------------------------------------------------------------------
+Simulator::PerfCounters Simulator::getNeuronUpdatePerfCounters() const
+{
+    return getPerfCounters("neuronUpdatePerfCounters");
+}
+//----------------------------------------------------------------------------
+Simulator::PerfCounters Simulator::getInitPerfCounters() const
+{
+    return getPerfCounters("initPerfCounters");
+}
+//----------------------------------------------------------------------------
+Simulator::PerfCounters Simulator::getPresynapticUpdatePerfCounters() const
+{
+    return getPerfCounters("presynapticUpdatePerfCounters");
+}
+//----------------------------------------------------------------------------
+Simulator::PerfCounters Simulator::getPostsynapticUpdatePerfCounters() const
+{
+    return getPerfCounters("postsynapticUpdatePerfCounters");
+}
+//----------------------------------------------------------------------------
+Simulator::PerfCounters Simulator::getSynapseDynamicsPerfCounters() const
+{
+    return getPerfCounters("synapseDynamicsPerfCounters");
+}
+//----------------------------------------------------------------------------
+Simulator::PerfCounters Simulator::getInitSparsePerfCounters() const
+{
+    return getPerfCounters("initSparsePerfCounters");
+}
+//----------------------------------------------------------------------------
 void *Simulator::getLibrarySymbol(const char *name, bool allowMissing) const
 {
 #ifdef _WIN32
@@ -435,6 +465,13 @@ void *Simulator::getLibrarySymbol(const char *name, bool allowMissing) const
     return symbol;
 }
 //----------------------------------------------------------------------------
+Simulator::PerfCounters Simulator::getPerfCounters(const char *name) const
+{
+    // Counters are stored as cycles, instructions, LLC misses and branch misses
+    const unsigned long long *counters = (unsigned long long*)getLibrarySymbol(name);
+    return {counters[0], counters[1], counters[2], counters[3]};
+}
+//----------------------------------------------------------------------------
 Simulator::NeuronPopSpikeVars Simulator::getNeuronPopSpikeVars(const std::string &popName) const
 {
     // Get pointers to spike counts in model library
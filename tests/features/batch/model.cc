@@ -0,0 +1,80 @@
+//--------------------------------------------------------------------------
+/*! \file batch/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// PreNeuron
+//----------------------------------------------------------------------------
+class PreNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PreNeuron, 0, 2);
+
+    SET_SIM_CODE("$(timestep) += 1.0;\n");
+
+    // Neurons with fire > 0.5 spike in first timestep only
+    SET_THRESHOLD_CONDITION_CODE("$(fire) > 0.5 && $(timestep) > 0.5 && $(timestep) < 1.5");
+
+    SET_VARS({{"fire", "scalar"}, {"timestep", "scalar"}});
+};
+
+IMPLEMENT_MODEL(PreNeuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 0, 1);
+
+    SET_SIM_CODE("$(input) = $(Isyn);\n");
+
+    SET_THRESHOLD_CONDITION_CODE("$(input) > 0.0");
+
+    SET_VARS({{"input", "scalar"}});
+};
+
+IMPLEMENT_MODEL(PostNeuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_MODEL(WeightUpdateModel, 0, 1);
+
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SIM_CODE("$(addToInSyn, 1.0);\n");
+    SET_LEARN_POST_CODE("$(g) += 1.0;\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("batch");
+    model.setBatchSize(4);
+
+    InitVarSnippet::Uniform::ParamValues fireInit(0.0, 1.0);
+    model.addNeuronPopulation<PreNeuron>("Pre", 100, {}, PreNeuron::VarValues(initVar<InitVarSnippet::Uniform>(fireInit), 0.0));
+    model.addNeuronPopulation<PostNeuron>("Post", 100, {}, PostNeuron::VarValues(0.0));
+
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModel::VarValues(1.0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({0.05}));
+
+    model.setPrecision(GENN_FLOAT);
+}
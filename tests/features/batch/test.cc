@@ -0,0 +1,74 @@
+//--------------------------------------------------------------------------
+/*! \file batch/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "batch_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, Batch)
+{
+    const unsigned int batchSize = 4;
+    const unsigned int numNeurons = 100;
+
+    // Check that each instance has been initialised with different random state
+    pullPreStateFromDevice();
+    for(unsigned int b = 1; b < batchSize; b++) {
+        EXPECT_FALSE(std::equal(&firePre[0], &firePre[numNeurons], &firePre[b * numNeurons]));
+    }
+
+    // Simulate until spikes emitted by presynaptic neurons in first timestep have been delivered
+    StepGeNN();
+    StepGeNN();
+
+    // Check each instance's postsynaptic input matches number of
+    // presynaptic neurons connected to it which fired in that instance
+    pullSynConnectivityFromDevice();
+    for(unsigned int b = 0; b < batchSize; b++) {
+        std::vector<float> expectedInput(numNeurons, 0.0f);
+        for(unsigned int i = 0; i < numNeurons; i++) {
+            if(firePre[(b * numNeurons) + i] > 0.5f) {
+                for(unsigned int s = 0; s < rowLengthSyn[i]; s++) {
+                    expectedInput[indSyn[(i * maxRowLengthSyn) + s]] += 1.0f;
+                }
+            }
+        }
+        EXPECT_TRUE(std::equal(expectedInput.cbegin(), expectedInput.cend(), &inputPost[b * numNeurons]));
+    }
+
+    // Simulate until postsynaptic spikes emitted in second timestep have been learnt from
+    const std::vector<float> input(&inputPost[0], &inputPost[batchSize * numNeurons]);
+    StepGeNN();
+
+    // Check each instance's weights have been updated for postsynaptic neurons which spiked in that instance
+    for(unsigned int b = 0; b < batchSize; b++) {
+        const float *g = &gSyn[b * numNeurons * maxRowLengthSyn];
+        for(unsigned int i = 0; i < numNeurons; i++) {
+            for(unsigned int s = 0; s < rowLengthSyn[i]; s++) {
+                const unsigned int j = indSyn[(i * maxRowLengthSyn) + s];
+                const float expectedG = (input[(b * numNeurons) + j] > 0.0f) ? 2.0f : 1.0f;
+                EXPECT_EQ(g[(i * maxRowLengthSyn) + s], expectedG);
+            }
+        }
+    }
+}
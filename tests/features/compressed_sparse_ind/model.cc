@@ -0,0 +1,100 @@
+//--------------------------------------------------------------------------
+/*! \file compressed_sparse_ind/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+//! Neuron which spikes every timestep
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// Spread
+//----------------------------------------------------------------------------
+//! Connect each presynaptic neuron to targets spaced so differences require one, two and three byte encodings
+class Spread : public InitSparseConnectivitySnippet::Base
+{
+public:
+    DECLARE_SNIPPET(Spread, 0);
+
+    SET_ROW_BUILD_CODE(
+        "if(j == 0) {\n"
+        "   $(addSynapse, $(id_pre));\n"
+        "}\n"
+        "else if(j == 1) {\n"
+        "   $(addSynapse, $(id_pre) + 1000);\n"
+        "}\n"
+        "else if(j == 2) {\n"
+        "   $(addSynapse, $(id_pre) + 19000);\n"
+        "}\n"
+        "else {\n"
+        "   $(endRow);\n"
+        "}\n"
+        "j++;\n");
+    SET_ROW_BUILD_STATE_VARS({{"j", "unsigned int", 0}});
+
+    SET_CALC_MAX_ROW_LENGTH_FUNC([](unsigned int, unsigned int, const std::vector<double> &){ return 3; });
+};
+IMPLEMENT_SNIPPET(Spread);
+
+//----------------------------------------------------------------------------
+// PreIndex
+//----------------------------------------------------------------------------
+//! Initialise each weight to one more than the index of the presynaptic neuron
+class PreIndex : public InitVarSnippet::Base
+{
+public:
+    DECLARE_SNIPPET(PreIndex, 0);
+
+    SET_CODE("$(value) = (scalar)($(id_pre) + 1);");
+};
+IMPLEMENT_SNIPPET(PreIndex);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("compressed_sparse_ind");
+
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(initVar<PreIndex>());
+
+    model.addNeuronPopulation<Pre>("Pre", 10, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 20000, {}, Neuron::VarValues(0.0));
+
+    auto *syn = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<Spread>());
+    syn->setCompressedSparseIndEnabled(true);
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,60 @@
+//--------------------------------------------------------------------------
+/*! \file compressed_sparse_ind/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "compressed_sparse_ind_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, CompressedSparseInd)
+{
+    // Check padded target indices have been freed
+    ASSERT_EQ(indSyn, nullptr);
+
+    // Each row's differences of id_pre, 1000 and 18000 should take 1, 2 and 3 bytes
+    for(unsigned int i = 0; i <= 10; i++) {
+        ASSERT_EQ(rowOffsetSyn[i], i * 6);
+    }
+
+    // Checkpoint connectivity, overwrite encoded rows and check they are restored when reloaded
+    saveState("compressed_sparse_ind.bin");
+    std::fill_n(indCompressedSyn, 60, 0);
+    std::fill_n(rowOffsetSyn, 11, 0);
+    loadState("compressed_sparse_ind.bin");
+    for(unsigned int i = 0; i <= 10; i++) {
+        ASSERT_EQ(rowOffsetSyn[i], i * 6);
+    }
+    ASSERT_EQ(indCompressedSyn[0], 0);
+
+    // Simulate first timestep in which presynaptic neurons spike
+    StepGeNN();
+
+    // Simulate second timestep in which spikes are delivered
+    StepGeNN();
+
+    // Check each target received the weight of its presynaptic neuron
+    for(unsigned int j = 0; j < 20000; j++) {
+        const bool targetted = (j < 10) || (j >= 1000 && j < 1010) || (j >= 19000 && j < 19010);
+        const float expected = targetted ? (float)((j % 1000) + 1) : 0.0f;
+        ASSERT_EQ(xPost[j], expected);
+    }
+}
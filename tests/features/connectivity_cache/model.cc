@@ -0,0 +1,29 @@
+//--------------------------------------------------------------------------
+/*! \file connectivity_cache/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("connectivity_cache");
+    model.setSeed(1234);
+    model.setConnectivityCacheDirectory(".");
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 1000, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Post", 1000, {}, {});
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(1.0),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({0.1}));
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,73 @@
+//--------------------------------------------------------------------------
+/*! \file connectivity_cache/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "connectivity_cache_CODE/definitions.h"
+#include "connectivity_cache_CODE/definitionsInternal.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+std::vector<unsigned int> getConnectivity()
+{
+    pullSynConnectivityFromDevice();
+    std::vector<unsigned int> ind;
+    for(unsigned int i = 0; i < 1000; i++) {
+        ind.push_back(rowLengthSyn[i]);
+        ind.insert(ind.end(), &indSyn[i * maxRowLengthSyn], &indSyn[(i * maxRowLengthSyn) + rowLengthSyn[i]]);
+    }
+    return ind;
+}
+}   // Anonymous namespace
+
+TEST_F(SimTest, ConnectivityCache)
+{
+    // Copy connectivity built (or loaded from cache) during initialisation
+    const std::vector<unsigned int> ind = getConnectivity();
+
+    // Check connectivity is plausible
+    const unsigned int numSynapses = (unsigned int)(ind.size() - 1000);
+    EXPECT_GT(numSynapses, 90000);
+    EXPECT_LT(numSynapses, 110000);
+
+    // Re-allocate so RNG is re-seeded and in the same state as when connectivity was built
+    freeMem();
+    allocateMem();
+
+    // Check connectivity can be loaded from cache and is identical
+    std::fill_n(rowLengthSyn, 1000, 0);
+    pushSynConnectivityToDevice();
+    EXPECT_TRUE(loadCachedConnectivitySyn());
+    EXPECT_EQ(ind, getConnectivity());
+
+    // RNG has now advanced past building connectivity so cache should be
+    // rejected and different connectivity built from the new RNG state
+    EXPECT_FALSE(loadCachedConnectivitySyn());
+    initialize();
+    initializeSparse();
+    EXPECT_NE(ind, getConnectivity());
+}
@@ -0,0 +1,97 @@
+//--------------------------------------------------------------------------
+/*! \file conv2d_conn_gen_kernelg_procedural/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+//! Neuron which spikes once, in the timestep matching its index
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("$(id) == (unsigned int)rint($(t) / DT)");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// KernelIndex
+//----------------------------------------------------------------------------
+//! Initialise each kernel element to a unique value derived from its index
+class KernelIndex : public InitVarSnippet::Base
+{
+public:
+    DECLARE_SNIPPET(KernelIndex, 0);
+
+    SET_CODE("$(value) = 1.0 + (scalar)$(id_kernel);");
+};
+IMPLEMENT_SNIPPET(KernelIndex);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("conv2d_conn_gen_kernelg_procedural");
+
+    // 3x3 convolution with stride 2 and a padding of 1 from a 5x5x2 input to a 3x3x3 output
+    InitSparseConnectivitySnippet::Conv2D::ParamValues convParams(
+        3, 3,       // conv_kh, conv_kw
+        2, 2,       // conv_sh, conv_sw
+        1, 1,       // conv_padh, conv_padw
+        5, 5, 2,    // conv_ih, conv_iw, conv_ic
+        3, 3, 3);   // conv_oh, conv_ow, conv_oc
+
+    // Static synapse parameters
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(initVar<KernelIndex>());
+
+    model.addNeuronPopulation<Pre>("Pre", 5 * 5 * 2, {}, {});
+    model.addNeuronPopulation<Neuron>("Post", 3 * 3 * 3, {}, Neuron::VarValues(0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::PROCEDURAL_KERNELG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::Conv2D>(convParams));
+
+    // 3x2 convolution with a stride of 1x2 and a padding of 1x0 from a 4x6x2 input to a 4x3x2 output
+    // **NOTE** every dimension differs between rows and columns so transposing any of them changes the result
+    InitSparseConnectivitySnippet::Conv2D::ParamValues convRectParams(
+        3, 2,       // conv_kh, conv_kw
+        1, 2,       // conv_sh, conv_sw
+        1, 0,       // conv_padh, conv_padw
+        4, 6, 2,    // conv_ih, conv_iw, conv_ic
+        4, 3, 2);   // conv_oh, conv_ow, conv_oc
+
+    model.addNeuronPopulation<Pre>("PreRect", 4 * 6 * 2, {}, {});
+    model.addNeuronPopulation<Neuron>("PostRect", 4 * 3 * 2, {}, Neuron::VarValues(0.0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynRect", SynapseMatrixType::PROCEDURAL_KERNELG, NO_DELAY, "PreRect", "PostRect",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::Conv2D>(convRectParams));
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,117 @@
+//--------------------------------------------------------------------------
+/*! \file conv2d_conn_gen_kernelg_procedural/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "conv2d_conn_gen_kernelg_procedural_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// Conv2DGeometry
+//----------------------------------------------------------------------------
+struct Conv2DGeometry
+{
+    int kernelHeight;
+    int kernelWidth;
+    int strideHeight;
+    int strideWidth;
+    int padHeight;
+    int padWidth;
+    int inHeight;
+    int inWidth;
+    int inChannels;
+    int outHeight;
+    int outWidth;
+    int outChannels;
+
+    int getNumPre() const{ return inHeight * inWidth * inChannels; }
+    int getNumPost() const{ return outHeight * outWidth * outChannels; }
+    int getKernelSize() const{ return kernelHeight * kernelWidth * inChannels * outChannels; }
+};
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+protected:
+    //--------------------------------------------------------------------------
+    // Protected methods
+    //--------------------------------------------------------------------------
+    //! Check input to postsynaptic population matches convolving the kernel with a spike from presynaptic neuron i
+    void checkConvolution(const Conv2DGeometry &geom, int i, const float *kernel, const float *x) const
+    {
+        // Calculate expected input to each postsynaptic neuron by convolving
+        // **NOTE** if i isn't a valid presynaptic neuron, no spike should have been delivered
+        std::vector<float> expected(geom.getNumPost(), 0.0f);
+        if(i < geom.getNumPre()) {
+            const int inRow = (i / geom.inChannels) / geom.inWidth;
+            const int inCol = (i / geom.inChannels) % geom.inWidth;
+            const int inChan = i % geom.inChannels;
+            for(int outRow = 0; outRow < geom.outHeight; outRow++) {
+                const int kernRow = inRow + geom.padHeight - (outRow * geom.strideHeight);
+                if(kernRow < 0 || kernRow >= geom.kernelHeight) {
+                    continue;
+                }
+                for(int outCol = 0; outCol < geom.outWidth; outCol++) {
+                    const int kernCol = inCol + geom.padWidth - (outCol * geom.strideWidth);
+                    if(kernCol < 0 || kernCol >= geom.kernelWidth) {
+                        continue;
+                    }
+                    for(int outChan = 0; outChan < geom.outChannels; outChan++) {
+                        const int kernInd = (((kernRow * geom.kernelWidth) + kernCol) * geom.inChannels + inChan) * geom.outChannels + outChan;
+                        expected[(((outRow * geom.outWidth) + outCol) * geom.outChannels) + outChan] = kernel[kernInd];
+                    }
+                }
+            }
+        }
+
+        // Check input matches
+        for(int j = 0; j < geom.getNumPost(); j++) {
+            ASSERT_EQ(x[j], expected[j]) << "presynaptic neuron " << i << ", postsynaptic neuron " << j;
+        }
+    }
+};
+
+TEST_F(SimTest, Conv2DConnGenKernelgProcedural)
+{
+    // 3x3 convolution with stride 2 and a padding of 1 from a 5x5x2 input to a 3x3x3 output
+    const Conv2DGeometry square{3, 3, 2, 2, 1, 1, 5, 5, 2, 3, 3, 3};
+
+    // 3x2 convolution with a stride of 1x2 and a padding of 1x0 from a 4x6x2 input to a 4x3x2 output
+    const Conv2DGeometry rect{3, 2, 1, 2, 1, 0, 4, 6, 2, 4, 3, 2};
+
+    // Check kernels have been initialised
+    for(int k = 0; k < square.getKernelSize(); k++) {
+        ASSERT_EQ(gSyn[k], 1.0f + (float)k);
+    }
+    for(int k = 0; k < rect.getKernelSize(); k++) {
+        ASSERT_EQ(gSynRect[k], 1.0f + (float)k);
+    }
+
+    // Simulate first timestep in which first presynaptic neurons spike
+    StepGeNN();
+
+    // Loop through presynaptic neurons, each of which spikes in turn
+    const int numPre = std::max(square.getNumPre(), rect.getNumPre());
+    for(int i = 0; i < numPre; i++) {
+        // Simulate timestep in which spikes are delivered
+        StepGeNN();
+
+        checkConvolution(square, i, gSyn, xPost);
+        checkConvolution(rect, i, gSynRect, xPostRect);
+    }
+}
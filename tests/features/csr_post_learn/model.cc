@@ -0,0 +1,64 @@
+//--------------------------------------------------------------------------
+/*! \file csr_post_learn/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Post
+//----------------------------------------------------------------------------
+//! Neuron which spikes every timestep
+class Post : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Post, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+IMPLEMENT_MODEL(Post);
+
+//----------------------------------------------------------------------------
+// PostLearn
+//----------------------------------------------------------------------------
+//! Weight update model which counts postsynaptic spikes and records the indices it was called with
+class PostLearn : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(PostLearn, 0, 3, 0, 0);
+
+    SET_VARS({{"g", "scalar"}, {"preInd", "unsigned int"}, {"postInd", "unsigned int"}});
+
+    SET_LEARN_POST_CODE(
+        "$(g) += 1.0;\n"
+        "$(preInd) = $(id_pre);\n"
+        "$(postInd) = $(id_post);\n");
+};
+IMPLEMENT_MODEL(PostLearn);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("csr_post_learn");
+    model.setSeed(1234);
+
+    PostLearn::VarValues postLearnInit(0.0, 0, 0);
+    InitSparseConnectivitySnippet::FixedProbability::ParamValues fixedProbParams(0.1);
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 100, {}, {});
+    model.addNeuronPopulation<Post>("Post", 100, {}, {});
+
+    // **NOTE** connectivity uses the RNG so the count and fill passes must generate identical rows
+    model.addSynapsePopulation<PostLearn, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::CSR_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, postLearnInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+
+    model.setPrecision(GENN_FLOAT);
+}
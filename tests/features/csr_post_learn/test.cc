@@ -0,0 +1,69 @@
+//--------------------------------------------------------------------------
+/*! \file csr_post_learn/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "csr_post_learn_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, CSRPostLearn)
+{
+    // Check row pointers are monotonic and enclose a plausible number of synapses
+    const unsigned int numSynapses = rowPtrSyn[100];
+    ASSERT_EQ(rowPtrSyn[0], 0);
+    ASSERT_GT(numSynapses, 500);
+    ASSERT_LT(numSynapses, 1500);
+    for(unsigned int i = 0; i < 100; i++) {
+        ASSERT_LE(rowPtrSyn[i], rowPtrSyn[i + 1]);
+
+        // Check each row, filled in second pass, is ascending as generated in first pass
+        for(unsigned int s = rowPtrSyn[i]; s < rowPtrSyn[i + 1]; s++) {
+            ASSERT_LT(indSyn[s], 100);
+            if(s > rowPtrSyn[i]) {
+                ASSERT_GT(indSyn[s], indSyn[s - 1]);
+            }
+        }
+    }
+
+    // Simulate and checkpoint
+    for(unsigned int t = 0; t < 5; t++) {
+        StepGeNN();
+    }
+    saveState("csr_post_learn.bin");
+    for(unsigned int t = 0; t < 5; t++) {
+        StepGeNN();
+    }
+
+    // Check every synapse was updated with its own indices on every timestep after the first
+    // **NOTE** postsynaptic learning processes spikes emitted in the previous timestep
+    for(unsigned int i = 0; i < 100; i++) {
+        for(unsigned int s = rowPtrSyn[i]; s < rowPtrSyn[i + 1]; s++) {
+            ASSERT_FLOAT_EQ(gSyn[s], 9.0f);
+            ASSERT_EQ(preIndSyn[s], i);
+            ASSERT_EQ(postIndSyn[s], indSyn[s]);
+        }
+    }
+
+    // Check restoring checkpoint reallocates synapses and restores their state
+    loadState("csr_post_learn.bin");
+    ASSERT_EQ(rowPtrSyn[100], numSynapses);
+    for(unsigned int s = 0; s < numSynapses; s++) {
+        ASSERT_FLOAT_EQ(gSyn[s], 4.0f);
+    }
+}
@@ -0,0 +1,49 @@
+//--------------------------------------------------------------------------
+/*! \file decode_matrix_globalg_bitmask_row_word_range/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    GENN_PREFERENCES.enableBitmaskOptimisations = true;
+
+    model.setDT(0.1);
+    model.setName("decode_matrix_globalg_bitmask_row_word_range");
+
+    // Static synapse parameters
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);    // 0 - Wij (nA)
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Pre", 10, {}, {});
+    // **NOTE** 200 postsynaptic neurons gives rows of 7 words so both 64-bit word pairs and a trailing single word are processed
+    model.addNeuronPopulation<Neuron>("Post", 200, {}, Neuron::VarValues(0.0));
+
+    SynapseGroup *syn = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::BITMASK_GLOBALG, NO_DELAY, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {});
+    syn->setBitmaskRowWordRangeEnabled(true);
+
+    model.setPrecision(GENN_FLOAT);
+}
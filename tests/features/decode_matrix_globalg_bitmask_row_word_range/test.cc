@@ -0,0 +1,94 @@
+//--------------------------------------------------------------------------
+/*! \file decode_matrix_globalg_bitmask_row_word_range/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "decode_matrix_globalg_bitmask_row_word_range_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+namespace
+{
+const unsigned int numPre = 10;
+const unsigned int numPost = 200;
+const unsigned int rowWords = (numPost + 31) / 32;
+
+// Is presynaptic neuron i connected to postsynaptic neuron j
+// **NOTE** rows start and end away from word boundaries, have odd and even
+// first words, leave empty words in the middle and at both ends or are empty
+bool isConnected(unsigned int i, unsigned int j)
+{
+    switch(i) {
+    case 0:
+        return (j >= 70 && j < 75);
+    case 1:
+        return (j >= 33 && j < 190);
+    case 2:
+        return (j == 5 || j == 195);
+    case 3:
+        return false;
+    case 4:
+        return (j >= 96 && j < 128);
+    case 5:
+        return (j >= 100 && j < 170 && (j % 3) == 0);
+    default:
+        return (j >= 20 && j < 180 && (j % (i + 1)) == 0);
+    }
+}
+}
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Loop through presynaptic neurons
+        for(unsigned int i = 0; i < numPre; i++) {
+            // Loop through postsynaptic neurons
+            // **NOTE** with bitmask optimisations, each row is padded to a whole number of words
+            for(unsigned int j = 0; j < numPost; j++) {
+                const unsigned int gid = (i * rowWords * 32) + j;
+                if(isConnected(i, j)) {
+                    setB(gpSyn[gid >> 5], gid & 31);
+                }
+                else {
+                    delB(gpSyn[gid >> 5], gid & 31);
+                }
+            }
+        }
+    }
+};
+
+TEST_F(SimTest, DecodeMatrixGlobalgBitmaskRowWordRange)
+{
+    // Loop through presynaptic neurons
+    for(unsigned int i = 0; i < numPre; i++) {
+        // Emit single spike from presynaptic neuron
+        glbSpkCntPre[0] = 1;
+        glbSpkPre[0] = i;
+        pushPreSpikesToDevice();
+
+        StepGeNN();
+
+        // Check exactly the postsynaptic neurons connected to this presynaptic neuron receive input
+        for(unsigned int j = 0; j < numPost; j++) {
+            ASSERT_EQ(xPost[j], isConnected(i, j) ? 1.0f : 0.0f) << "pre " << i << ", post " << j;
+        }
+    }
+}
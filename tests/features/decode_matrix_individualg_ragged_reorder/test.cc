@@ -0,0 +1,93 @@
+//--------------------------------------------------------------------------
+/*! \file decode_matrix_individualg_ragged_reorder/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+// Standard C++ includes
+#include <algorithm>
+#include <set>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "decode_matrix_individualg_ragged_reorder_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test_decoder_matrix.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTestDecoderMatrix
+{
+public:
+    //----------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //----------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Loop through presynaptic neurons
+        for(unsigned int i = 0; i < 10; i++)
+        {
+            // Initially zero row length
+            rowLengthSyn[i] = 0;
+            for(unsigned int j = 0; j < 4; j++)
+            {
+                // Get value this post synaptic neuron represents
+                const unsigned int j_value = (1 << j);
+
+                // If this postsynaptic neuron should be connected, add index
+                if(((i + 1) & j_value) != 0)
+                {
+                    const unsigned int idx = (i * 4) + rowLengthSyn[i]++;
+                    indSyn[idx] = j;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(SimTest, DecodeMatrixIndividualgRagged)
+{
+    // Check total error is less than some tolerance
+    EXPECT_TRUE(Simulate());
+
+    // Check each postsynaptic neuron's input has a unique position
+    std::set<unsigned int> positions(&inSynOrderSyn[0], &inSynOrderSyn[4]);
+    ASSERT_EQ(positions.size(), 4);
+    ASSERT_LT(*positions.rbegin(), 4);
+
+    // Check reordered target indices match connectivity
+    for(unsigned int i = 0; i < 10; i++) {
+        for(unsigned int j = 0; j < rowLengthSyn[i]; j++) {
+            const unsigned int idx = (i * 4) + j;
+            ASSERT_EQ(indInSynSyn[idx], inSynOrderSyn[indSyn[idx]]);
+        }
+    }
+}
+
+TEST_F(SimTest, ReorderedInSynLayout)
+{
+    // Check reordering has actually permuted postsynaptic input
+    ASSERT_FALSE(std::is_sorted(&inSynOrderSyn[0], &inSynOrderSyn[4]));
+
+    // Without any presynaptic spikes, write input for each postsynaptic neuron at its reordered position
+    glbSpkCntPre[0] = 0;
+    pushPreSpikesToDevice();
+    for(unsigned int j = 0; j < 4; j++) {
+        inSynSyn[inSynOrderSyn[j]] = (float)(j + 1);
+    }
+    pushSynStateToDevice();
+
+    // Check each postsynaptic neuron receives its own input
+    StepGeNN();
+    pullPostStateFromDevice();
+    for(unsigned int j = 0; j < 4; j++) {
+        ASSERT_FLOAT_EQ(xPost[j], (float)(j + 1));
+    }
+}
@@ -0,0 +1,104 @@
+//--------------------------------------------------------------------------
+/*! \file dynamic_params/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// PreNeuron
+//----------------------------------------------------------------------------
+class PreNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PreNeuron, 0, 0);
+
+    // Neurons spike every timestep
+    SET_THRESHOLD_CONDITION_CODE("true");
+
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+
+IMPLEMENT_MODEL(PreNeuron);
+
+//----------------------------------------------------------------------------
+// PostNeuron
+//----------------------------------------------------------------------------
+class PostNeuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(PostNeuron, 1, 2);
+
+    SET_SIM_CODE(
+        "$(x) = $(doubleOffset);\n"
+        "$(input) = $(Isyn);\n");
+
+    SET_PARAM_NAMES({"offset"});
+    SET_DERIVED_PARAMS({{"doubleOffset", [](const std::vector<double> &pars, double){ return 2.0 * pars[0]; }}});
+
+    SET_VARS({{"x", "scalar"}, {"input", "scalar"}});
+};
+
+IMPLEMENT_MODEL(PostNeuron);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(WeightUpdateModel, 1, 0, 0, 0);
+
+    SET_PARAM_NAMES({"g"});
+
+    SET_SIM_CODE("$(addToInSyn, $(g));\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+//----------------------------------------------------------------------------
+// PostsynapticModel
+//----------------------------------------------------------------------------
+class PostsynapticModel : public PostsynapticModels::Base
+{
+public:
+    DECLARE_MODEL(PostsynapticModel, 1, 0);
+
+    SET_PARAM_NAMES({"scale"});
+
+    SET_APPLY_INPUT_CODE(
+        "$(Isyn) += $(scale) * $(inSyn);\n"
+        "$(inSyn) = 0;\n");
+};
+
+IMPLEMENT_MODEL(PostsynapticModel);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("dynamic_params");
+
+    model.addNeuronPopulation<PreNeuron>("Pre", 10, {}, {});
+    NeuronGroup *post = model.addNeuronPopulation<PostNeuron>("Post", 10, PostNeuron::ParamValues(1.0), PostNeuron::VarValues(0.0, 0.0));
+    model.addNeuronPopulation<PostNeuron>("PostStatic", 10, PostNeuron::ParamValues(1.0), PostNeuron::VarValues(0.0, 0.0));
+
+    SynapseGroup *syn = model.addSynapsePopulation<WeightUpdateModel, PostsynapticModel>(
+        "Syn", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "Pre", "Post",
+        WeightUpdateModel::ParamValues(1.0), {},
+        PostsynapticModel::ParamValues(1.0), {});
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModel>(
+        "SynStatic", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "Pre", "PostStatic",
+        WeightUpdateModel::ParamValues(1.0), {},
+        PostsynapticModel::ParamValues(1.0), {});
+
+    // Make parameters of one neuron and synapse population dynamic
+    post->setParamDynamic("offset");
+    syn->setWUParamDynamic("g");
+    syn->setPSParamDynamic("scale");
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,66 @@
+//--------------------------------------------------------------------------
+/*! \file dynamic_params/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "dynamic_params_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, DynamicParams)
+{
+    const unsigned int numNeurons = 10;
+
+    // Simulate until spikes emitted by presynaptic neurons in first timestep have been delivered
+    StepGeNN();
+    StepGeNN();
+
+    // Check both populations behave the same using original parameter values
+    EXPECT_TRUE(std::all_of(&xPost[0], &xPost[numNeurons], [](float x) { return x == 2.0f; }));
+    EXPECT_TRUE(std::all_of(&inputPost[0], &inputPost[numNeurons], [](float i) { return i == 10.0f; }));
+    EXPECT_TRUE(std::all_of(&xPostStatic[0], &xPostStatic[numNeurons], [](float x) { return x == 2.0f; }));
+    EXPECT_TRUE(std::all_of(&inputPostStatic[0], &inputPostStatic[numNeurons], [](float i) { return i == 10.0f; }));
+
+    // Change dynamic parameters, setting derived parameter manually
+    setPostoffset(5.0f);
+    setPostdoubleOffset(10.0f);
+    setSyng(2.0f);
+    setSynscale(3.0f);
+    StepGeNN();
+
+    // Check only population with dynamic parameters is affected
+    EXPECT_TRUE(std::all_of(&xPost[0], &xPost[numNeurons], [](float x) { return x == 10.0f; }));
+    EXPECT_TRUE(std::all_of(&inputPost[0], &inputPost[numNeurons], [](float i) { return i == 60.0f; }));
+    EXPECT_TRUE(std::all_of(&xPostStatic[0], &xPostStatic[numNeurons], [](float x) { return x == 2.0f; }));
+    EXPECT_TRUE(std::all_of(&inputPostStatic[0], &inputPostStatic[numNeurons], [](float i) { return i == 10.0f; }));
+
+    // Checkpoint state, restore original parameter values and check dynamic parameters are reloaded from checkpoint
+    saveState("dynamic_params.bin");
+    setPostoffset(1.0f);
+    setPostdoubleOffset(2.0f);
+    setSyng(1.0f);
+    setSynscale(1.0f);
+    loadState("dynamic_params.bin");
+    EXPECT_EQ(offsetPost, 5.0f);
+    EXPECT_EQ(doubleOffsetPost, 10.0f);
+    EXPECT_EQ(gSyn, 2.0f);
+    EXPECT_EQ(scaleSyn, 3.0f);
+}
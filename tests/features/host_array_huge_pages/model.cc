@@ -0,0 +1,65 @@
+//--------------------------------------------------------------------------
+/*! \file host_array_huge_pages/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+//! Neuron which spikes every other timestep
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 0, 1);
+
+    SET_SIM_CODE("$(x) += 1.0;\n");
+
+    SET_THRESHOLD_CONDITION_CODE("fmod($(x), 2.0) > 0.5");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Post
+//----------------------------------------------------------------------------
+class Post : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Post, 0, 2);
+
+    SET_SIM_CODE("$(x) += $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}, {"count", "unsigned int"}});
+};
+
+IMPLEMENT_MODEL(Post);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    // Request huge pages for arrays of at least 1MB
+    // **NOTE** if transparent huge pages are unavailable, madvise fails and arrays should fall back to normal pages
+    GENN_PREFERENCES.allocationPolicy.hugePageThreshold = 1024 * 1024;
+
+    model.setDT(1.0);
+    model.setName("host_array_huge_pages");
+
+    // **NOTE** weight matrix is 4MB so will be allocated using huge pages whereas all other arrays are small
+    model.addNeuronPopulation<Pre>("Pre", 1000, {}, Pre::VarValues(0.0));
+    model.addNeuronPopulation<Post>("Post", 1000, {}, Post::VarValues(0.0, 0));
+
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "Post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(1.0),
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+}
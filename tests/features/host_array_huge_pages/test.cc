@@ -0,0 +1,59 @@
+//--------------------------------------------------------------------------
+/*! \file host_array_huge_pages/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+
+// Standard C includes
+#include <cstdint>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "host_array_huge_pages_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+namespace
+{
+bool isAligned(const void *ptr, size_t alignment)
+{
+    return ((reinterpret_cast<uintptr_t>(ptr) % alignment) == 0);
+}
+}
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, HostArrayHugePages)
+{
+    // Check weight matrix is aligned to huge page and all other arrays to default alignment
+    EXPECT_TRUE(isAligned(gSyn, 2 * 1024 * 1024));
+    EXPECT_TRUE(isAligned(glbSpkCntPre, 64));
+    EXPECT_TRUE(isAligned(glbSpkPre, 64));
+    EXPECT_TRUE(isAligned(xPre, 64));
+    EXPECT_TRUE(isAligned(glbSpkCntPost, 64));
+    EXPECT_TRUE(isAligned(glbSpkPost, 64));
+    EXPECT_TRUE(isAligned(xPost, 64));
+    EXPECT_TRUE(isAligned(countPost, 64));
+    EXPECT_TRUE(isAligned(inSynSyn, 64));
+
+    // Check model simulates correctly whether or not huge pages were actually used
+    // **NOTE** presynaptic neurons spike in even timesteps and spikes are delivered in the next timestep
+    for(unsigned int i = 0; i < 10; i++) {
+        StepGeNN();
+    }
+    EXPECT_TRUE(std::all_of(&xPre[0], &xPre[1000], [](float x) { return x == 10.0f; }));
+    EXPECT_TRUE(std::all_of(&xPost[0], &xPost[1000], [](float x) { return x == 5000.0f; }));
+}
@@ -0,0 +1,79 @@
+//--------------------------------------------------------------------------
+/*! \file merged_field_specialisation/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Diagonal
+//----------------------------------------------------------------------------
+//! Connects each presynaptic neuron to the postsynaptic neuron with the same index, if there is one
+/*! **NOTE** std::min takes its arguments by reference so odr-uses num_post */
+class Diagonal : public InitSparseConnectivitySnippet::Base
+{
+public:
+    DECLARE_SNIPPET(Diagonal, 0);
+
+    SET_ROW_BUILD_CODE(
+        "const unsigned int j = std::min($(id_pre), $(num_post));\n"
+        "if(j < $(num_post)) {\n"
+        "   $(addSynapse, j);\n"
+        "}\n"
+        "$(endRow);\n");
+
+    SET_CALC_MAX_ROW_LENGTH_FUNC([](unsigned int, unsigned int, const std::vector<double> &){ return 1; });
+};
+IMPLEMENT_SNIPPET(Diagonal);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("merged_field_specialisation");
+
+    // Static synapse parameters
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);    // 0 - Wij (nA)
+
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("PreSpecA", 10, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("PreSpecB", 10, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("PreHetA", 10, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("PreHetB", 10, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("PostSpecA", 6, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("PostSpecB", 6, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("PostHetA", 4, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("PostHetB", 8, {}, {});
+
+    // Synapse groups with the same number of postsynaptic neurons, whose num_post field is specialised as a constant
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynSpecA", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "PreSpecA", "PostSpecA",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<Diagonal>({}));
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynSpecB", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "PreSpecB", "PostSpecB",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<Diagonal>({}));
+
+    // Synapse groups with different numbers of postsynaptic neurons, whose num_post field is stored in the merged structure
+    // **NOTE** narrow sparse indices stop these being merged with the groups above
+    auto *synHetA = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynHetA", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "PreHetA", "PostHetA",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<Diagonal>({}));
+    auto *synHetB = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynHetB", SynapseMatrixType::SPARSE_INDIVIDUALG, NO_DELAY, "PreHetB", "PostHetB",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<Diagonal>({}));
+    synHetA->setNarrowSparseIndEnabled(true);
+    synHetB->setNarrowSparseIndEnabled(true);
+
+    model.setPrecision(GENN_FLOAT);
+}
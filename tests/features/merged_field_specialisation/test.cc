@@ -0,0 +1,54 @@
+//--------------------------------------------------------------------------
+/*! \file merged_field_specialisation/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "merged_field_specialisation_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+protected:
+    //--------------------------------------------------------------------------
+    // Protected methods
+    //--------------------------------------------------------------------------
+    //! Check each presynaptic neuron connects to postsynaptic neuron with same index, if there is one
+    template<typename I>
+    void checkDiagonal(const unsigned int *rowLength, const I *ind, unsigned int numPost) const
+    {
+        for(unsigned int i = 0; i < 10; i++) {
+            if(i < numPost) {
+                ASSERT_EQ(rowLength[i], 1);
+                ASSERT_EQ(ind[i], i);
+            }
+            else {
+                ASSERT_EQ(rowLength[i], 0);
+            }
+        }
+    }
+};
+
+TEST_F(SimTest, MergedFieldSpecialisation)
+{
+    // Check connectivity of groups whose num_post field is specialised
+    checkDiagonal(rowLengthSynSpecA, indSynSpecA, 6);
+    checkDiagonal(rowLengthSynSpecB, indSynSpecB, 6);
+
+    // Check connectivity of groups whose num_post field is stored in merged structure
+    checkDiagonal(rowLengthSynHetA, indSynHetA, 4);
+    checkDiagonal(rowLengthSynHetB, indSynHetB, 8);
+}
@@ -0,0 +1,78 @@
+//--------------------------------------------------------------------------
+/*! \file mpi_spike_exchange/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Source
+//----------------------------------------------------------------------------
+//! Neuron which spikes every period timesteps, offset by its ID
+class Source : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Source, 1, 1);
+
+    SET_SIM_CODE("$(c) += 1.0;\n");
+
+    SET_THRESHOLD_CONDITION_CODE("fmod($(c) + $(id), $(period)) < 0.5");
+
+    SET_PARAM_NAMES({"period"});
+    SET_VARS({{"c", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Source);
+
+//----------------------------------------------------------------------------
+// Accumulator
+//----------------------------------------------------------------------------
+//! Neuron which counts incoming spikes
+class Accumulator : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Accumulator, 0, 1);
+
+    SET_SIM_CODE("$(x) += $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Accumulator);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("mpi_spike_exchange");
+
+    // Add source and accumulator population to each of the 4 hosts
+    // **NOTE** each source spikes with a different period so hosts receive distinct spike trains
+    for(int h = 0; h < 4; h++) {
+        auto *source = model.addNeuronPopulation<Source>("Source" + std::to_string(h), 10,
+                                                         Source::ParamValues(3.0 + h), Source::VarValues(0.0));
+        auto *accumulator = model.addNeuronPopulation<Accumulator>("Accumulator" + std::to_string(h), 10,
+                                                                   {}, Accumulator::VarValues(0.0));
+        source->setHostID(h);
+        accumulator->setHostID(h);
+    }
+
+    // Connect each accumulator one-to-one to the source on the next host so every spike it receives crosses ranks
+    // **NOTE** a different axonal delay is used on each host so delayed spike queues are also exchanged
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(1.0);
+    for(int h = 0; h < 4; h++) {
+        const std::string sourceName = "Source" + std::to_string((h + 1) % 4);
+        const std::string accumulatorName = "Accumulator" + std::to_string(h);
+        model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+            sourceName + "_" + accumulatorName, SynapseMatrixType::SPARSE_GLOBALG, h, sourceName, accumulatorName,
+            {}, staticSynapseInit,
+            {}, {},
+            initConnectivity<InitSparseConnectivitySnippet::OneToOne>());
+    }
+
+    model.setPrecision(GENN_FLOAT);
+}
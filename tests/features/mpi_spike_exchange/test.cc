@@ -0,0 +1,79 @@
+//--------------------------------------------------------------------------
+/*! \file mpi_spike_exchange/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+
+Code is generated for each of the 4 hosts with mpirun -np 4 genn-buildmodel.sh -m model.cc
+and this file is built once per host with HOST_ID defined, before being run with
+mpirun -np 1 ./test_0 : -np 1 ./test_1 : -np 1 ./test_2 : -np 1 ./test_3
+*/
+//--------------------------------------------------------------------------
+// MPI includes
+#include <mpi.h>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code for this host
+#include "definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+// Macros to build names of this host's populations
+#define JOIN_NAME(A, B) A##B
+#define HOST_NAME(A, B) JOIN_NAME(A, B)
+
+namespace
+{
+// Number of spikes source neuron with period, spiking every period timesteps offset by its id,
+// has delivered through synapses with delay by the end of timestep
+unsigned int getNumSpikesDelivered(unsigned int timestep, unsigned int id, unsigned int period, unsigned int delay)
+{
+    // **NOTE** spikes are emitted by neuron update so are processed by the synapse update of the following timestep
+    unsigned int numSpikes = 0;
+    for(unsigned int t = 0; (t + delay + 1) <= timestep; t++) {
+        if(((t + 1 + id) % period) == 0) {
+            numSpikes++;
+        }
+    }
+    return numSpikes;
+}
+}
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, MPISpikeExchange)
+{
+    // Accumulator on this host receives spikes from source on next host
+    const unsigned int period = 3 + ((HOST_ID + 1) % 4);
+    const unsigned int delay = HOST_ID;
+
+    // **NOTE** every host must simulate the same number of timesteps as stepTime exchanges spikes
+    for(unsigned int i = 0; i < 50; i++) {
+        StepGeNN();
+
+        // Check each accumulator neuron has received exactly the spikes emitted by its source neuron on the other host
+        for(unsigned int j = 0; j < 10; j++) {
+            EXPECT_EQ(HOST_NAME(xAccumulator, HOST_ID)[j], (float)getNumSpikesDelivered(i, j, period, delay))
+                << "host " << HOST_ID << ", timestep " << i << ", neuron " << j;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    // **NOTE** the generated code uses MPI but leaves initialising and finalising it to the user
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleTest(&argc, argv);
+    const int result = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return result;
+}
@@ -0,0 +1,103 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_ode_integrators/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// NeuronEuler
+//----------------------------------------------------------------------------
+//! Neuron with a decaying variable V and a variable X driven by time, integrated with many Euler substeps
+class NeuronEuler : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(NeuronEuler, 1, 2);
+
+    SET_ODES({{"V", "-$(V) / $(tau)"}, {"X", "cos($(t))"}});
+    SET_ODE_INTEGRATOR(ForwardEuler);
+    SET_ODE_SUBSTEPS(100);
+
+    SET_PARAM_NAMES({"tau"});
+    SET_VARS({{"V", "scalar"}, {"X", "scalar"}});
+};
+IMPLEMENT_MODEL(NeuronEuler);
+
+//----------------------------------------------------------------------------
+// NeuronExponentialEuler
+//----------------------------------------------------------------------------
+class NeuronExponentialEuler : public NeuronEuler
+{
+public:
+    DECLARE_MODEL(NeuronExponentialEuler, 1, 2);
+
+    SET_ODE_INTEGRATOR(ExponentialEuler);
+    SET_ODE_SUBSTEPS(1);
+};
+IMPLEMENT_MODEL(NeuronExponentialEuler);
+
+//----------------------------------------------------------------------------
+// NeuronRK4
+//----------------------------------------------------------------------------
+class NeuronRK4 : public NeuronEuler
+{
+public:
+    DECLARE_MODEL(NeuronRK4, 1, 2);
+
+    SET_ODE_INTEGRATOR(RK4);
+    SET_ODE_SUBSTEPS(1);
+};
+IMPLEMENT_MODEL(NeuronRK4);
+
+//----------------------------------------------------------------------------
+// NeuronRK45
+//----------------------------------------------------------------------------
+class NeuronRK45 : public NeuronEuler
+{
+public:
+    DECLARE_MODEL(NeuronRK45, 1, 2);
+
+    SET_ODE_INTEGRATOR(RK45);
+    SET_ODE_SUBSTEPS(1);
+    SET_ODE_TOLERANCE(1E-8);
+};
+IMPLEMENT_MODEL(NeuronRK45);
+
+//----------------------------------------------------------------------------
+// NeuronRK45Oscillatory
+//----------------------------------------------------------------------------
+//! Neuron whose derivative oscillates so rapidly that the RK45 error tolerance cannot be met at any practical step size
+class NeuronRK45Oscillatory : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(NeuronRK45Oscillatory, 0, 1);
+
+    SET_ODES({{"Z", "1.0E6 * sin(1.0E12 * $(t))"}});
+    SET_ODE_INTEGRATOR(RK45);
+    SET_ODE_SUBSTEPS(1);
+    SET_ODE_TOLERANCE(1E-8);
+
+    SET_VARS({{"Z", "scalar"}});
+};
+IMPLEMENT_MODEL(NeuronRK45Oscillatory);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.5);
+    model.setName("neuron_ode_integrators");
+
+    NeuronEuler::ParamValues params(20.0);
+    NeuronEuler::VarValues vars(1.0, 0.0);
+    model.addNeuronPopulation<NeuronEuler>("Euler", 10, params, vars);
+    model.addNeuronPopulation<NeuronExponentialEuler>("ExponentialEuler", 10, params, vars);
+    model.addNeuronPopulation<NeuronRK4>("RK4", 10, params, vars);
+    model.addNeuronPopulation<NeuronRK45>("RK45", 10, params, vars);
+    model.addNeuronPopulation<NeuronRK45Oscillatory>("RK45Oscillatory", 1, {}, NeuronRK45Oscillatory::VarValues(0.0));
+
+    model.setPrecision(GENN_DOUBLE);
+}
@@ -0,0 +1,54 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_ode_integrators/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "neuron_ode_integrators_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, NeuronODEIntegrators)
+{
+    for(unsigned int i = 0; i < 200; i++) {
+        StepGeNN();
+
+        // Analytic solutions of dV/dt = -V / tau and dX/dt = cos(t)
+        const double v = std::exp(-t / 20.0);
+        const double x = std::sin(t);
+        for(unsigned int j = 0; j < 10; j++) {
+            EXPECT_NEAR(VEuler[j], v, 1E-4);
+            EXPECT_NEAR(XEuler[j], x, 1E-2);
+
+            // **NOTE** exponential Euler is exact for V but, as X's derivative doesn't depend on X, it only takes a single Euler step for X
+            EXPECT_NEAR(VExponentialEuler[j], v, 1E-12);
+
+            EXPECT_NEAR(VRK4[j], v, 1E-8);
+            EXPECT_NEAR(XRK4[j], x, 1E-3);
+
+            EXPECT_NEAR(VRK45[j], v, 1E-6);
+            EXPECT_NEAR(XRK45[j], x, 1E-6);
+        }
+
+        // Check RK45 still completes each timestep, by taking steps of the minimum size or
+        // falling back to a single step after the maximum number of steps, when tolerance can't be met
+        EXPECT_TRUE(std::isfinite(ZRK45Oscillatory[0]));
+    }
+}
@@ -0,0 +1,26 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_poisson_event_driven/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("neuron_poisson_event_driven");
+
+    // 1000Hz Poisson neurons i.e. each neuron should spike with probability 0.1 every timestep
+    NeuronModels::PoissonEventDriven::ParamValues paramVals(1000.0);
+    model.addNeuronPopulation<NeuronModels::PoissonEventDriven>("Pop", 1000, paramVals, {});
+
+    // 20000Hz Poisson neurons i.e. spike probability would be 2 so every neuron should spike every timestep
+    NeuronModels::PoissonEventDriven::ParamValues saturatedParamVals(20000.0);
+    model.addNeuronPopulation<NeuronModels::PoissonEventDriven>("Saturated", 100, saturatedParamVals, {});
+
+    model.setPrecision(GENN_FLOAT);
+}
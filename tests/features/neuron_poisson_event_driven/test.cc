@@ -0,0 +1,78 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_poisson_event_driven/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <tuple>
+#include <vector>
+
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "neuron_poisson_event_driven_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+#include "../../utils/stats.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, NeuronPoissonEventDriven)
+{
+    // Count spikes emitted by each neuron
+    std::vector<double> spikeCounts(1000, 0.0);
+    unsigned int totalSpikes = 0;
+    for(unsigned int i = 0; i < 1000; i++) {
+        StepGeNN();
+        pullPopCurrentSpikesFromDevice();
+
+        for(unsigned int s = 0; s < spikeCount_Pop; s++) {
+            ASSERT_LT(spike_Pop[s], 1000);
+
+            // Check spikes are emitted in ascending order without duplicates
+            if(s > 0) {
+                ASSERT_GT(spike_Pop[s], spike_Pop[s - 1]);
+            }
+            spikeCounts[spike_Pop[s]] += 1.0;
+        }
+        totalSpikes += spikeCount_Pop;
+    }
+
+    // Check total number of spikes is within 5 standard deviations of the expected 1000 * 1000 * 0.1
+    EXPECT_NEAR(totalSpikes, 100000.0, 5.0 * std::sqrt(1000.0 * 1000.0 * 0.1 * 0.9));
+
+    // Check spikes are evenly distributed across neurons
+    double df;
+    double chiSquared;
+    double prob;
+    const std::vector<double> expectedSpikeCounts(1000, 100.0);
+    std::tie(df, chiSquared, prob) = Stats::chiSquaredTest(spikeCounts, expectedSpikeCounts);
+    EXPECT_GT(prob, 0.001);
+}
+
+TEST_F(SimTest, NeuronPoissonEventDrivenSaturated)
+{
+    for(unsigned int i = 0; i < 100; i++) {
+        StepGeNN();
+        pullSaturatedCurrentSpikesFromDevice();
+
+        // Check every neuron spikes every timestep
+        ASSERT_EQ(spikeCount_Saturated, 100);
+        for(unsigned int s = 0; s < spikeCount_Saturated; s++) {
+            ASSERT_EQ(spike_Saturated[s], s);
+        }
+    }
+}
@@ -0,0 +1,40 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_rng_binomial/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    // Neurons sample from distributions with small and large means and with p < 0.5 and p > 0.5 so all algorithms are tested
+    SET_SIM_CODE(
+        "const unsigned int n = (($(id) % 3) == 0) ? 1000 : ((($(id) % 3) == 1) ? 20 : 200);\n"
+        "const scalar p = (($(id) % 3) == 0) ? 0.05 : ((($(id) % 3) == 1) ? 0.9 : 0.7);\n"
+        "$(x)= $(gennrand_binomial, n, p);\n");
+
+    SET_VARS({{"x", "unsigned int"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("neuron_rng_binomial");
+
+    model.addNeuronPopulation<Neuron>("Pop", 1000, {}, Neuron::VarValues(0));
+
+    model.setPrecision(GENN_FLOAT);
+}
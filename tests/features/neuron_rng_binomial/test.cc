@@ -0,0 +1,93 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_rng_binomial/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "neuron_rng_binomial_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+#include "../../utils/stats.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Perform chi-squared test of samples against binomial distribution, pooling tails into first and last bins
+double testBinomial(const std::vector<unsigned int> &samples, unsigned int n, double p)
+{
+    // Calculate expected number of samples with each value
+    std::vector<double> expectedCounts(n + 1);
+    for(unsigned int k = 0; k <= n; k++) {
+        const double logProb = std::lgamma(n + 1.0) - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0)
+            + (k * std::log(p)) + ((n - k) * std::log(1.0 - p));
+        expectedCounts[k] = std::exp(logProb) * samples.size();
+    }
+
+    // Find range of values where expected counts are large enough for chi-squared test
+    const auto firstBin = std::find_if(expectedCounts.cbegin(), expectedCounts.cend(),
+                                       [](double c){ return c >= 10.0; }) - expectedCounts.cbegin();
+    const auto lastBin = std::find_if(expectedCounts.crbegin(), expectedCounts.crend(),
+                                      [](double c){ return c >= 10.0; }).base() - expectedCounts.cbegin() - 1;
+
+    // Pool tails into first and last bins
+    std::vector<double> expectedBins(expectedCounts.cbegin() + firstBin, expectedCounts.cbegin() + lastBin + 1);
+    expectedBins.front() = std::accumulate(expectedCounts.cbegin(), expectedCounts.cbegin() + firstBin + 1, 0.0);
+    expectedBins.back() = std::accumulate(expectedCounts.cbegin() + lastBin, expectedCounts.cend(), 0.0);
+
+    std::vector<double> bins(expectedBins.size(), 0.0);
+    for(unsigned int s : samples) {
+        EXPECT_LE(s, n);
+        const long bin = std::min<long>(std::max<long>((long)s - firstBin, 0), lastBin - firstBin);
+        bins[bin] += 1.0;
+    }
+
+    double df;
+    double chiSquared;
+    double prob;
+    std::tie(df, chiSquared, prob) = Stats::chiSquaredTest(bins, expectedBins);
+    return prob;
+}
+}
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, NeuronRngBinomial)
+{
+    // Gather samples from each distribution
+    std::vector<unsigned int> samples[3];
+    for(unsigned int i = 0; i < 1000; i++) {
+        StepGeNN();
+
+        for(unsigned int j = 0; j < 1000; j++) {
+            samples[j % 3].push_back(xPop[j]);
+        }
+    }
+
+    // Check p values pass 95% confidence interval
+    EXPECT_GT(testBinomial(samples[0], 1000, 0.05), 0.05);
+    EXPECT_GT(testBinomial(samples[1], 20, 0.9), 0.05);
+    EXPECT_GT(testBinomial(samples[2], 200, 0.7), 0.05);
+}
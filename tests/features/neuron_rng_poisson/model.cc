@@ -0,0 +1,39 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_rng_poisson/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    // Even neurons sample with a small mean and odd neurons with a large one so both algorithms are tested
+    SET_SIM_CODE(
+        "const scalar lambda = (($(id) % 2) == 0) ? 3.0 : 25.0;\n"
+        "$(x)= $(gennrand_poisson, lambda);\n");
+
+    SET_VARS({{"x", "unsigned int"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("neuron_rng_poisson");
+
+    model.addNeuronPopulation<Neuron>("Pop", 1000, {}, Neuron::VarValues(0));
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,96 @@
+//--------------------------------------------------------------------------
+/*! \file neuron_rng_poisson/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "neuron_rng_poisson_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+#include "../../utils/stats.h"
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Perform chi-squared test of samples against Poisson distribution, pooling tails into first and last bins
+double testPoisson(const std::vector<unsigned int> &samples, double lambda)
+{
+    // Calculate expected number of samples with each value up to well beyond the mean
+    const unsigned int maxK = (unsigned int)std::ceil(lambda + (20.0 * std::sqrt(lambda)) + 20.0);
+    std::vector<double> expectedCounts(maxK + 1);
+    for(unsigned int k = 0; k <= maxK; k++) {
+        expectedCounts[k] = std::exp((k * std::log(lambda)) - lambda - std::lgamma(k + 1.0)) * samples.size();
+    }
+
+    // Find range of values where expected counts are large enough for chi-squared test
+    const auto firstBin = std::find_if(expectedCounts.cbegin(), expectedCounts.cend(),
+                                       [](double c){ return c >= 10.0; }) - expectedCounts.cbegin();
+    const auto lastBin = std::find_if(expectedCounts.crbegin(), expectedCounts.crend(),
+                                      [](double c){ return c >= 10.0; }).base() - expectedCounts.cbegin() - 1;
+
+    // Pool tails into first and last bins
+    std::vector<double> expectedBins(expectedCounts.cbegin() + firstBin, expectedCounts.cbegin() + lastBin + 1);
+    expectedBins.front() = std::accumulate(expectedCounts.cbegin(), expectedCounts.cbegin() + firstBin + 1, 0.0);
+    expectedBins.back() = std::accumulate(expectedCounts.cbegin() + lastBin, expectedCounts.cend(), 0.0);
+
+    std::vector<double> bins(expectedBins.size(), 0.0);
+    for(unsigned int s : samples) {
+        const long bin = std::min<long>(std::max<long>((long)s - firstBin, 0), lastBin - firstBin);
+        bins[bin] += 1.0;
+    }
+
+    double df;
+    double chiSquared;
+    double prob;
+    std::tie(df, chiSquared, prob) = Stats::chiSquaredTest(bins, expectedBins);
+    return prob;
+}
+}
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, NeuronRngPoisson)
+{
+    // Gather samples from even and odd neurons
+    std::vector<unsigned int> smallSamples;
+    std::vector<unsigned int> largeSamples;
+    for(unsigned int i = 0; i < 1000; i++) {
+        StepGeNN();
+
+        for(unsigned int j = 0; j < 1000; j++) {
+            if((j % 2) == 0) {
+                smallSamples.push_back(xPop[j]);
+            }
+            else {
+                largeSamples.push_back(xPop[j]);
+            }
+        }
+    }
+
+    // Check p values pass 95% confidence interval
+    EXPECT_GT(testPoisson(smallSamples, 3.0), 0.05);
+    EXPECT_GT(testPoisson(largeSamples, 25.0), 0.05);
+}
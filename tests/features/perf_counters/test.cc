@@ -0,0 +1,74 @@
+//--------------------------------------------------------------------------
+/*! \file perf_counters/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <string>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "perf_counters_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, PerfCounters)
+{
+    for(unsigned int i = 0; i < 100; i++) {
+        StepGeNN();
+    }
+
+    // If hardware performance counters are available, check cycles and instructions have been counted
+    // **NOTE** virtual machines and containers often don't expose them, in which case they should all remain zero
+    const unsigned long long *phases[3] = {neuronUpdatePerfCounters, presynapticUpdatePerfCounters, initPerfCounters};
+    for(const unsigned long long *counters : phases) {
+        if(arePerfCountersAvailable()) {
+            EXPECT_GT(counters[0], 0);
+            EXPECT_GT(counters[1], 0);
+        }
+        else {
+            for(unsigned int c = 0; c < 4; c++) {
+                EXPECT_EQ(counters[c], 0);
+            }
+        }
+    }
+
+    // Check counters recorded for profiled regions are consistent with those recorded for phases
+    unsigned long long profileInstructions = 0;
+    for(unsigned int r = 0; r < getProfileNumRegions(); r++) {
+        EXPECT_EQ(getProfileRegionCount(r), 100);
+        if(getProfileRegionParent(r) == -1 && std::string(getProfileRegionPhase(r)) == "neuronUpdate") {
+            profileInstructions += getProfileRegionPerfCounter(r, 1);
+        }
+    }
+    EXPECT_LE(profileInstructions, neuronUpdatePerfCounters[1]);
+    if(arePerfCountersAvailable()) {
+        EXPECT_GT(profileInstructions, 0);
+    }
+}
+
+TEST_F(SimTest, PerfCountersClosedByFreeMem)
+{
+    const bool available = arePerfCountersAvailable();
+
+    // Check freeing memory closes counters
+    freeMem();
+    EXPECT_FALSE(arePerfCountersAvailable());
+
+    // Check re-allocating memory re-opens them so TearDown can free everything again
+    allocateMem();
+    EXPECT_EQ(arePerfCountersAvailable(), available);
+}
@@ -0,0 +1,41 @@
+//--------------------------------------------------------------------------
+/*! \file profiling/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("profiling");
+    model.setProfiling(true);
+
+    NeuronModels::PoissonNew::ParamValues poissonParams(10.0);
+    NeuronModels::PoissonNew::VarValues poissonInit(0.0);
+    NeuronModels::LIF::ParamValues lifParams(0.25, 10.0, -65.0, -65.0, -50.0, 0.0, 2.0);
+    NeuronModels::LIF::VarValues lifInit(-65.0, 0.0);
+
+    // Two identical spike sources which get merged together
+    model.addNeuronPopulation<NeuronModels::PoissonNew>("Pre1", 100, poissonParams, poissonInit);
+    model.addNeuronPopulation<NeuronModels::PoissonNew>("Pre2", 100, poissonParams, poissonInit);
+    model.addNeuronPopulation<NeuronModels::LIF>("Post", 100, lifParams, lifInit);
+
+    // Two identical synapse populations which also get merged together
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn1", SynapseMatrixType::SPARSE_GLOBALG, NO_DELAY, "Pre1", "Post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(0.5),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({0.1}));
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "Syn2", SynapseMatrixType::SPARSE_GLOBALG, NO_DELAY, "Pre2", "Post",
+        {}, WeightUpdateModels::StaticPulse::VarValues(0.5),
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({0.1}));
+
+    model.setPrecision(GENN_FLOAT);
+}
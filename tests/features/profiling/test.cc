@@ -0,0 +1,96 @@
+//--------------------------------------------------------------------------
+/*! \file profiling/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "profiling_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, Profiling)
+{
+    for(unsigned int i = 0; i < 100; i++) {
+        StepGeNN();
+    }
+
+    // Two merged neuron update groups, containing Pre1 and Pre2 and Post, and one merged presynaptic update group containing Syn1 and Syn2
+    ASSERT_EQ(getProfileNumRegions(), 8);
+
+    unsigned int numMergedRegions = 0;
+    bool postFound = false;
+    for(unsigned int r = 0; r < getProfileNumRegions(); r++) {
+        // Check every region has been updated every timestep
+        EXPECT_EQ(getProfileRegionCount(r), 100);
+        EXPECT_GE(getProfileRegionMaxTime(r), getProfileRegionMinTime(r));
+        EXPECT_GE(getProfileRegionTotalTime(r), getProfileRegionMinTime(r) * 100.0);
+
+        // Check histogram accounts for every update
+        unsigned long long histogramCount = 0;
+        for(unsigned int b = 0; b < getProfileNumHistogramBins(); b++) {
+            histogramCount += getProfileRegionHistogram(r, b);
+        }
+        EXPECT_EQ(histogramCount, 100);
+
+        // Check populations are in the same phase as the merged group containing them
+        const int parent = getProfileRegionParent(r);
+        if(parent == -1) {
+            numMergedRegions++;
+        }
+        else {
+            EXPECT_LT(parent, (int)r);
+            EXPECT_EQ(getProfileRegionParent(parent), -1);
+            EXPECT_EQ(std::string(getProfileRegionPhase(r)), getProfileRegionPhase(parent));
+        }
+
+        if(std::string(getProfileRegionName(r)) == "Post") {
+            postFound = true;
+            EXPECT_EQ(std::string(getProfileRegionPhase(r)), "neuronUpdate");
+        }
+    }
+    EXPECT_EQ(numMergedRegions, 3);
+    EXPECT_TRUE(postFound);
+
+    // Check trace contains an event for every update
+    writeProfileTrace("profiling_trace.json");
+    std::ifstream traceFile("profiling_trace.json");
+    const std::string trace((std::istreambuf_iterator<char>(traceFile)), std::istreambuf_iterator<char>());
+    size_t numEvents = 0;
+    for(size_t pos = trace.find("\"ph\": \"X\""); pos != std::string::npos; pos = trace.find("\"ph\": \"X\"", pos + 1)) {
+        numEvents++;
+    }
+    EXPECT_EQ(numEvents, 800);
+
+    // Check summary contains a header followed by a row for every region
+    writeProfileSummary("profiling_summary.txt");
+    std::ifstream summaryFile("profiling_summary.txt");
+    std::string line;
+    size_t numLines = 0;
+    while(std::getline(summaryFile, line)) {
+        numLines++;
+    }
+    EXPECT_EQ(numLines, 9);
+
+    // Check resetting profile clears counts
+    resetProfile();
+    EXPECT_EQ(getProfileRegionCount(0), 0);
+}
@@ -0,0 +1,58 @@
+//--------------------------------------------------------------------------
+/*! \file save_load_state/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(V) += $(Isyn) - (0.1 * $(V));\n");
+    SET_THRESHOLD_CONDITION_CODE("$(V) >= 1.0");
+    SET_RESET_CODE("$(V) = 0.0;\n");
+
+    SET_VARS({{"V", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Neuron);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("save_load_state");
+
+    NeuronModels::PoissonNew::ParamValues poissonParams(
+        50.0);      // 0 - rate (Hz)
+    NeuronModels::PoissonNew::VarValues poissonInit(
+        0.0);       // 0 - timeStepToSpike
+
+    // Static synapse parameters
+    WeightUpdateModels::StaticPulseDendriticDelay::VarValues staticSynapseInit(
+        initVar<InitVarSnippet::Uniform>({0.1, 0.5}),   // 0 - Wij (nA)
+        3.0);                                              // 1 - Dij (timestep)
+
+    model.addNeuronPopulation<NeuronModels::PoissonNew>("Pre", 100, poissonParams, poissonInit);
+    model.addNeuronPopulation<Neuron>("Post", 10, {}, Neuron::VarValues(0.0));
+
+    // Connect with random sparse connectivity, axonal and dendritic delays so
+    // connectivity, spike queues and dendritic delay buffers all need checkpointing
+    auto *syn = model.addSynapsePopulation<WeightUpdateModels::StaticPulseDendriticDelay, PostsynapticModels::DeltaCurr>(
+        "Syn", SynapseMatrixType::SPARSE_INDIVIDUALG, 5, "Pre", "Post",
+        {}, staticSynapseInit,
+        {}, {},
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({0.2}));
+    syn->setMaxDendriticDelayTimesteps(4);
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,79 @@
+//--------------------------------------------------------------------------
+/*! \file save_load_state/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "save_load_state_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+protected:
+    //--------------------------------------------------------------------------
+    // Protected methods
+    //--------------------------------------------------------------------------
+    // Simulate for a number of timesteps, recording membrane voltages and spiking neurons
+    std::vector<float> Record(unsigned int numTimesteps)
+    {
+        std::vector<float> recording;
+        for(unsigned int i = 0; i < numTimesteps; i++) {
+            StepGeNN();
+            pullPostCurrentSpikesFromDevice();
+            recording.insert(recording.end(), VPost, VPost + 10);
+            for(unsigned int s = 0; s < spikeCount_Post; s++) {
+                recording.push_back(-1.0f - (float)spike_Post[s]);
+            }
+        }
+        return recording;
+    }
+};
+
+TEST_F(SimTest, SaveLoadState)
+{
+    // Warm up network and checkpoint it
+    Record(100);
+    saveState("save_load_state.bin");
+
+    // Continue simulation from checkpoint
+    const std::vector<float> original = Record(200);
+
+    // Check that some spikes were propagated
+    EXPECT_GT(original.size(), 2000);
+
+    // Restore checkpoint and check time is restored
+    loadState("save_load_state.bin");
+    EXPECT_EQ(iT, 100);
+    EXPECT_FLOAT_EQ(t, 100.0f);
+
+    // Check that simulation from restored checkpoint exactly matches original
+    const std::vector<float> restored = Record(200);
+    EXPECT_EQ(original, restored);
+}
+
+TEST_F(SimTest, LoadInvalidState)
+{
+    // Check that files which aren't checkpoints are rejected
+    {
+        std::ofstream invalid("save_load_state_invalid.bin", std::ios::binary);
+        invalid << "NOTASTATEFILE, JUST SOME TEXT";
+    }
+    EXPECT_THROW(loadState("save_load_state_invalid.bin"), std::runtime_error);
+    EXPECT_THROW(loadState("does_not_exist.bin"), std::runtime_error);
+}
@@ -0,0 +1,87 @@
+//--------------------------------------------------------------------------
+/*! \file spike_event_condition_mask/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+//! Neuron whose state is the index of the current timestep
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 0, 1);
+
+    SET_SIM_CODE("$(x)= rint($(t) / DT);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Post
+//----------------------------------------------------------------------------
+class Post : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Post, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+
+IMPLEMENT_MODEL(Post);
+
+//----------------------------------------------------------------------------
+// WeightUpdateModel
+//----------------------------------------------------------------------------
+//! Emits a spike-like event every period timesteps
+class WeightUpdateModel : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(WeightUpdateModel, 1, 0, 0, 0);
+
+    SET_PARAM_NAMES({"period"});
+
+    SET_EVENT_THRESHOLD_CONDITION_CODE("(((int)$(x_pre) % (int)$(period)) == 0)");
+    SET_EVENT_CODE("$(addToInSyn, 1.0);\n");
+};
+
+IMPLEMENT_MODEL(WeightUpdateModel);
+
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("spike_event_condition_mask");
+
+    model.addNeuronPopulation<Pre>("Pre", 1, {}, Pre::VarValues(0.0));
+    model.addNeuronPopulation<Post>("Post2", 1, {}, Post::VarValues(0.0));
+    model.addNeuronPopulation<Post>("Post3", 1, {}, Post::VarValues(0.0));
+    model.addNeuronPopulation<Post>("Post5Delay", 1, {}, Post::VarValues(0.0));
+
+    // Each synapse group has a distinct event threshold condition so each tests a different bit of Pre's condition mask
+    // **NOTE** Syn2 and Syn3 only differ in their parameters so are merged, with each testing a different bit
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn2", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "Pre", "Post2",
+        WeightUpdateModel::ParamValues(2.0), {},
+        {}, {});
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn3", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY, "Pre", "Post3",
+        WeightUpdateModel::ParamValues(3.0), {},
+        {}, {});
+    model.addSynapsePopulation<WeightUpdateModel, PostsynapticModels::DeltaCurr>(
+        "Syn5Delay", SynapseMatrixType::DENSE_GLOBALG, 4, "Pre", "Post5Delay",
+        WeightUpdateModel::ParamValues(5.0), {},
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,48 @@
+//--------------------------------------------------------------------------
+/*! \file spike_event_condition_mask/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "spike_event_condition_mask_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+namespace
+{
+// Should postsynaptic neuron receive input in timestep from events emitted every period timesteps with delay
+bool shouldReceiveEvent(unsigned int timestep, unsigned int period, unsigned int delay)
+{
+    // **NOTE** events are emitted by neuron update so are processed by the synapse update of the following timestep
+    return (timestep > delay) && (((timestep - delay - 1) % period) == 0);
+}
+}
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, SpikeEventConditionMask)
+{
+    for(unsigned int i = 0; i < 50; i++) {
+        // Simulate timestep i
+        StepGeNN();
+
+        // Check each target only receives events emitted by its own synapse group's condition
+        ASSERT_EQ(xPost2[0], shouldReceiveEvent(i, 2, 0) ? 1.0f : 0.0f) << "timestep " << i;
+        ASSERT_EQ(xPost3[0], shouldReceiveEvent(i, 3, 0) ? 1.0f : 0.0f) << "timestep " << i;
+        ASSERT_EQ(xPost5Delay[0], shouldReceiveEvent(i, 5, 4) ? 1.0f : 0.0f) << "timestep " << i;
+    }
+}
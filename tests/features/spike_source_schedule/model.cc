@@ -0,0 +1,29 @@
+//--------------------------------------------------------------------------
+/*! \file spike_source_schedule/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(0.1);
+    model.setName("spike_source_schedule");
+
+    model.addNeuronPopulation<NeuronModels::SpikeSourceSchedule>("Pop", 100, {}, {});
+
+    // Give second population an input so it is simulated by testing every neuron
+    model.addNeuronPopulation<NeuronModels::SpikeSource>("Input", 1, {}, {});
+    model.addNeuronPopulation<NeuronModels::SpikeSourceSchedule>("PopInput", 100, {}, {});
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "InputPopInput", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY,
+        "Input", "PopInput",
+        {}, WeightUpdateModels::StaticPulse::VarValues(1.0),
+        {}, {});
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,117 @@
+//--------------------------------------------------------------------------
+/*! \file spike_source_schedule/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+// Standard C includes
+#include <cstdint>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "spike_source_schedule_CODE/definitions.h"
+
+// GeNN userproject includes
+#include "../../../userproject/include/spikeSchedule.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+protected:
+    //--------------------------------------------------------------------------
+    // SimulationTest virtuals
+    //--------------------------------------------------------------------------
+    virtual void Init()
+    {
+        // Write spike file, in reverse time order, where neuron i spikes at
+        // multiples of i + 1 timesteps (and twice at 10 timesteps) up to 20ms
+        {
+            std::ofstream spikeFile("spikes.bin", std::ios::binary);
+            for(int t = 200; t >= 0; t--) {
+                for(uint32_t i = 0; i < 100; i++) {
+                    if((t % (i + 1)) == 0) {
+                        const double time = t * DT;
+                        for(int r = 0; r < ((t == 10) ? 2 : 1); r++) {
+                            spikeFile.write(reinterpret_cast<const char*>(&time), sizeof(double));
+                            spikeFile.write(reinterpret_cast<const char*>(&i), sizeof(uint32_t));
+                        }
+                    }
+                }
+            }
+        }
+
+        // Load schedule and check duplicate spikes in timestep 10 have been removed
+        const SpikeSchedule schedule("spikes.bin", DT, 100);
+        ASSERT_EQ(schedule.getNumTimesteps(), 201);
+        ASSERT_EQ(schedule.getTimestepOffsets()[11] - schedule.getTimestepOffsets()[10], 4);
+
+        // Duplicate IDs in timestep 20 of schedule to check both code paths only emit them once
+        std::vector<unsigned int> timestepOffsets = schedule.getTimestepOffsets();
+        std::vector<unsigned int> neuronIDs;
+        for(unsigned int t = 0; t < schedule.getNumTimesteps(); t++) {
+            timestepOffsets[t] = (unsigned int)neuronIDs.size();
+            for(unsigned int s = schedule.getTimestepOffsets()[t]; s < schedule.getTimestepOffsets()[t + 1]; s++) {
+                neuronIDs.insert(neuronIDs.end(), (t == 20) ? 2 : 1, schedule.getNeuronIDs()[s]);
+            }
+        }
+        timestepOffsets.back() = (unsigned int)neuronIDs.size();
+
+        // Copy into both populations
+        numTimestepsPop = schedule.getNumTimesteps();
+        allocatespikeTimestepOffsetsPop(schedule.getNumTimesteps() + 1);
+        allocatespikeIDsPop((unsigned int)neuronIDs.size());
+        std::copy(timestepOffsets.cbegin(), timestepOffsets.cend(), spikeTimestepOffsetsPop);
+        std::copy(neuronIDs.cbegin(), neuronIDs.cend(), spikeIDsPop);
+        pushspikeTimestepOffsetsPopToDevice(schedule.getNumTimesteps() + 1);
+        pushspikeIDsPopToDevice((unsigned int)neuronIDs.size());
+
+        numTimestepsPopInput = schedule.getNumTimesteps();
+        allocatespikeTimestepOffsetsPopInput(schedule.getNumTimesteps() + 1);
+        allocatespikeIDsPopInput((unsigned int)neuronIDs.size());
+        std::copy(timestepOffsets.cbegin(), timestepOffsets.cend(), spikeTimestepOffsetsPopInput);
+        std::copy(neuronIDs.cbegin(), neuronIDs.cend(), spikeIDsPopInput);
+        pushspikeTimestepOffsetsPopInputToDevice(schedule.getNumTimesteps() + 1);
+        pushspikeIDsPopInputToDevice((unsigned int)neuronIDs.size());
+    }
+};
+
+TEST_F(SimTest, SpikeSourceSchedule)
+{
+    // Simulate beyond end of schedule
+    for(unsigned int t = 0; t < 250; t++) {
+        // Build vector of neurons which should spike this timestep
+        std::vector<unsigned int> correctSpikes;
+        if(t <= 200) {
+            for(unsigned int i = 0; i < 100; i++) {
+                if((t % (i + 1)) == 0) {
+                    correctSpikes.push_back(i);
+                }
+            }
+        }
+
+        StepGeNN();
+        pullPopCurrentSpikesFromDevice();
+        pullPopInputCurrentSpikesFromDevice();
+
+        // Check both populations emit correct spikes
+        std::vector<unsigned int> popSpikes(spike_Pop, spike_Pop + spikeCount_Pop);
+        std::vector<unsigned int> popInputSpikes(spike_PopInput, spike_PopInput + spikeCount_PopInput);
+        std::sort(popInputSpikes.begin(), popInputSpikes.end());
+        ASSERT_EQ(popSpikes, correctSpikes);
+        ASSERT_EQ(popInputSpikes, correctSpikes);
+    }
+}
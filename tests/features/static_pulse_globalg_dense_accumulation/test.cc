@@ -0,0 +1,49 @@
+//--------------------------------------------------------------------------
+/*! \file static_pulse_globalg_dense_accumulation/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C++ includes
+#include <algorithm>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "static_pulse_globalg_dense_accumulation_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, StaticPulseGlobalgDenseAccumulation)
+{
+    for(unsigned int numSpikes = 0; numSpikes <= 100; numSpikes++) {
+        // Emit spikes from first numSpikes presynaptic neurons
+        glbSpkCntPre[0] = numSpikes;
+        for(unsigned int i = 0; i < numSpikes; i++) {
+            glbSpkPre[i] = i;
+        }
+        pushPreSpikesToDevice();
+
+        StepGeNN();
+
+        // Calculate input by accumulating weight once per spike, as the generic presynaptic update does
+        float input = 0.0f;
+        for(unsigned int i = 0; i < numSpikes; i++) {
+            input += 0.1f;
+        }
+
+        // Check every postsynaptic neuron receives input accumulated in the same order
+        ASSERT_TRUE(std::all_of(&xPost[0], &xPost[10], [input](float x) { return x == input; })) << numSpikes << " spikes";
+    }
+}
@@ -0,0 +1,118 @@
+//--------------------------------------------------------------------------
+/*! \file wu_var_reduced_storage/model.cc
+
+\brief model definition file that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+
+
+#include "modelSpec.h"
+
+//----------------------------------------------------------------------------
+// Pre
+//----------------------------------------------------------------------------
+//! Neuron which spikes every timestep
+class Pre : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Pre, 0, 0);
+
+    SET_THRESHOLD_CONDITION_CODE("true");
+    SET_NEEDS_AUTO_REFRACTORY(false);
+};
+IMPLEMENT_MODEL(Pre);
+
+//----------------------------------------------------------------------------
+// Neuron
+//----------------------------------------------------------------------------
+class Neuron : public NeuronModels::Base
+{
+public:
+    DECLARE_MODEL(Neuron, 0, 1);
+
+    SET_SIM_CODE("$(x)= $(Isyn);\n");
+
+    SET_VARS({{"x", "scalar"}});
+};
+IMPLEMENT_MODEL(Neuron);
+
+//----------------------------------------------------------------------------
+// Potentiate
+//----------------------------------------------------------------------------
+//! Weight update model which delivers weight and then increments it, so weight is both widened and narrowed
+class Potentiate : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_WEIGHT_UPDATE_MODEL(Potentiate, 1, 1, 0, 0);
+
+    SET_PARAM_NAMES({"inc"});
+    SET_VARS({{"g", "scalar"}});
+
+    SET_SIM_CODE(
+        "$(addToInSyn, $(g));\n"
+        "$(g) += $(inc);\n");
+};
+IMPLEMENT_MODEL(Potentiate);
+
+//----------------------------------------------------------------------------
+// PostIndex
+//----------------------------------------------------------------------------
+//! Initialise each weight to a value which is not exactly representable in reduced precision
+class PostIndex : public InitVarSnippet::Base
+{
+public:
+    DECLARE_SNIPPET(PostIndex, 0);
+
+    SET_CODE("$(value) = 0.1 * (scalar)($(id_post) + 1);");
+};
+IMPLEMENT_SNIPPET(PostIndex);
+
+void modelDefinition(ModelSpec &model)
+{
+    model.setDT(1.0);
+    model.setName("wu_var_reduced_storage");
+
+    Potentiate::ParamValues potentiateParams(0.25);
+    Potentiate::VarValues potentiateInit(initVar<PostIndex>());
+    WeightUpdateModels::StaticPulse::VarValues staticSynapseInit(initVar<PostIndex>());
+
+    model.addNeuronPopulation<Pre>("Pre", 1, {}, {});
+    model.addNeuronPopulation<Neuron>("PostHalf", 10, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PostBFloat16", 10, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PostInt8", 10, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PostInt16", 10, {}, Neuron::VarValues(0.0));
+    model.addNeuronPopulation<Neuron>("PostStatic", 10, {}, Neuron::VarValues(0.0));
+
+    auto *synHalf = model.addSynapsePopulation<Potentiate, PostsynapticModels::DeltaCurr>(
+        "SynHalf", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostHalf",
+        potentiateParams, potentiateInit,
+        {}, {});
+    synHalf->setWUVarStorage("g", VarStorage::HALF);
+
+    auto *synBFloat16 = model.addSynapsePopulation<Potentiate, PostsynapticModels::DeltaCurr>(
+        "SynBFloat16", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostBFloat16",
+        potentiateParams, potentiateInit,
+        {}, {});
+    synBFloat16->setWUVarStorage("g", VarStorage::BFLOAT16);
+
+    auto *synInt8 = model.addSynapsePopulation<Potentiate, PostsynapticModels::DeltaCurr>(
+        "SynInt8", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostInt8",
+        potentiateParams, potentiateInit,
+        {}, {});
+    synInt8->setWUVarStorage("g", VarStorage::INT8, 1.0 / 32.0);
+
+    auto *synInt16 = model.addSynapsePopulation<Potentiate, PostsynapticModels::DeltaCurr>(
+        "SynInt16", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostInt16",
+        potentiateParams, potentiateInit,
+        {}, {});
+    synInt16->setWUVarStorage("g", VarStorage::INT16, 1.0 / 4096.0);
+
+    auto *synStatic = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+        "SynStatic", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY, "Pre", "PostStatic",
+        {}, staticSynapseInit,
+        {}, {});
+    synStatic->setWUVarStorage("g", VarStorage::HALF);
+
+    model.setPrecision(GENN_FLOAT);
+}
@@ -0,0 +1,77 @@
+//--------------------------------------------------------------------------
+/*! \file wu_var_reduced_storage/test.cc
+
+\brief Main test code that is part of the feature testing
+suite of minimal models with known analytic outcomes that are used for continuous integration testing.
+*/
+//--------------------------------------------------------------------------
+// Standard C includes
+#include <cmath>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// Auto-generated simulation code includess
+#include "wu_var_reduced_storage_CODE/definitions.h"
+
+// **NOTE** base-class for simulation tests must be
+// included after auto-generated globals are includes
+#include "../../utils/simulation_test.h"
+
+//----------------------------------------------------------------------------
+// SimTest
+//----------------------------------------------------------------------------
+class SimTest : public SimulationTest
+{
+};
+
+TEST_F(SimTest, WUVarReducedStorage)
+{
+    // Tolerances reflect the precision of each format at the magnitude of the weights
+    const float halfTolerance = 1E-3f;
+    const float bfloat16Tolerance = 8E-3f;
+    const float int8Tolerance = (1.0f / 32.0f) * 0.5f;
+    const float int16Tolerance = (1.0f / 4096.0f) * 0.5f;
+
+    // Check conversion functions round-trip exactly representable values
+    ASSERT_EQ(gennHalfToFloat(gennFloatToHalf(0.25f)), 0.25f);
+    ASSERT_EQ(gennHalfToFloat(gennFloatToHalf(-1.5f)), -1.5f);
+    ASSERT_EQ(gennBFloat16ToFloat(gennFloatToBFloat16(3.0f)), 3.0f);
+    ASSERT_EQ(gennFloatToInt8(200.0f), 127);
+    ASSERT_EQ(gennFloatToInt16(-40000.0f), -32768);
+
+    // Check weights have been narrowed during initialisation
+    for(int j = 0; j < 10; j++) {
+        const float g = 0.1f * (float)(j + 1);
+        ASSERT_NEAR(gennHalfToFloat(gSynHalf[j]), g, halfTolerance);
+        ASSERT_NEAR(gennBFloat16ToFloat(gSynBFloat16[j]), g, bfloat16Tolerance);
+        ASSERT_NEAR((float)gSynInt8[j] / 32.0f, g, int8Tolerance);
+        ASSERT_NEAR((float)gSynInt16[j] / 4096.0f, g, int16Tolerance);
+    }
+
+    // Simulate first timestep in which presynaptic neuron spikes
+    StepGeNN();
+
+    // Simulate timesteps in which spikes are delivered and weights incremented
+    for(int i = 1; i < 10; i++) {
+        StepGeNN();
+
+        // Check widened weights are delivered
+        for(int j = 0; j < 10; j++) {
+            const float g = 0.1f * (float)(j + 1);
+            const float potentiatedG = g + (0.25f * (float)(i - 1));
+            ASSERT_NEAR(xPostHalf[j], potentiatedG, halfTolerance);
+            ASSERT_NEAR(xPostBFloat16[j], potentiatedG, bfloat16Tolerance);
+            ASSERT_NEAR(xPostInt8[j], potentiatedG, int8Tolerance);
+            ASSERT_NEAR(xPostInt16[j], potentiatedG, int16Tolerance);
+            ASSERT_NEAR(xPostStatic[j], g, halfTolerance);
+        }
+    }
+
+    // Check narrowed weights have been written back
+    for(int j = 0; j < 10; j++) {
+        const float potentiatedG = 0.1f * (float)(j + 1) + (0.25f * 9.0f);
+        ASSERT_NEAR(gennHalfToFloat(gSynHalf[j]), potentiatedG, halfTolerance);
+        ASSERT_NEAR((float)gSynInt8[j] / 32.0f, potentiatedG, int8Tolerance);
+    }
+}
@@ -14,14 +14,19 @@ FOR /D %%F IN (*) DO (
 	REM Push feature directory
 	PUSHD %%F
 	
-	REM Build model
-	CALL genn-buildmodel.bat %BUILD_FLAGS% model.cc
-	
-	REM Build model
-	msbuild "%%F.sln" /m /t:%%F /p:BuildProjectReferences=true /verbosity:minimal /p:Configuration=Release
-	
-	REM Run tests
-	test.exe --gtest_output="xml:test_results.xml"
+	REM MPI tests are not supported on Windows so skip
+	IF EXIST mpi_hosts (
+		ECHO Skipping...
+	) ELSE (
+		REM Build model
+		CALL genn-buildmodel.bat %BUILD_FLAGS% model.cc
+		
+		REM Build model
+		msbuild "%%F.sln" /m /t:%%F /p:BuildProjectReferences=true /verbosity:minimal /p:Configuration=Release
+		
+		REM Run tests
+		test.exe --gtest_output="xml:test_results.xml"
+	)
 
 	REM pop directory
 	POPD
@@ -47,6 +47,28 @@ for f in features/*/ ; do
     # If skip file exists for this backend, skip
     if [ -f "skip_$BACKEND" ]; then
         echo "Skipping..."
+    # If this is an MPI test but MPI isn't available, skip
+    elif [ -f "mpi_hosts" ] && ! command -v mpirun > /dev/null; then
+        echo "Skipping (MPI not found)..."
+    # Otherwise, if this is an MPI test
+    elif [ -f "mpi_hosts" ]; then
+        # Determine where the sim code is located for this test and how many hosts it uses
+        c=$(basename $f)"_CODE"
+        NUM_HOSTS=$(cat mpi_hosts)
+
+        # Clean test
+        make clean SIM_CODE=$c
+
+        # Run code generator on each host and, if it succeeds, build and run test executable for each host
+        if mpirun --oversubscribe -np $NUM_HOSTS genn-buildmodel.sh $BUILD_FLAGS -m -v model.cc; then
+            if make -j $CORE_COUNT SIM_CODE=$c; then
+                MPMD_ARGS=""
+                for ((h = 0; h < NUM_HOSTS; h++)); do
+                    MPMD_ARGS+="${MPMD_ARGS:+ : }-np 1 ./test_$h --gtest_output=xml:test_results_$h.xml"
+                done
+                mpirun --oversubscribe $MPMD_ARGS
+            fi
+        fi
     # Otherwise
     else
         # Determine where the sim code is located for this test
@@ -553,3 +553,75 @@ TEST(NeuronGroup, CompareWUPostUpdate)
     ASSERT_TRUE(wumPostMergedUpdateGroup->isInSynWUMParamHeterogeneous(0, 0));
     ASSERT_TRUE(wumPostMergedInitGroup->isInSynWUMVarInitParamHeterogeneous(0, 0, 0));
 }
+
+TEST(NeuronGroup, Partition)
+{
+    ModelSpecInternal model;
+
+    // Add three neuron groups, the last of which is simulated on host 1
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    auto *ng0 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+    auto *ng1 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 10, paramVals, varVals);
+    auto *ng2 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons2", 10, paramVals, varVals);
+    ng2->setHostID(1);
+
+    // Connect host 0 neurons to each other and to host 1 and connect host 1 neurons back to Neurons0
+    WeightUpdateModels::StaticPulse::VarValues staticPulseVarVals(0.1);
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("SG0", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                               "Neurons0", "Neurons1",
+                                                                                               {}, staticPulseVarVals,
+                                                                                               {}, {});
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("SG1", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                               "Neurons1", "Neurons2",
+                                                                                               {}, staticPulseVarVals,
+                                                                                               {}, {});
+    model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("SG2", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                               "Neurons2", "Neurons0",
+                                                                                               {}, staticPulseVarVals,
+                                                                                               {}, {});
+    model.addCurrentSource<CurrentSourceModels::DC>("CS0", "Neurons2", {0.4}, {});
+
+    model.partition(0);
+    model.finalize();
+
+    // Check synapse group and current source simulated on host 1 have been removed
+    ASSERT_EQ(model.getSynapseGroups().size(), 2);
+    ASSERT_EQ(model.getSynapseGroups().count("SG1"), 0);
+    ASSERT_TRUE(model.getLocalCurrentSources().empty());
+
+    // Check Neurons2 has been replaced with placeholder which only provides spikes
+    ASSERT_EQ(model.getNeuronGroups().size(), 3);
+    ASSERT_FALSE(ng0->isRemote());
+    ASSERT_TRUE(ng2->isRemote());
+    ASSERT_TRUE(ng2->getNeuronModel()->getVars().empty());
+    ASSERT_TRUE(static_cast<NeuronGroupInternal*>(ng2)->getInSyn().empty());
+    ASSERT_TRUE(static_cast<NeuronGroupInternal*>(ng2)->isTrueSpikeRequired());
+
+    // Check Neurons1's spikes are sent to host 1
+    const auto *ng1Internal = static_cast<NeuronGroupInternal*>(ng1);
+    ASSERT_TRUE(ng1Internal->getOutSyn().empty());
+    ASSERT_EQ(ng1Internal->getSpikeDestinationHosts(), std::set<int>{1});
+    ASSERT_TRUE(ng1Internal->isTrueSpikeRequired());
+}
+
+TEST(NeuronGroup, PartitionRemotePreVar)
+{
+    ModelSpecInternal model;
+
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    auto *ng0 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 10, paramVals, varVals);
+    ng0->setHostID(1);
+
+    // Presynaptic weight update model variables cannot be updated from spikes received from another host
+    WeightUpdateModelPre::VarValues wumVarVals(0.0);
+    WeightUpdateModelPre::PreVarValues wumPreVarVals(0.0);
+    model.addSynapsePopulation<WeightUpdateModelPre, PostsynapticModels::DeltaCurr>("SG0", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                    "Neurons0", "Neurons1",
+                                                                                    {0.0}, wumVarVals, wumPreVarVals, {},
+                                                                                    {}, {});
+
+    ASSERT_THROW(model.partition(0), std::runtime_error);
+}
@@ -44,6 +44,37 @@ public:
     SET_NEEDS_AUTO_REFRACTORY(false);
 };
 
+//--------------------------------------------------------------------------
+// LeakyIntegratorRK4
+//--------------------------------------------------------------------------
+class LeakyIntegratorRK4 : public NeuronModels::Base
+{
+public:
+    SET_ODES({{"V", "(-$(V) + $(Isyn)) / $(tau)"}});
+    SET_ODE_INTEGRATOR(RK4);
+
+    SET_PARAM_NAMES({"tau"});
+    SET_VARS({{"V", "scalar"}});
+};
+
+//--------------------------------------------------------------------------
+// LeakyIntegratorRK45
+//--------------------------------------------------------------------------
+class LeakyIntegratorRK45 : public LeakyIntegratorRK4
+{
+public:
+    SET_ODE_INTEGRATOR(RK45);
+};
+
+//--------------------------------------------------------------------------
+// LeakyIntegratorUnknownVar
+//--------------------------------------------------------------------------
+class LeakyIntegratorUnknownVar : public LeakyIntegratorRK4
+{
+public:
+    SET_ODES({{"U", "(-$(U) + $(Isyn)) / $(tau)"}});
+};
+
 //--------------------------------------------------------------------------
 // Tests
 //--------------------------------------------------------------------------
@@ -60,3 +91,18 @@ TEST(NeuronModels, CompareCopyPasted)
     LIFCopy lifCopy;
     ASSERT_TRUE(NeuronModels::LIF::getInstance()->canBeMerged(&lifCopy));
 }
+
+TEST(NeuronModels, CompareODEIntegrators)
+{
+    LeakyIntegratorRK4 rk4;
+    LeakyIntegratorRK4 rk4Copy;
+    LeakyIntegratorRK45 rk45;
+    ASSERT_TRUE(rk4.canBeMerged(&rk4Copy));
+    ASSERT_FALSE(rk4.canBeMerged(&rk45));
+}
+
+TEST(NeuronModels, ODEUnknownVar)
+{
+    LeakyIntegratorUnknownVar unknownVar;
+    EXPECT_THROW(unknownVar.getODECode(), std::runtime_error);
+}
@@ -277,6 +277,63 @@ TEST(SynapseGroup, CompareWUDifferentProceduralVars)
     ASSERT_TRUE(modelSpecMerged.getMergedPresynapticUpdateGroups().at(0).isWUVarInitParamHeterogeneous(0, 1));
 }
 
+TEST(SynapseGroup, CompareWUDifferentVarStorage)
+{
+    ModelSpecInternal model;
+
+    // Add two neuron groups to model
+    NeuronModels::Izhikevich::ParamValues paramVals(0.02, 0.2, -65.0, 8.0);
+    NeuronModels::Izhikevich::VarValues varVals(0.0, 0.0);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons0", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons1", 10, paramVals, varVals);
+
+    WeightUpdateModels::StaticPulse::VarValues staticPulseVarVals(0.1);
+    auto *sg0 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Synapses0", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                                           "Neurons0", "Neurons1",
+                                                                                                           {}, staticPulseVarVals,
+                                                                                                           {}, {});
+    auto *sg1 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Synapses1", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                                           "Neurons0", "Neurons1",
+                                                                                                           {}, staticPulseVarVals,
+                                                                                                           {}, {});
+    auto *sg2 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Synapses2", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                                           "Neurons0", "Neurons1",
+                                                                                                           {}, staticPulseVarVals,
+                                                                                                           {}, {});
+    auto *sg3 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Synapses3", SynapseMatrixType::DENSE_INDIVIDUALG, NO_DELAY,
+                                                                                                           "Neurons0", "Neurons1",
+                                                                                                           {}, staticPulseVarVals,
+                                                                                                           {}, {});
+    auto *sg4 = model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>("Synapses4", SynapseMatrixType::DENSE_GLOBALG, NO_DELAY,
+                                                                                                           "Neurons0", "Neurons1",
+                                                                                                           {}, staticPulseVarVals,
+                                                                                                           {}, {});
+    sg0->setWUVarStorage("g", VarStorage::INT8, 1.0 / 32.0);
+    sg1->setWUVarStorage("g", VarStorage::INT8, 1.0 / 32.0);
+    sg2->setWUVarStorage("g", VarStorage::INT8, 1.0 / 64.0);
+    sg3->setWUVarStorage("g", VarStorage::HALF);
+
+    // Check that global weights can't be stored in reduced precision
+    try {
+        sg4->setWUVarStorage("g", VarStorage::HALF);
+        FAIL();
+    }
+    catch(const std::runtime_error &) {
+    }
+
+    // Finalize model
+    model.finalize();
+
+    // Check that only groups with the same storage format and scale can be merged
+    SynapseGroupInternal *sg0Internal = static_cast<SynapseGroupInternal *>(sg0);
+    ASSERT_TRUE(sg0Internal->canWUBeMerged(*sg1));
+    ASSERT_FALSE(sg0Internal->canWUBeMerged(*sg2));
+    ASSERT_FALSE(sg0Internal->canWUBeMerged(*sg3));
+    ASSERT_TRUE(sg0Internal->canWUInitBeMerged(*sg1));
+    ASSERT_FALSE(sg0Internal->canWUInitBeMerged(*sg2));
+    ASSERT_FALSE(sg0Internal->canWUInitBeMerged(*sg3));
+}
+
 TEST(SynapseGroup, InitCompareWUDifferentVars)
 {
     ModelSpecInternal model;
@@ -494,6 +551,32 @@ TEST(SynapseGroup, InvalidMatrixTypes)
     }
     catch(const std::runtime_error &) {
     }
+
+    // Check that making a synapse group with kernel weights fails if connectivity initialiser doesn't define a kernel
+    try {
+        InitSparseConnectivitySnippet::FixedProbability::ParamValues fixedProbParams(0.1);
+        model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+            "NeuronsA_NeuronsB_5", SynapseMatrixType::PROCEDURAL_KERNELG, NO_DELAY,
+            "NeuronsA", "NeuronsB",
+            {}, {1.0},
+            {}, {},
+            initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+        FAIL();
+    }
+    catch(const std::runtime_error &) {
+    }
+
+    // Check that making a synapse group with CSR connectivity fails if no connectivity initialiser is specified
+    try {
+        model.addSynapsePopulation<WeightUpdateModels::StaticPulse, PostsynapticModels::DeltaCurr>(
+            "NeuronsA_NeuronsB_6", SynapseMatrixType::CSR_INDIVIDUALG, NO_DELAY,
+            "NeuronsA", "NeuronsB",
+            {}, {1.0},
+            {}, {});
+        FAIL();
+    }
+    catch(const std::runtime_error &) {
+    }
 }
 
 TEST(SynapseGroup, SharedWeightSlaveInvalidMethods)
@@ -547,6 +630,27 @@ TEST(SynapseGroup, SharedWeightSlaveInvalidMethods)
     }
     catch (const std::runtime_error &) {
     }
+
+    try {
+        slave->setWUVarStorage("g", VarStorage::HALF);
+        FAIL();
+    }
+    catch (const std::runtime_error &) {
+    }
+
+    try {
+        slave->setPostsynapticReorderingEnabled(true);
+        FAIL();
+    }
+    catch (const std::runtime_error &) {
+    }
+
+    try {
+        slave->setCompressedSparseIndEnabled(true);
+        FAIL();
+    }
+    catch (const std::runtime_error &) {
+    }
     //setSparseConnectivityExtraGlobalParamLocation
     //setMaxSourceConnections
 }
\ No newline at end of file
@@ -27,11 +27,12 @@ class GenerateRunBase
 public:
     GenerateRunBase(const std::string &projectName)
     :   m_App{"Generate run application for '" + projectName + "' user project"},
-        m_Debug(false), m_CPUOnly(false), m_Timing(false), m_ScalarType("float"), m_GPUDevice(-1), m_ProjectName(projectName)
+        m_Debug(false), m_CPUOnly(false), m_Timing(false), m_BuildOnly(false), m_ScalarType("float"), m_GPUDevice(-1), m_ProjectName(projectName)
     {
         m_App.add_flag("--debug", m_Debug, "Whether to run in a debugger");
         auto *cpuOnly = m_App.add_flag("--cpu-only", m_CPUOnly, "Whether to build against single-threaded CPU backend");
         m_App.add_flag("--timing", m_Timing, "Whether to use GeNN's timing mechanism to measure performance");
+        m_App.add_flag("--build-only", m_BuildOnly, "Whether to only build the model, for example so it can be benchmarked, without running it");
         m_App.add_set("--ftype", m_ScalarType, {"float", "double"}, "What floating point type to use", true);
         m_App.add_option("--gpu-device", m_GPUDevice, "What GPU device ID to use (-1 = select automatically)", true)->excludes(cpuOnly);
         m_App.add_option("experimentName", m_ExperimentName, "Experiment name")->required();
@@ -98,6 +99,11 @@ public:
             return EXIT_FAILURE;
         }
 
+        // If we're only building the model, stop
+        if(m_BuildOnly) {
+            return EXIT_SUCCESS;
+        }
+
         // run it!
         std::cout << "running test..." << std::endl;
 #ifdef _WIN32
@@ -216,6 +222,7 @@ private:
     bool m_Debug;
     bool m_CPUOnly;
     bool m_Timing;
+    bool m_BuildOnly;
     std::string m_ScalarType;
     int m_GPUDevice;
     std::string m_ExperimentName;
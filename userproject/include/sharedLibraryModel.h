@@ -397,6 +397,27 @@ public:
     double getPostsynapticUpdateTime() const{ return *(double*)getSymbol("postsynapticUpdateTime"); }
     double getSynapseDynamicsTime() const{ return *(double*)getSymbol("synapseDynamicsTime"); }
     double getInitSparseTime() const{ return *(double*)getSymbol("initSparseTime"); }
+
+    // Hardware performance counters (cycles, instructions, LLC misses and branch misses) accumulated in each phase
+    unsigned long long getPerfCounter(const std::string &phase, unsigned int counter) const{ return ((unsigned long long*)getSymbol(phase + "PerfCounters"))[counter]; }
+    bool arePerfCountersAvailable() const{ return ((bool (*)(void))getSymbol("arePerfCountersAvailable"))(); }
+
+    // Per-group profile, only available if model was built with profiling enabled
+    void resetProfile() const{ ((void (*)(void))getSymbol("resetProfile"))(); }
+    void setProfileTraceCapacity(unsigned long long capacity) const{ ((void (*)(unsigned long long))getSymbol("setProfileTraceCapacity"))(capacity); }
+    unsigned int getProfileNumRegions() const{ return ((unsigned int (*)(void))getSymbol("getProfileNumRegions"))(); }
+    std::string getProfileRegionName(unsigned int region) const{ return ((const char *(*)(unsigned int))getSymbol("getProfileRegionName"))(region); }
+    std::string getProfileRegionPhase(unsigned int region) const{ return ((const char *(*)(unsigned int))getSymbol("getProfileRegionPhase"))(region); }
+    int getProfileRegionParent(unsigned int region) const{ return ((int (*)(unsigned int))getSymbol("getProfileRegionParent"))(region); }
+    unsigned long long getProfileRegionCount(unsigned int region) const{ return ((unsigned long long (*)(unsigned int))getSymbol("getProfileRegionCount"))(region); }
+    double getProfileRegionTotalTime(unsigned int region) const{ return ((double (*)(unsigned int))getSymbol("getProfileRegionTotalTime"))(region); }
+    double getProfileRegionMinTime(unsigned int region) const{ return ((double (*)(unsigned int))getSymbol("getProfileRegionMinTime"))(region); }
+    double getProfileRegionMaxTime(unsigned int region) const{ return ((double (*)(unsigned int))getSymbol("getProfileRegionMaxTime"))(region); }
+    unsigned int getProfileNumHistogramBins() const{ return ((unsigned int (*)(void))getSymbol("getProfileNumHistogramBins"))(); }
+    unsigned long long getProfileRegionHistogram(unsigned int region, unsigned int bin) const{ return ((unsigned long long (*)(unsigned int, unsigned int))getSymbol("getProfileRegionHistogram"))(region, bin); }
+    unsigned long long getProfileRegionPerfCounter(unsigned int region, unsigned int counter) const{ return ((unsigned long long (*)(unsigned int, unsigned int))getSymbol("getProfileRegionPerfCounter"))(region, counter); }
+    void writeProfileTrace(const std::string &path) const{ ((void (*)(const char*))getSymbol("writeProfileTrace"))(path.c_str()); }
+    void writeProfileSummary(const std::string &path) const{ ((void (*)(const char*))getSymbol("writeProfileSummary"))(path.c_str()); }
     
     void *getSymbol(const std::string &symbolName, bool allowMissing = false, void *defaultSymbol = nullptr) const
     {
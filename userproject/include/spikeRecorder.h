@@ -2,12 +2,21 @@
 
 // Standard C++ includes
 #include <algorithm>
+#include <condition_variable>
 #include <fstream>
 #include <iterator>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
 #include <tuple>
 #include <vector>
 
+// Standard C includes
+#include <cstdint>
+#include <cstring>
+
 //----------------------------------------------------------------------------
 // SpikeWriterText
 //----------------------------------------------------------------------------
@@ -134,6 +143,182 @@ private:
     std::list<std::pair<double, std::vector<unsigned int>>> m_Cache;
 };
 
+//----------------------------------------------------------------------------
+// SpikeWriterBinary
+//----------------------------------------------------------------------------
+//! Class to write spikes to compact binary file from a background thread
+/*! Each timestep's spikes are copied into a fixed-size ring buffer and a background thread
+    drains it, writing one block per timestep containing spikes. Files start with the magic
+    number "GSPK" and a 32-bit version number. Each block then consists of a little-endian
+    double-precision time (in ms), a 32-bit spike count and the 32-bit number of bytes of encoded
+    IDs which follow. IDs are sorted and each is stored as the LEB128 varint-encoded difference
+    from the previous one (the first being stored as-is). These files can be read using
+    userproject/python/spike_reader.py */
+class SpikeWriterBinary
+{
+public:
+    SpikeWriterBinary(const std::string &filename, size_t bufferSize = 1024 * 1024)
+    :   m_State(new State(filename, bufferSize))
+    {
+        m_State->writer = std::thread(&State::drain, m_State.get());
+    }
+
+    SpikeWriterBinary(SpikeWriterBinary &&other) = default;
+
+    ~SpikeWriterBinary()
+    {
+        // If writer hasn't been moved from, signal background thread to stop and wait for it to finish draining
+        if(m_State) {
+            {
+                std::lock_guard<std::mutex> lock(m_State->mutex);
+                m_State->stop = true;
+            }
+            m_State->dataAvailable.notify_one();
+            m_State->writer.join();
+        }
+    }
+
+protected:
+    //----------------------------------------------------------------------------
+    // Protected API
+    //----------------------------------------------------------------------------
+    void recordSpikes(double t, unsigned int spikeCount, const unsigned int *currentSpikes)
+    {
+        // Don't bother writing blocks for timesteps without spikes
+        if(spikeCount > 0) {
+            const uint32_t count = spikeCount;
+            m_State->push(&t, sizeof(double));
+            m_State->push(&count, sizeof(uint32_t));
+            m_State->push(currentSpikes, sizeof(unsigned int) * spikeCount);
+        }
+    }
+
+private:
+    //----------------------------------------------------------------------------
+    // State
+    //----------------------------------------------------------------------------
+    //! State shared with background thread, held by pointer so writer remains movable
+    struct State
+    {
+        State(const std::string &filename, size_t bufferSize)
+        :   stream(filename, std::ios::binary), buffer(bufferSize), readPos(0), writePos(0), used(0), stop(false)
+        {
+            static_assert(sizeof(unsigned int) == sizeof(uint32_t), "SpikeWriterBinary requires 32-bit unsigned int");
+            if(!stream.good()) {
+                throw std::runtime_error("Cannot open spike file '" + filename + "'");
+            }
+            if(bufferSize == 0) {
+                throw std::runtime_error("SpikeWriterBinary requires non-zero buffer size");
+            }
+
+            // Write header
+            const uint32_t version = 1;
+            stream.write("GSPK", 4);
+            stream.write(reinterpret_cast<const char*>(&version), sizeof(uint32_t));
+        }
+
+        //! Copy data into ring buffer, waiting for background thread to free space if required
+        void push(const void *data, size_t size)
+        {
+            const char *bytes = static_cast<const char*>(data);
+            while(size > 0) {
+                std::unique_lock<std::mutex> lock(mutex);
+                spaceAvailable.wait(lock, [this](){ return (used < buffer.size()); });
+
+                // Copy as much as possible without wrapping
+                const size_t chunk = std::min(size, std::min(buffer.size() - used, buffer.size() - writePos));
+                std::memcpy(&buffer[writePos], bytes, chunk);
+                writePos = (writePos + chunk) % buffer.size();
+                used += chunk;
+                lock.unlock();
+
+                dataAvailable.notify_one();
+                bytes += chunk;
+                size -= chunk;
+            }
+        }
+
+        //! Copy data out of ring buffer, waiting for it to be pushed if required
+        /*! \return false if writer has been stopped and buffer is empty */
+        bool pop(void *data, size_t size)
+        {
+            char *bytes = static_cast<char*>(data);
+            while(size > 0) {
+                std::unique_lock<std::mutex> lock(mutex);
+                dataAvailable.wait(lock, [this](){ return (used > 0 || stop); });
+                if(used == 0) {
+                    return false;
+                }
+
+                // Copy as much as possible without wrapping
+                const size_t chunk = std::min(size, std::min(used, buffer.size() - readPos));
+                std::memcpy(bytes, &buffer[readPos], chunk);
+                readPos = (readPos + chunk) % buffer.size();
+                used -= chunk;
+                lock.unlock();
+
+                spaceAvailable.notify_one();
+                bytes += chunk;
+                size -= chunk;
+            }
+            return true;
+        }
+
+        //! Background thread function which encodes blocks from ring buffer and writes them to file
+        void drain()
+        {
+            std::vector<uint32_t> ids;
+            std::vector<uint8_t> encoded;
+            double t;
+            uint32_t count;
+            while(pop(&t, sizeof(double)) && pop(&count, sizeof(uint32_t))) {
+                ids.resize(count);
+                pop(ids.data(), sizeof(uint32_t) * count);
+
+                // Sort IDs so deltas are non-negative and small
+                std::sort(ids.begin(), ids.end());
+
+                // Varint-encode deltas
+                encoded.clear();
+                uint32_t prev = 0;
+                for(uint32_t id : ids) {
+                    uint32_t delta = id - prev;
+                    prev = id;
+                    while(delta >= 0x80) {
+                        encoded.push_back((uint8_t)((delta & 0x7F) | 0x80));
+                        delta >>= 7;
+                    }
+                    encoded.push_back((uint8_t)delta);
+                }
+
+                // Write block
+                const uint32_t numBytes = (uint32_t)encoded.size();
+                stream.write(reinterpret_cast<const char*>(&t), sizeof(double));
+                stream.write(reinterpret_cast<const char*>(&count), sizeof(uint32_t));
+                stream.write(reinterpret_cast<const char*>(&numBytes), sizeof(uint32_t));
+                stream.write(reinterpret_cast<const char*>(encoded.data()), encoded.size());
+            }
+        }
+
+        std::ofstream stream;
+        std::vector<char> buffer;
+        size_t readPos;
+        size_t writePos;
+        size_t used;
+        bool stop;
+
+        std::mutex mutex;
+        std::condition_variable dataAvailable;
+        std::condition_variable spaceAvailable;
+        std::thread writer;
+    };
+
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::unique_ptr<State> m_State;
+};
+
 //----------------------------------------------------------------------------
 // SpikeRecorderBase
 //----------------------------------------------------------------------------
@@ -0,0 +1,143 @@
+#pragma once
+
+// Standard C++ includes
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Standard C includes
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+//----------------------------------------------------------------------------
+// SpikeSchedule
+//----------------------------------------------------------------------------
+//! Schedule of spikes, sorted by timestep and then neuron ID, for a NeuronModels::SpikeSourceSchedule population
+/*! Spikes are loaded from binary files containing consecutive records, each consisting of a little-endian
+    double-precision spike time (in ms) followed by a 32-bit unsigned neuron ID. Spikes are scheduled in the
+    timestep nearest to their spike time and duplicates within a timestep are removed. The file is read twice
+    in fixed-size chunks - first to count the spikes in each timestep and then to scatter their IDs into
+    place - so memory use is only that of the schedule itself, regardless of whether the file is sorted. */
+class SpikeSchedule
+{
+public:
+    SpikeSchedule(const std::string &filename, double dt, unsigned int numNeurons)
+    {
+        // Count spikes in each timestep
+        std::vector<unsigned int> timestepCounts;
+        readRecords(filename, dt, numNeurons,
+                    [&timestepCounts](unsigned int timestep, unsigned int)
+                    {
+                        if(timestep >= timestepCounts.size()) {
+                            timestepCounts.resize(timestep + 1, 0);
+                        }
+                        timestepCounts[timestep]++;
+                    });
+
+        // Calculate where each timestep's spikes start
+        m_TimestepOffsets.resize(timestepCounts.size() + 1);
+        m_TimestepOffsets[0] = 0;
+        unsigned long long totalSpikes = 0;
+        for(size_t i = 0; i < timestepCounts.size(); i++) {
+            totalSpikes += timestepCounts[i];
+            if(totalSpikes > std::numeric_limits<unsigned int>::max()) {
+                throw std::runtime_error("Spike file '" + filename + "' contains too many spikes");
+            }
+            m_TimestepOffsets[i + 1] = (unsigned int)totalSpikes;
+        }
+
+        // Scatter IDs of neurons into their timestep
+        m_NeuronIDs.resize(totalSpikes);
+        std::vector<unsigned int> timestepNext(m_TimestepOffsets.cbegin(), m_TimestepOffsets.cend() - 1);
+        readRecords(filename, dt, numNeurons,
+                    [&timestepNext, this](unsigned int timestep, unsigned int id)
+                    {
+                        m_NeuronIDs[timestepNext[timestep]++] = id;
+                    });
+
+        // Sort IDs within each timestep and remove duplicates, compacting schedule in place
+        // **NOTE** duplicates would only spike once anyway but this means getNumSpikes counts each once
+        unsigned int numUniqueSpikes = 0;
+        for(size_t i = 0; i < timestepCounts.size(); i++) {
+            const auto timestepBegin = m_NeuronIDs.begin() + m_TimestepOffsets[i];
+            const auto timestepEnd = m_NeuronIDs.begin() + m_TimestepOffsets[i + 1];
+            std::sort(timestepBegin, timestepEnd);
+            const auto uniqueEnd = std::unique(timestepBegin, timestepEnd);
+
+            m_TimestepOffsets[i] = numUniqueSpikes;
+            for(auto id = timestepBegin; id != uniqueEnd; id++) {
+                m_NeuronIDs[numUniqueSpikes++] = *id;
+            }
+        }
+        m_TimestepOffsets.back() = numUniqueSpikes;
+        m_NeuronIDs.resize(numUniqueSpikes);
+    }
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    //! Number of timesteps spanned by schedule i.e. the value for the numTimesteps extra global parameter
+    unsigned int getNumTimesteps() const{ return (unsigned int)(m_TimestepOffsets.size() - 1); }
+
+    //! Number of spikes in schedule
+    unsigned int getNumSpikes() const{ return (unsigned int)m_NeuronIDs.size(); }
+
+    //! Indices into neuron IDs where each timestep's spikes start i.e. the spikeTimestepOffsets extra global parameter
+    const std::vector<unsigned int> &getTimestepOffsets() const{ return m_TimestepOffsets; }
+
+    //! IDs of neurons to spike in each timestep i.e. the spikeIDs extra global parameter
+    const std::vector<unsigned int> &getNeuronIDs() const{ return m_NeuronIDs; }
+
+private:
+    //----------------------------------------------------------------------------
+    // Private methods
+    //----------------------------------------------------------------------------
+    template<typename F>
+    static void readRecords(const std::string &filename, double dt, unsigned int numNeurons, F handler)
+    {
+        std::ifstream file(filename, std::ios::binary);
+        if(!file.good()) {
+            throw std::runtime_error("Cannot open spike file '" + filename + "'");
+        }
+
+        // Read file in chunks of records
+        constexpr size_t recordSize = sizeof(double) + sizeof(uint32_t);
+        std::vector<char> buffer(recordSize * 65536);
+        while(file.read(buffer.data(), buffer.size()) || file.gcount() > 0) {
+            const size_t bytesRead = (size_t)file.gcount();
+            if((bytesRead % recordSize) != 0) {
+                throw std::runtime_error("Spike file '" + filename + "' is truncated");
+            }
+
+            // Loop through records
+            for(size_t r = 0; r < bytesRead; r += recordSize) {
+                double time;
+                uint32_t id;
+                std::memcpy(&time, &buffer[r], sizeof(double));
+                std::memcpy(&id, &buffer[r + sizeof(double)], sizeof(uint32_t));
+
+                if(id >= numNeurons) {
+                    throw std::runtime_error("Spike file '" + filename + "' contains spike from neuron " + std::to_string(id)
+                                             + " but population only has " + std::to_string(numNeurons) + " neurons");
+                }
+                if(time < 0.0) {
+                    throw std::runtime_error("Spike file '" + filename + "' contains spike at negative time");
+                }
+
+                // **NOTE** rounding to the nearest timestep means spike times recorded at single-precision
+                // multiples of dt aren't pushed into the neighbouring timestep by rounding errors
+                handler((unsigned int)std::floor((time / dt) + 0.5), id);
+            }
+        }
+    }
+
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::vector<unsigned int> m_TimestepOffsets;
+    std::vector<unsigned int> m_NeuronIDs;
+};
@@ -2,9 +2,14 @@ import numpy as np
 import matplotlib.pyplot as plt
 import sys
 
+import spike_reader
+
 def plot(filename, time_range, neuron_range, axis, yoffset=0):
     # Load data,  transposing each column into a seperate array
-    data = np.loadtxt(filename, dtype=[("time", float), ("neuron", int)], unpack=True)
+    if spike_reader.is_binary(filename):
+        data = list(spike_reader.read_spikes(filename))
+    else:
+        data = np.loadtxt(filename, dtype=[("time", float), ("neuron", int)], unpack=True)
 
     # If a time or neuron range were specified
     if time_range is not None or neuron_range is not None:
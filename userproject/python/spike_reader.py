@@ -0,0 +1,73 @@
+import numpy as np
+import sys
+
+MAGIC = b"GSPK"
+VERSION = 1
+
+# Header of each block: time, spike count and number of bytes of encoded IDs
+block_header_dtype = np.dtype([("time", "<f8"), ("count", "<u4"), ("num_bytes", "<u4")])
+
+def is_binary(filename):
+    # Binary spike files written by SpikeWriterBinary start with magic number
+    with open(filename, "rb") as f:
+        return f.read(len(MAGIC)) == MAGIC
+
+def decode_ids(encoded, count):
+    # Each varint ends with a byte whose top bit is clear
+    ends = (encoded & 0x80) == 0
+    if np.count_nonzero(ends) != count:
+        raise ValueError("Encoded spike IDs do not match spike count")
+
+    # Calculate which varint each byte belongs to and its position within it
+    varint_index = np.concatenate(([0], np.cumsum(ends[:-1])))
+    varint_start = np.concatenate(([0], np.flatnonzero(ends[:-1]) + 1))
+    shift = 7 * (np.arange(len(encoded)) - varint_start[varint_index])
+
+    # Sum shifted 7-bit groups into deltas and accumulate deltas into IDs
+    deltas = np.zeros(count, dtype=np.uint64)
+    np.add.at(deltas, varint_index, (encoded & 0x7F).astype(np.uint64) << shift.astype(np.uint64))
+    return np.cumsum(deltas).astype(np.uint32)
+
+def read_spikes(filename):
+    # Read entire file
+    data = np.fromfile(filename, dtype=np.uint8)
+    if len(data) < 8 or data[:4].tobytes() != MAGIC:
+        raise ValueError("'%s' is not a binary spike file" % filename)
+    version = data[4:8].view("<u4")[0]
+    if version != VERSION:
+        raise ValueError("'%s' has unsupported version %u" % (filename, version))
+
+    # Loop through blocks
+    times = []
+    ids = []
+    offset = 8
+    while offset < len(data):
+        if (offset + block_header_dtype.itemsize) > len(data):
+            raise ValueError("'%s' is truncated" % filename)
+        header = data[offset:offset + block_header_dtype.itemsize].view(block_header_dtype)[0]
+        offset += block_header_dtype.itemsize
+
+        num_bytes = int(header["num_bytes"])
+        if (offset + num_bytes) > len(data):
+            raise ValueError("'%s' is truncated" % filename)
+
+        # Decode IDs and repeat block's time for each spike
+        count = int(header["count"])
+        ids.append(decode_ids(data[offset:offset + num_bytes], count))
+        times.append(np.full(count, header["time"]))
+        offset += num_bytes
+
+    # Concatenate blocks into time and ID arrays, in the same form as reading text spike files
+    if len(times) == 0:
+        return np.empty(0, dtype=float), np.empty(0, dtype=np.uint32)
+    else:
+        return np.concatenate(times), np.concatenate(ids)
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2:
+        print("Usage: spike_reader.py filename")
+    else:
+        # Print spikes in the same format as SpikeWriterText
+        times, ids = read_spikes(sys.argv[1])
+        for t, i in zip(times, ids):
+            print("%.16g %u" % (t, i))